@@ -0,0 +1,1135 @@
+// Micro-benchmarks for the s21 containers. Build and run everything with
+// `make bench`, or pass a substring of a benchmark name to run a subset:
+//   ./s21_bench spsc
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+void Report(const char* name, size_t ops, Clock::duration elapsed) {
+  double ns = std::chrono::duration<double, std::nano>(elapsed).count();
+  std::printf("%-44s %10.2f Mops/s %10.1f ns/op\n", name, ops / ns * 1e3,
+              ns / ops);
+}
+
+// Mutex-protected s21::Queue, the baseline the concurrent queues replace.
+template <class T>
+class LockedQueue {
+ public:
+  bool TryPush(const T& value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.Push(value);
+    return true;
+  }
+
+  bool TryPop(T& out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.Empty()) return false;
+    out = queue_.Front();
+    queue_.Pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::Queue<T> queue_;
+};
+
+template <class Queue>
+void PushSpin(Queue& queue, int value) {
+  while (!queue.TryPush(value)) std::this_thread::yield();
+}
+
+template <class Queue>
+int PopSpin(Queue& queue) {
+  int value = 0;
+  while (!queue.TryPop(value)) std::this_thread::yield();
+  return value;
+}
+
+// SPSC------------------------------------------------------------------------
+
+constexpr int kSpscItems = 2000000;
+
+template <class Queue>
+void SpscThroughput(const char* name, Queue& queue) {
+  auto start = Clock::now();
+  std::thread producer([&queue] {
+    for (int i = 0; i < kSpscItems; ++i) PushSpin(queue, i);
+  });
+  long long sum = 0;
+  for (int i = 0; i < kSpscItems; ++i) sum += PopSpin(queue);
+  producer.join();
+  Report(name, kSpscItems, Clock::now() - start);
+  if (sum != 1LL * kSpscItems * (kSpscItems - 1) / 2) std::puts("  MISMATCH");
+}
+
+void BenchSpscThroughput() {
+  s21::SpscQueue<int> spsc(1024);
+  SpscThroughput("spsc/throughput/SpscQueue", spsc);
+  LockedQueue<int> locked;
+  SpscThroughput("spsc/throughput/mutex+Queue", locked);
+}
+
+void BenchSpscBatchThroughput() {
+  constexpr size_t kBatch = 64;
+  s21::SpscQueue<int> queue(1024);
+  auto start = Clock::now();
+  std::thread producer([&queue] {
+    int batch[kBatch];
+    for (int i = 0; i < kSpscItems;) {
+      size_t n = 0;
+      while (n < kBatch && i + static_cast<int>(n) < kSpscItems) {
+        batch[n] = i + static_cast<int>(n);
+        ++n;
+      }
+      size_t pushed = queue.TryPushN(batch, n);
+      if (!pushed) std::this_thread::yield();
+      i += static_cast<int>(pushed);
+    }
+  });
+  int batch[kBatch];
+  for (int received = 0; received < kSpscItems;) {
+    size_t popped = queue.TryPopN(batch, kBatch);
+    if (!popped) std::this_thread::yield();
+    received += static_cast<int>(popped);
+  }
+  producer.join();
+  Report("spsc/throughput/SpscQueue TryPushN/TryPopN", kSpscItems,
+         Clock::now() - start);
+}
+
+template <class Queue>
+void SpscLatency(const char* name, Queue& ping, Queue& pong) {
+  constexpr int kRoundTrips = 100000;
+  std::thread echo([&ping, &pong] {
+    for (int i = 0; i < kRoundTrips; ++i) PushSpin(pong, PopSpin(ping));
+  });
+  auto start = Clock::now();
+  for (int i = 0; i < kRoundTrips; ++i) {
+    PushSpin(ping, i);
+    PopSpin(pong);
+  }
+  Report(name, kRoundTrips, Clock::now() - start);
+  echo.join();
+}
+
+void BenchSpscLatency() {
+  s21::SpscQueue<int> spsc_ping(64), spsc_pong(64);
+  SpscLatency("spsc/round-trip/SpscQueue", spsc_ping, spsc_pong);
+  LockedQueue<int> locked_ping, locked_pong;
+  SpscLatency("spsc/round-trip/mutex+Queue", locked_ping, locked_pong);
+}
+
+// MPMC------------------------------------------------------------------------
+
+constexpr int kMpmcItems = 1 << 20;
+
+template <class Queue, class PushFn, class PopFn>
+void MpmcScaling(const char* name, int threads, Queue& queue, PushFn push,
+                 PopFn pop) {
+  int per_thread = kMpmcItems / threads;
+  std::vector<std::thread> workers;
+  auto start = Clock::now();
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&queue, &push, per_thread] {
+      for (int i = 0; i < per_thread; ++i) push(queue, i);
+    });
+    workers.emplace_back([&queue, &pop, per_thread] {
+      for (int i = 0; i < per_thread; ++i) pop(queue);
+    });
+  }
+  for (auto& worker : workers) worker.join();
+  char label[64];
+  std::snprintf(label, sizeof(label), "%s %2dP/%2dC", name, threads, threads);
+  Report(label, static_cast<size_t>(per_thread) * threads,
+         Clock::now() - start);
+}
+
+void BenchMpmcScaling() {
+  for (int threads = 1; threads <= 64; threads *= 2) {
+    s21::MpmcQueue<int> mpmc(1024);
+    MpmcScaling(
+        "mpmc/MpmcQueue", threads, mpmc,
+        [](s21::MpmcQueue<int>& q, int value) { q.Push(value); },
+        [](s21::MpmcQueue<int>& q) {
+          int value;
+          q.Pop(value);
+        });
+    LockedQueue<int> locked;
+    MpmcScaling(
+        "mpmc/mutex+Queue", threads, locked,
+        [](LockedQueue<int>& q, int value) { PushSpin(q, value); },
+        [](LockedQueue<int>& q) { PopSpin(q); });
+  }
+}
+
+// WORK STEALING--------------------------------------------------------------
+
+long long SequentialFib(int n) {
+  return n < 2 ? n : SequentialFib(n - 1) + SequentialFib(n - 2);
+}
+
+long long PoolFib(s21::ThreadPool& pool, int n) {
+  if (n < 20) return SequentialFib(n);
+  long long x = 0, y = 0;
+  pool.Invoke([&] { x = PoolFib(pool, n - 1); },
+              [&] { y = PoolFib(pool, n - 2); });
+  return x + y;
+}
+
+void BenchWorkStealingFib() {
+  constexpr int kN = 32;
+  auto start = Clock::now();
+  long long expected = SequentialFib(kN);
+  Report("work-stealing/fib(32)/sequential", 1, Clock::now() - start);
+  for (size_t threads = 1; threads <= std::thread::hardware_concurrency();
+       threads *= 2) {
+    s21::ThreadPool pool(threads);
+    long long result = 0;
+    start = Clock::now();
+    pool.Submit([&pool, &result] { result = PoolFib(pool, kN); });
+    pool.Wait();
+    char label[64];
+    std::snprintf(label, sizeof(label), "work-stealing/fib(32)/ThreadPool %2zu",
+                  threads);
+    Report(label, 1, Clock::now() - start);
+    if (result != expected) std::puts("  MISMATCH");
+  }
+}
+
+// Many small independent tasks, all submitted from outside the pool
+void BenchWorkStealingSubmit() {
+  constexpr int kTasks = 200000;
+  s21::ThreadPool pool;
+  std::atomic<long long> sum{0};
+  auto start = Clock::now();
+  for (int i = 0; i < kTasks; ++i) {
+    pool.Submit([&sum, i] { sum.fetch_add(i, std::memory_order_relaxed); });
+  }
+  pool.Wait();
+  Report("work-stealing/submit/ThreadPool", kTasks, Clock::now() - start);
+  if (sum != 1LL * kTasks * (kTasks - 1) / 2) std::puts("  MISMATCH");
+}
+
+// BLOCKING--------------------------------------------------------------------
+
+constexpr int kBlockingItems = 1 << 20;
+constexpr int kBlockingConsumers = 2;
+
+// One producer pushing in bursts of 64 while the consumers drain the queue
+template <class Push, class Finish, class Consume>
+void BlockingPipeline(const char* name, Push push, Finish finish,
+                      Consume consume) {
+  std::vector<std::thread> consumers;
+  auto start = Clock::now();
+  for (int t = 0; t < kBlockingConsumers; ++t) consumers.emplace_back(consume);
+  int burst[64];
+  for (int i = 0; i < kBlockingItems; i += 64) {
+    for (int j = 0; j < 64; ++j) burst[j] = i + j;
+    push(burst, burst + 64);
+  }
+  finish();
+  for (auto& consumer : consumers) consumer.join();
+  Report(name, kBlockingItems, Clock::now() - start);
+}
+
+void BenchBlockingPipeline() {
+  LockedQueue<int> locked;
+  BlockingPipeline(
+      "blocking/polling mutex+Queue",
+      [&locked](int* first, int* last) {
+        for (; first != last; ++first) locked.TryPush(*first);
+      },
+      [&locked] {
+        for (int t = 0; t < kBlockingConsumers; ++t) locked.TryPush(-1);
+      },
+      [&locked] {
+        while (PopSpin(locked) != -1) {
+        }
+      });
+  s21::BlockingQueue<int> single;
+  BlockingPipeline(
+      "blocking/BlockingQueue Push/Pop",
+      [&single](int* first, int* last) {
+        for (; first != last; ++first) single.Push(*first);
+      },
+      [&single] { single.Close(); },
+      [&single] {
+        int value = 0;
+        while (single.Pop(value)) {
+        }
+      });
+  s21::BlockingQueue<int> batched;
+  BlockingPipeline(
+      "blocking/BlockingQueue PushRange/PopBatch",
+      [&batched](int* first, int* last) { batched.PushRange(first, last); },
+      [&batched] { batched.Close(); },
+      [&batched] {
+        for (;;) {
+          s21::Vector<int> batch;
+          if (!batched.PopBatch(64, batch)) break;
+        }
+      });
+}
+
+// ADAPTORS--------------------------------------------------------------------
+
+constexpr int kAdaptorItems = 1000000;
+constexpr int kSmallBatch = 4;
+
+void BenchStackLoad() {
+  std::vector<int> items(kAdaptorItems);
+  for (int i = 0; i < kAdaptorItems; ++i) items[i] = i;
+  {
+    auto start = Clock::now();
+    s21::Stack<int> stack;
+    for (int item : items) stack.Push(item);
+    Report("adaptors/Stack Push", kAdaptorItems, Clock::now() - start);
+  }
+  {
+    auto start = Clock::now();
+    s21::Stack<int> stack;
+    stack.PushRange(items.begin(), items.end());
+    Report("adaptors/Stack PushRange", kAdaptorItems, Clock::now() - start);
+  }
+  {
+    s21::Stack<int> stack;
+    stack.PushRange(items.begin(), items.end());
+    auto start = Clock::now();
+    s21::Vector<int> out;
+    stack.PopN(kAdaptorItems, out);
+    Report("adaptors/Stack PopN", kAdaptorItems, Clock::now() - start);
+  }
+  // Batches of kSmallBatch, as a producer handing over a few items at a
+  // time does; each batch must not copy what is already there
+  {
+    auto start = Clock::now();
+    s21::Stack<int> stack;
+    for (int i = 0; i < kAdaptorItems; i += kSmallBatch) {
+      stack.PushRange(items.begin() + i, items.begin() + i + kSmallBatch);
+    }
+    s21::Vector<int> out;
+    while (stack.PopN(kSmallBatch, out)) {
+    }
+    Report("adaptors/Stack PushRange/PopN small batches", kAdaptorItems,
+           Clock::now() - start);
+  }
+}
+
+// PRIORITY QUEUE--------------------------------------------------------------
+
+constexpr int kHeapItems = 1 << 20;
+
+std::vector<int> RandomInts(int count) {
+  std::vector<int> values(count);
+  unsigned seed = 42;
+  for (int& value : values) {
+    seed = seed * 1103515245 + 12345;
+    value = static_cast<int>(seed >> 8);
+  }
+  return values;
+}
+
+template <size_t Arity>
+void HeapPushPop(const char* name, const std::vector<int>& values) {
+  auto start = Clock::now();
+  s21::PriorityQueue<int, s21::Vector<int>, std::greater<int>, Arity> queue;
+  for (int value : values) queue.Push(value);
+  bool sorted = true;
+  for (int previous = queue.Top(); !queue.Empty(); queue.Pop()) {
+    sorted = sorted && previous <= queue.Top();
+    previous = queue.Top();
+  }
+  Report(name, 2 * values.size(), Clock::now() - start);
+  if (!sorted) std::puts("  MISMATCH");
+}
+
+void BenchPriorityQueue() {
+  std::vector<int> values = RandomInts(kHeapItems);
+  HeapPushPop<2>("priority-queue/PriorityQueue d=2", values);
+  HeapPushPop<4>("priority-queue/PriorityQueue d=4", values);
+  HeapPushPop<8>("priority-queue/PriorityQueue d=8", values);
+  auto start = Clock::now();
+  s21::Multiset<int> multiset;
+  for (int value : values) multiset.Insert(value);
+  while (!multiset.Empty()) multiset.Erase(multiset.Begin());
+  Report("priority-queue/Multiset Insert/Erase(Begin)", 2 * values.size(),
+         Clock::now() - start);
+}
+
+// DIJKSTRA--------------------------------------------------------------------
+
+constexpr int kGraphNodes = 1000000;
+constexpr int kGraphDegree = 4;
+constexpr long long kUnreached = -1;
+
+// Random directed graph in compressed sparse row form; every node also has
+// an edge to the next one, so everything is reachable from node 0
+struct Graph {
+  std::vector<int> offsets;
+  std::vector<int> targets;
+  std::vector<int> weights;
+};
+
+Graph RandomGraph() {
+  Graph graph;
+  graph.offsets.reserve(kGraphNodes + 1);
+  unsigned seed = 2024;
+  for (int node = 0; node < kGraphNodes; ++node) {
+    graph.offsets.push_back(static_cast<int>(graph.targets.size()));
+    for (int e = 0; e <= kGraphDegree; ++e) {
+      seed = seed * 1103515245 + 12345;
+      int target = e == 0 ? (node + 1) % kGraphNodes
+                          : static_cast<int>((seed >> 4) % kGraphNodes);
+      graph.targets.push_back(target);
+      graph.weights.push_back(1 + static_cast<int>((seed >> 12) % 1000));
+    }
+  }
+  graph.offsets.push_back(static_cast<int>(graph.targets.size()));
+  return graph;
+}
+
+using DistanceNode = std::pair<long long, int>;
+
+// Queue is one of the adaptors below: Push, DecreaseKey and PopMin
+template <class Queue>
+long long Dijkstra(const char* name, const Graph& graph) {
+  auto start = Clock::now();
+  std::vector<long long> distance(kGraphNodes, kUnreached);
+  Queue queue(kGraphNodes);
+  distance[0] = 0;
+  queue.Push(0, 0);
+  while (!queue.Empty()) {
+    DistanceNode top = queue.PopMin();
+    for (int e = graph.offsets[top.second]; e < graph.offsets[top.second + 1];
+         ++e) {
+      int target = graph.targets[e];
+      long long candidate = top.first + graph.weights[e];
+      if (distance[target] == kUnreached) {
+        distance[target] = candidate;
+        queue.Push(target, candidate);
+      } else if (candidate < distance[target]) {
+        queue.DecreaseKey(target, distance[target], candidate);
+        distance[target] = candidate;
+      }
+    }
+  }
+  Report(name, kGraphNodes, Clock::now() - start);
+  long long checksum = 0;
+  for (long long d : distance) checksum += d;
+  return checksum;
+}
+
+class IndexedDijkstraQueue {
+ public:
+  explicit IndexedDijkstraQueue(int nodes) : handles_(nodes) {
+    queue_.Reserve(nodes);
+  }
+  bool Empty() const { return queue_.Empty(); }
+  void Push(int node, long long distance) {
+    handles_[node] = queue_.Push({distance, node});
+  }
+  void DecreaseKey(int node, long long, long long distance) {
+    queue_.DecreaseKey(handles_[node], {distance, node});
+  }
+  DistanceNode PopMin() {
+    DistanceNode top = queue_.Top();
+    queue_.Pop();
+    return top;
+  }
+
+ private:
+  s21::IndexedPriorityQueue<DistanceNode> queue_;
+  std::vector<size_t> handles_;
+};
+
+class PairingDijkstraQueue {
+ public:
+  explicit PairingDijkstraQueue(int nodes) : handles_(nodes) {}
+  bool Empty() const { return queue_.Empty(); }
+  void Push(int node, long long distance) {
+    handles_[node] = queue_.Push({distance, node});
+  }
+  void DecreaseKey(int node, long long, long long distance) {
+    queue_.DecreaseKey(handles_[node], {distance, node});
+  }
+  DistanceNode PopMin() {
+    DistanceNode top = queue_.Top();
+    queue_.Pop();
+    return top;
+  }
+
+ private:
+  s21::PairingHeap<DistanceNode> queue_;
+  std::vector<s21::PairingHeap<DistanceNode>::Handle> handles_;
+};
+
+// The workaround: an ordered tree keyed by (distance, node), re-keyed by
+// erasing and reinserting
+class SetDijkstraQueue {
+ public:
+  explicit SetDijkstraQueue(int) {}
+  bool Empty() { return set_.Empty(); }
+  void Push(int node, long long distance) { set_.Insert({distance, node}); }
+  void DecreaseKey(int node, long long old_distance, long long distance) {
+    set_.Erase(set_.Find({old_distance, node}));
+    set_.Insert({distance, node});
+  }
+  DistanceNode PopMin() {
+    auto it = set_.Begin();
+    DistanceNode top = *it;
+    set_.Erase(it);
+    return top;
+  }
+
+ private:
+  s21::Set<DistanceNode> set_;
+};
+
+void BenchDijkstra() {
+  Graph graph = RandomGraph();
+  long long indexed =
+      Dijkstra<IndexedDijkstraQueue>("dijkstra/IndexedPriorityQueue", graph);
+  long long pairing =
+      Dijkstra<PairingDijkstraQueue>("dijkstra/PairingHeap", graph);
+  long long set =
+      Dijkstra<SetDijkstraQueue>("dijkstra/Set erase+insert", graph);
+  if (indexed != pairing || indexed != set) std::puts("  MISMATCH");
+}
+
+// TIMERS----------------------------------------------------------------------
+
+constexpr int kTimers = 1 << 20;
+constexpr std::uint64_t kTimerSpread = 1 << 20;
+
+// Arms kTimers timeouts, cancels every other one (the common case for
+// request timeouts) and advances the clock past all deadlines
+void BenchTimerWheel() {
+  std::vector<int> offsets = RandomInts(kTimers);
+  {
+    auto start = Clock::now();
+    s21::TimerWheel<int> wheel;
+    std::vector<s21::TimerWheel<int>::Handle> handles(kTimers);
+    for (int i = 0; i < kTimers; ++i) {
+      handles[i] = wheel.Schedule(1 + offsets[i] % kTimerSpread, i);
+    }
+    for (int i = 0; i < kTimers; i += 2) wheel.Cancel(handles[i]);
+    size_t fired = wheel.Advance(kTimerSpread, [](int) {});
+    Report("timers/TimerWheel", 2 * kTimers, Clock::now() - start);
+    if (fired != kTimers / 2) std::puts("  MISMATCH");
+  }
+  {
+    using Deadline = std::pair<std::uint64_t, int>;
+    auto start = Clock::now();
+    s21::Multiset<Deadline> deadlines;
+    for (int i = 0; i < kTimers; ++i) {
+      deadlines.Insert({1 + offsets[i] % kTimerSpread, i});
+    }
+    for (int i = 0; i < kTimers; i += 2) {
+      deadlines.Erase(deadlines.Find({1 + offsets[i] % kTimerSpread, i}));
+    }
+    size_t fired = 0;
+    while (!deadlines.Empty() && (*deadlines.Begin()).first <= kTimerSpread) {
+      deadlines.Erase(deadlines.Begin());
+      ++fired;
+    }
+    Report("timers/Multiset", 2 * kTimers, Clock::now() - start);
+    if (fired != kTimers / 2) std::puts("  MISMATCH");
+  }
+}
+
+// UNROLLED LIST---------------------------------------------------------------
+
+constexpr int kListItems = 1 << 20;
+constexpr int kListPasses = 20;
+
+// Builds the sequence with PushBack, then sums it kListPasses times
+template <class Sequence>
+void ListTraversal(const char* name) {
+  auto start = Clock::now();
+  Sequence sequence;
+  for (int i = 0; i < kListItems; ++i) sequence.PushBack(i);
+  long long sum = 0;
+  for (int pass = 0; pass < kListPasses; ++pass) {
+    for (auto it = sequence.Begin(); it != sequence.End(); ++it) sum += *it;
+  }
+  Report(name, size_t(kListItems) * (kListPasses + 1), Clock::now() - start);
+  if (sum != (long long)kListItems * (kListItems - 1) / 2 * kListPasses) {
+    std::puts("  MISMATCH");
+  }
+}
+
+void BenchListTraversal() {
+  ListTraversal<s21::List<int>>("list_traversal/List");
+  ListTraversal<s21::UnrolledList<int, 32>>("list_traversal/UnrolledList");
+  ListTraversal<s21::Vector<int>>("list_traversal/Vector");
+}
+
+// CACHE-----------------------------------------------------------------------
+
+constexpr int kCacheOps = 1 << 21;
+constexpr int kCacheKeys = 1 << 16;
+constexpr size_t kCacheCapacity = 1 << 12;
+
+// Read-through workload over skewed keys: a miss is followed by a Put
+template <class Cache>
+void CacheWorkload(const char* name, const std::vector<int>& keys) {
+  auto start = Clock::now();
+  Cache cache(kCacheCapacity);
+  for (int key : keys) {
+    if (!cache.Get(key)) cache.Put(key, key);
+  }
+  Report(name, keys.size(), Clock::now() - start);
+  const s21::CacheStats& stats = cache.Stats();
+  std::printf("  hit ratio %.3f, %zu evictions\n",
+              double(stats.hits) / keys.size(), stats.evictions);
+  if (stats.hits + stats.misses != keys.size()) std::puts("  MISMATCH");
+}
+
+void BenchCache() {
+  // Cubing a uniform draw concentrates the keys near zero
+  std::vector<int> keys = RandomInts(kCacheOps);
+  for (int& key : keys) {
+    long long u = key % kCacheKeys;
+    key = static_cast<int>(u * u / kCacheKeys * u / kCacheKeys);
+  }
+  CacheWorkload<s21::LruCache<int, int>>("cache/LruCache", keys);
+  CacheWorkload<s21::LfuCache<int, int>>("cache/LfuCache", keys);
+}
+
+// CONCURRENT MAP--------------------------------------------------------------
+
+constexpr int kMapOps = 1 << 17;
+constexpr int kMapKeys = 1 << 14;
+
+// One mutex around an s21::Map, the setup ConcurrentMap replaces
+class LockedMap {
+ public:
+  bool Find(int key, int& out) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = map_.Find(key);
+    if (it == map_.Cend()) return false;
+    out = it->second;
+    return true;
+  }
+
+  bool Insert(int key, int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.Insert(key, value).second;
+  }
+
+  void InsertOrAssign(int key, int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.InsertOrAssign(key, value);
+  }
+
+  bool Erase(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = map_.Find(key);
+    if (it == map_.End()) return false;
+    map_.Erase(it);
+    return true;
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  s21::Map<int, int> map_;
+};
+
+// Every thread runs kMapOps operations, one in write_every of them a write;
+// writes alternate between inserting and erasing, so the size stays put
+template <class Map>
+void MapMixed(const char* name, int threads, int write_every) {
+  Map map;
+  std::vector<int> keys = RandomInts(kMapOps);
+  for (int& key : keys) key %= kMapKeys;
+  // Random order, since Map is an unbalanced tree
+  for (int key : keys) map.Insert(key, key);
+  std::atomic<long long> found{0};
+  auto start = Clock::now();
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&map, &keys, &found, t, write_every] {
+      long long hits = 0;
+      int value = 0;
+      for (int i = 0; i < kMapOps; ++i) {
+        int key = keys[(i + t * 7919) % kMapOps];
+        if (i % write_every != 0) {
+          hits += map.Find(key, value);
+        } else if (i / write_every % 2) {
+          map.Erase(key);
+        } else {
+          map.Insert(key, i);
+        }
+      }
+      found += hits;
+    });
+  }
+  for (std::thread& worker : workers) worker.join();
+  char label[64];
+  std::snprintf(label, sizeof(label), "%s %dt 1/%d writes", name, threads,
+                write_every);
+  Report(label, size_t(kMapOps) * threads, Clock::now() - start);
+  if (found == 0) std::puts("  MISMATCH");
+}
+
+void BenchConcurrentMap() {
+  for (int write_every : {2, 10, 100}) {
+    for (int threads : {1, 2, 4}) {
+      MapMixed<LockedMap>("concurrent-map/LockedMap", threads, write_every);
+      MapMixed<s21::ConcurrentMap<int, int>>("concurrent-map/ConcurrentMap",
+                                             threads, write_every);
+    }
+  }
+}
+
+// CONCURRENT SKIP LIST MAP-----------------------------------------------------
+
+void BenchSkipListMap() {
+  for (int write_every : {2, 10, 100}) {
+    for (int threads : {1, 2, 4}) {
+      MapMixed<LockedMap>("skip-list/LockedMap", threads, write_every);
+      MapMixed<s21::ConcurrentSkipListMap<int, int>>("skip-list/SkipListMap",
+                                                     threads, write_every);
+    }
+  }
+}
+
+// PERSISTENT MAP---------------------------------------------------------------
+
+constexpr int kSnapshotKeys = 1 << 14;
+
+// A reader takes a consistent view and the writer then changes one key: a
+// full tree copy for Map, a shared root for PersistentMap
+void BenchPersistentMap() {
+  std::vector<int> keys = RandomInts(kSnapshotKeys);
+  s21::Map<int, int> map;
+  s21::PersistentMap<int, int> persistent;
+  for (int key : keys) {
+    map.InsertOrAssign(key, key);
+    persistent = persistent.InsertOrAssign(key, key);
+  }
+  const int copies = 200;
+  auto start = Clock::now();
+  long long sizes = 0;
+  for (int i = 0; i < copies; ++i) {
+    s21::Map<int, int> snapshot(map);
+    map.InsertOrAssign(keys[i], i);
+    sizes += snapshot.Size();
+  }
+  Report("snapshot/Map copy+update", copies, Clock::now() - start);
+  const int updates = 1 << 17;
+  start = Clock::now();
+  long long persistent_sizes = 0;
+  for (int i = 0; i < updates; ++i) {
+    s21::PersistentMap<int, int> snapshot = persistent;
+    persistent = persistent.InsertOrAssign(keys[i % kSnapshotKeys], i);
+    persistent_sizes += snapshot.Size();
+  }
+  Report("snapshot/PersistentMap copy+update", updates, Clock::now() - start);
+  if (sizes != copies * (long long)map.Size() ||
+      persistent_sizes != updates * (long long)persistent.Size()) {
+    std::puts("  MISMATCH");
+  }
+  start = Clock::now();
+  long long found = 0;
+  for (int i = 0; i < updates; ++i) {
+    found += persistent.Contains(keys[i % kSnapshotKeys]);
+  }
+  Report("snapshot/PersistentMap lookup", updates, Clock::now() - start);
+  start = Clock::now();
+  for (int i = 0; i < updates; ++i) {
+    found -= map.Contains(keys[i % kSnapshotKeys]);
+  }
+  Report("snapshot/Map lookup", updates, Clock::now() - start);
+  if (found != 0) std::puts("  MISMATCH");
+}
+
+// RCU MAP----------------------------------------------------------------------
+
+constexpr int kRouteKeys = 1 << 12;
+constexpr int kRouteBatch = 16;
+
+// Each writer round changes kRouteBatch entries, the way a routing table
+// takes a batch of updates every now and then
+template <class Map>
+void UpdateRoutes(Map& map, int round) {
+  for (int i = 0; i < kRouteBatch; ++i) {
+    map.InsertOrAssign((round * kRouteBatch + i) % kRouteKeys, round);
+  }
+}
+
+void UpdateRoutes(s21::RcuMap<int, int>& map, int round) {
+  for (int i = 0; i < kRouteBatch; ++i) {
+    map.InsertOrAssign((round * kRouteBatch + i) % kRouteKeys, round);
+  }
+  map.Publish();
+}
+
+// Readers look routes up while one writer updates a batch every
+// millisecond
+template <class Map>
+void RouteLookups(const char* name, int threads) {
+  Map map;
+  std::vector<int> keys = RandomInts(kMapOps);
+  for (int& key : keys) key %= kRouteKeys;
+  for (int key : keys) map.InsertOrAssign(key, 0);
+  UpdateRoutes(map, 0);
+  std::atomic<bool> done{false};
+  std::thread writer([&map, &done] {
+    for (int round = 1; !done; ++round) {
+      UpdateRoutes(map, round);
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  });
+  std::atomic<long long> found{0};
+  auto start = Clock::now();
+  std::vector<std::thread> readers;
+  for (int t = 0; t < threads; ++t) {
+    readers.emplace_back([&map, &keys, &found, t] {
+      long long hits = 0;
+      int value = 0;
+      for (int i = 0; i < kMapOps; ++i) {
+        hits += map.Find(keys[(i + t * 7919) % kMapOps], value);
+      }
+      found += hits;
+    });
+  }
+  for (std::thread& reader : readers) reader.join();
+  auto elapsed = Clock::now() - start;
+  done = true;
+  writer.join();
+  char label[64];
+  std::snprintf(label, sizeof(label), "%s %dt", name, threads);
+  Report(label, size_t(kMapOps) * threads, elapsed);
+  if (found != (long long)kMapOps * threads) std::puts("  MISMATCH");
+}
+
+void BenchRcuMap() {
+  for (int threads : {1, 2, 4}) {
+    RouteLookups<LockedMap>("routes/LockedMap", threads);
+    RouteLookups<s21::ConcurrentMap<int, int>>("routes/ConcurrentMap",
+                                               threads);
+    RouteLookups<s21::RcuMap<int, int>>("routes/RcuMap", threads);
+  }
+}
+
+// COPY ON WRITE----------------------------------------------------------------
+
+constexpr int kStages = 8;
+constexpr int kStageReads = 64;
+constexpr int kStageRuns = 64;
+constexpr int kPipelineItems = 1 << 14;
+
+// A pipeline of kStages stages, each taking what the previous one produced
+// by value and reading kStageReads entries; the last stage changes one
+template <class Vec>
+long long VectorPipeline(const Vec& input, int run) {
+  Vec current(input);
+  long long sum = 0;
+  for (int stage = 0; stage < kStages; ++stage) {
+    Vec next(current);
+    const Vec& view = next;
+    for (int i = 0; i < kStageReads; ++i) {
+      sum += view[(run + i * 4099) % kPipelineItems];
+    }
+    if (stage == kStages - 1) next[run % kPipelineItems] = run;
+    current = std::move(next);
+  }
+  return sum;
+}
+
+template <class Map>
+long long MapPipeline(const Map& input, const std::vector<int>& keys,
+                      int run) {
+  Map current(input);
+  long long sum = 0;
+  for (int stage = 0; stage < kStages; ++stage) {
+    Map next(current);
+    const Map& view = next;
+    for (int i = 0; i < kStageReads; ++i) {
+      sum += view.At(keys[(run + i * 4099) % kPipelineItems]);
+    }
+    if (stage == kStages - 1) next.InsertOrAssign(keys[run], run);
+    current = std::move(next);
+  }
+  return sum;
+}
+
+void BenchCopyOnWrite() {
+  std::vector<int> keys = RandomInts(kPipelineItems);
+  s21::Vector<int> vector;
+  s21::Map<int, int> map;
+  for (int key : keys) {
+    vector.PushBack(key % 1000);
+    map.InsertOrAssign(key, key % 1000);
+  }
+  s21::CowVector<int> cow_vector{s21::Vector<int>(vector)};
+  s21::CowMap<int, int> cow_map{s21::Map<int, int>(map)};
+  const int stages = kStageRuns * kStages;
+  long long sums[4] = {};
+  auto start = Clock::now();
+  for (int run = 0; run < kStageRuns; ++run) {
+    sums[0] += VectorPipeline(vector, run);
+  }
+  Report("cow/Vector stage", stages, Clock::now() - start);
+  start = Clock::now();
+  for (int run = 0; run < kStageRuns; ++run) {
+    sums[1] += VectorPipeline(cow_vector, run);
+  }
+  Report("cow/CowVector stage", stages, Clock::now() - start);
+  start = Clock::now();
+  for (int run = 0; run < kStageRuns; ++run) {
+    sums[2] += MapPipeline(map, keys, run);
+  }
+  Report("cow/Map stage", stages, Clock::now() - start);
+  start = Clock::now();
+  for (int run = 0; run < kStageRuns; ++run) {
+    sums[3] += MapPipeline(cow_map, keys, run);
+  }
+  Report("cow/CowMap stage", stages, Clock::now() - start);
+  if (sums[0] != sums[1] || sums[2] != sums[3]) std::puts("  MISMATCH");
+}
+
+// FROZEN SET-------------------------------------------------------------------
+
+constexpr int kFrozenKeys = 1 << 20;
+constexpr int kFrozenLookups = 1 << 21;
+
+// Half of the probes hit; the table is larger than the last-level cache
+template <class Table>
+void FrozenLookups(const char* name, const Table& table,
+                   const std::vector<int>& probes) {
+  auto start = Clock::now();
+  long long found = 0;
+  for (int probe : probes) found += table.Contains(probe);
+  Report(name, probes.size(), Clock::now() - start);
+  if (found < kFrozenLookups / 4) std::puts("  MISMATCH");
+}
+
+// Binary search over a sorted array, the usual flat alternative
+struct SortedArray {
+  std::vector<int> values;
+  bool Contains(int value) const {
+    return std::binary_search(values.begin(), values.end(), value);
+  }
+};
+
+void BenchFrozenSet() {
+  std::vector<int> keys = RandomInts(kFrozenKeys);
+  s21::Set<int> set;
+  for (int key : keys) set.Insert(key);
+  s21::FrozenSet<int> frozen = set.Freeze();
+  SortedArray sorted{std::vector<int>(frozen.Begin(), frozen.End())};
+  std::vector<int> probes = RandomInts(kFrozenLookups);
+  for (int i = 0; i < kFrozenLookups; i += 2) {
+    probes[i] = keys[probes[i + 1] % kFrozenKeys];
+  }
+  FrozenLookups("frozen_set/Set", set, probes);
+  FrozenLookups("frozen_set/sorted array", sorted, probes);
+  FrozenLookups("frozen_set/FrozenSet", frozen, probes);
+}
+
+// BATCHED LOOKUP---------------------------------------------------------------
+
+constexpr int kBatchKeys = 1 << 20;
+constexpr int kBatchProbes = 1 << 21;
+constexpr int kBatchSize = 1024;
+
+// The same probes, half of them hits, looked up one at a time and then
+// kBatchSize at a time
+template <class Table>
+void BatchLookups(const char* name, const Table& table,
+                  const std::vector<int>& probes) {
+  char label[64];
+  auto start = Clock::now();
+  long long found = 0;
+  for (int probe : probes) found += table.Contains(probe);
+  std::snprintf(label, sizeof(label), "%s loop", name);
+  Report(label, probes.size(), Clock::now() - start);
+  std::vector<char> hits(kBatchSize);
+  start = Clock::now();
+  for (size_t i = 0; i < probes.size(); i += kBatchSize) {
+    table.ContainsBatch(probes.begin() + i, kBatchSize, hits.begin());
+    for (char hit : hits) found -= hit;
+  }
+  std::snprintf(label, sizeof(label), "%s batch", name);
+  Report(label, probes.size(), Clock::now() - start);
+  if (found != 0) std::puts("  MISMATCH");
+}
+
+void BenchBatchLookup() {
+  std::vector<int> keys = RandomInts(kBatchKeys);
+  s21::Set<int> set;
+  s21::Map<int, int> map;
+  s21::ConcurrentMap<int, int> concurrent;
+  s21::RcuMap<int, int> rcu;
+  for (int key : keys) {
+    set.Insert(key);
+    map.Insert(key, key);
+    concurrent.Insert(key, key);
+    rcu.InsertOrAssign(key, key);
+  }
+  rcu.Publish();
+  s21::FrozenSet<int> frozen = set.Freeze();
+  std::vector<int> probes = RandomInts(kBatchProbes);
+  for (int i = 0; i < kBatchProbes; i += 2) {
+    probes[i] = keys[probes[i + 1] % kBatchKeys];
+  }
+  BatchLookups("batch/Set", set, probes);
+  BatchLookups("batch/Map", map, probes);
+  BatchLookups("batch/ConcurrentMap", concurrent, probes);
+  BatchLookups("batch/FrozenSet", frozen, probes);
+  BatchLookups("batch/RcuMap", rcu, probes);
+}
+
+// BLOOM FILTER-----------------------------------------------------------------
+
+constexpr int kFilterKeys = 1 << 20;
+constexpr int kFilterLookups = 1 << 21;
+
+// Most probes miss, the mix a filter is for
+template <class Table>
+long long FilterLookups(const char* name, const Table& table,
+                        const std::vector<int>& probes) {
+  auto start = Clock::now();
+  long long found = 0;
+  for (int probe : probes) found += table.Contains(probe);
+  Report(name, probes.size(), Clock::now() - start);
+  return found;
+}
+
+void BenchBloomFilter() {
+  std::vector<int> keys = RandomInts(kFilterKeys);
+  s21::Set<int> set;
+  s21::FilteredSet<int> filtered_set;
+  s21::Map<int, int> map;
+  s21::FilteredMap<int, int> filtered_map;
+  for (int key : keys) {
+    set.Insert(key);
+    filtered_set.Insert(key);
+    map.Insert(key, key);
+    filtered_map.Insert(key, key);
+  }
+  // Values past the keys in the same sequence, few of them keys
+  std::vector<int> values = RandomInts(kFilterKeys + kFilterLookups);
+  std::vector<int> probes(values.begin() + kFilterKeys, values.end());
+  for (int i = 0; i < kFilterLookups; i += 20) {
+    probes[i] = keys[probes[i + 1] % kFilterKeys];
+  }
+  long long found = FilterLookups("bloom_filter/Set", set, probes);
+  if (FilterLookups("bloom_filter/FilteredSet", filtered_set, probes) !=
+      found) {
+    std::puts("  MISMATCH");
+  }
+  if (FilterLookups("bloom_filter/Map", map, probes) != found ||
+      FilterLookups("bloom_filter/FilteredMap", filtered_map, probes) !=
+          found) {
+    std::puts("  MISMATCH");
+  }
+  s21::FilterStats stats = filtered_set.Stats();
+  std::printf("  %zu misses filtered, %zu false positives, %zu rebuilds\n",
+              stats.misses, stats.false_positives, stats.rebuilds);
+}
+
+// TRANSPARENT LOOKUP-----------------------------------------------------------
+
+constexpr int kTransparentKeys = 1 << 8;
+constexpr int kTransparentLookups = 1 << 20;
+
+// Probes arrive as string_views into a request buffer, as from a parser.
+// Without a transparent comparator each lookup first copies its key into a
+// std::string, which for keys past the small string buffer allocates. The
+// table stays in cache, so the copy is a visible share of each lookup.
+void BenchTransparentLookup() {
+  std::vector<int> values = RandomInts(kTransparentKeys + kTransparentLookups);
+  std::vector<std::string> keys;
+  s21::Map<std::string, int> map;
+  s21::Map<std::string, int, std::less<>> transparent;
+  for (int i = 0; i < kTransparentKeys; ++i) {
+    keys.push_back("session/" + std::to_string(values[i]) + "/profile");
+    map.Insert(keys.back(), i);
+    transparent.Insert(keys.back(), i);
+  }
+  std::string buffer;
+  std::vector<std::pair<size_t, size_t>> spans;
+  for (int i = 0; i < kTransparentLookups; ++i) {
+    int value = values[kTransparentKeys + i];
+    std::string key = value % 2 ? keys[value % kTransparentKeys]
+                                : "session/" + std::to_string(value) + "/x";
+    spans.push_back({buffer.size(), key.size()});
+    buffer += key;
+  }
+  std::string_view text = buffer;
+  auto start = Clock::now();
+  long long found = 0;
+  for (const auto& span : spans) {
+    found += map.Contains(std::string(text.substr(span.first, span.second)));
+  }
+  Report("transparent/Map std::string key", spans.size(),
+         Clock::now() - start);
+  start = Clock::now();
+  for (const auto& span : spans) {
+    found -= transparent.Contains(text.substr(span.first, span.second));
+  }
+  Report("transparent/Map string_view key", spans.size(),
+         Clock::now() - start);
+  if (found != 0) std::puts("  MISMATCH");
+}
+
+struct Benchmark {
+  const char* name;
+  void (*run)();
+};
+
+const Benchmark kBenchmarks[] = {
+    {"spsc_throughput", BenchSpscThroughput},
+    {"spsc_batch_throughput", BenchSpscBatchThroughput},
+    {"spsc_latency", BenchSpscLatency},
+    {"mpmc_scaling", BenchMpmcScaling},
+    {"work_stealing_fib", BenchWorkStealingFib},
+    {"work_stealing_submit", BenchWorkStealingSubmit},
+    {"blocking_pipeline", BenchBlockingPipeline},
+    {"stack_load", BenchStackLoad},
+    {"priority_queue", BenchPriorityQueue},
+    {"dijkstra", BenchDijkstra},
+    {"timer_wheel", BenchTimerWheel},
+    {"list_traversal", BenchListTraversal},
+    {"cache", BenchCache},
+    {"concurrent_map", BenchConcurrentMap},
+    {"skip_list_map", BenchSkipListMap},
+    {"persistent_map", BenchPersistentMap},
+    {"rcu_map", BenchRcuMap},
+    {"copy_on_write", BenchCopyOnWrite},
+    {"frozen_set", BenchFrozenSet},
+    {"batch_lookup", BenchBatchLookup},
+    {"bloom_filter", BenchBloomFilter},
+    {"transparent_lookup", BenchTransparentLookup},
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  for (const Benchmark& benchmark : kBenchmarks) {
+    if (argc < 2 || std::strstr(benchmark.name, argv[1])) benchmark.run();
+  }
+  return 0;
+}
@@ -18,6 +18,9 @@ class List {
     Node(Args&&... args) : value_(std::forward<Args>(args)...){};
   };
 
+  // Declared ahead so that ListIterator befriends this nested class
+  class ListConstIterator;
+
   // Internal class ListIterator
   class ListIterator {
     friend class List;
@@ -63,6 +66,7 @@ class List {
     }
 
    private:
+    friend class ListConstIterator;
     Pointer it_ = nullptr;
   };
 
@@ -76,6 +80,7 @@ class List {
     using SizeType = size_t;
     ListConstIterator() = default;
     explicit ListConstIterator(Pointer obj) : it_(obj){};
+    ListConstIterator(const ListIterator& other) : it_(other.it_){};
 
     ListConstIterator& operator++() noexcept {
       it_ = it_->next_;
@@ -158,6 +163,15 @@ class List {
   void Swap(List& other);
   void Merge(List& other);
   void Splice(ConstIterator pos, List& other);
+  // Relinks the element it of other in front of pos, in O(1)
+  void Splice(ConstIterator pos, List& other, ConstIterator it);
+  // Relinks [first, last) of other in front of pos; pos must not be inside
+  // the range. Counting the range makes this O(n) when other is another list
+  void Splice(ConstIterator pos, List& other, ConstIterator first,
+              ConstIterator last);
+  // Same, with the length of the range supplied by the caller, in O(1)
+  void Splice(ConstIterator pos, List& other, ConstIterator first,
+              ConstIterator last, SizeType count);
   void Reverse();
   void Unique();
   void Sort();
@@ -173,6 +187,9 @@ class List {
   Pointer head_ = nullptr;
   Pointer tail_ = nullptr;
   SizeType size_{};
+
+  void Unlink(Pointer first, Pointer last);
+  void LinkBefore(Pointer pos, Pointer first, Pointer last);
 };
 
 template <class T>
@@ -406,6 +423,39 @@ void List<T>::Splice(ConstIterator pos, List& other) {
   }
 }
 
+template <class T>
+void List<T>::Splice(ConstIterator pos, List& other, ConstIterator it) {
+  if (it.it_ == nullptr) {
+    throw std::out_of_range("Iterator is NULL");
+  }
+  if (pos == it) return;
+  Splice(pos, other, it, ConstIterator(it.it_->next_), 1);
+}
+
+template <class T>
+void List<T>::Splice(ConstIterator pos, List& other, ConstIterator first,
+                     ConstIterator last) {
+  SizeType count = 0;
+  if (&other != this) {
+    for (ConstIterator it = first; it != last; ++it) ++count;
+  }
+  Splice(pos, other, first, last, count);
+}
+
+template <class T>
+void List<T>::Splice(ConstIterator pos, List& other, ConstIterator first,
+                     ConstIterator last, SizeType count) {
+  if (first == last) return;
+  Pointer first_node = first.it_;
+  Pointer last_node = last.it_ ? last.it_->prev_ : other.tail_;
+  other.Unlink(first_node, last_node);
+  LinkBefore(pos.it_, first_node, last_node);
+  if (&other != this) {
+    other.size_ -= count;
+    size_ += count;
+  }
+}
+
 template <class T>
 void List<T>::Unique() {
   if (Size() > 1) {
@@ -483,6 +533,40 @@ void List<T>::EmplaceFront(Args&&... args) {
   PushFront(std::forward<Args>(args)...);
 }
 
+// Detaches the nodes [first, last] from the list without touching size_
+template <class T>
+void List<T>::Unlink(Pointer first, Pointer last) {
+  if (first->prev_) {
+    first->prev_->next_ = last->next_;
+  } else {
+    head_ = last->next_;
+  }
+  if (last->next_) {
+    last->next_->prev_ = first->prev_;
+  } else {
+    tail_ = first->prev_;
+  }
+}
+
+// Attaches the chain [first, last] in front of pos, or at the back for a
+// null pos, without touching size_
+template <class T>
+void List<T>::LinkBefore(Pointer pos, Pointer first, Pointer last) {
+  Pointer prev = pos ? pos->prev_ : tail_;
+  first->prev_ = prev;
+  last->next_ = pos;
+  if (prev) {
+    prev->next_ = first;
+  } else {
+    head_ = first;
+  }
+  if (pos) {
+    pos->prev_ = last;
+  } else {
+    tail_ = last;
+  }
+}
+
 }  // namespace s21
 
 #endif  // SRC_CONTAINERS_S21_LIST_H_
@@ -1,9 +1,12 @@
 #ifndef SRC_CONTAINERS_S21_Map_H_
 #define SRC_CONTAINERS_S21_Map_H_
 
+#include <functional>
 #include <initializer_list>
 #include <limits>
 
+#include "../containers_extra/s21_frozen_map.h"
+#include "../containers_extra/s21_prefetch.h"
 #include "s21_queue.h"
 #include "s21_vector.h"
 
@@ -19,7 +22,8 @@ struct MapNode {
   MapNode(const Key& key, const T& obj) : node_pair(key, obj){};
 };
 
-template <class Key, class T>
+// Ordered by Compare, a strict weak ordering on Key; see Set
+template <class Key, class T, class Compare = std::less<Key>>
 class Map {
  public:
   class MapIterator;
@@ -36,6 +40,7 @@ class Map {
   using Pointer = Node*;
   using Iterator = MapIterator;
   using ConstIterator = MapConstIterator;
+  using KeyCompare = Compare;
   using Pair = std::pair<Iterator, bool>;
 
   // internal class MapIterator
@@ -60,7 +65,7 @@ class Map {
         }
       } else {
         Pointer tmp = current_->parent;
-        while (tmp && tmp->node_pair.first > current_->node_pair.first) {
+        while (tmp && current_ == tmp->left) {
           current_ = tmp;
           tmp = tmp->parent;
         }
@@ -77,7 +82,7 @@ class Map {
         }
       } else {
         Pointer tmp = current_->parent;
-        while (tmp && tmp->node_pair.first < current_->node_pair.first) {
+        while (tmp && current_ == tmp->right) {
           current_ = tmp;
           tmp = tmp->parent;
         }
@@ -90,6 +95,10 @@ class Map {
       return (current_ != other.current_);
     }
 
+    bool operator==(const MapIterator& other) const noexcept {
+      return (current_ == other.current_);
+    }
+
     ValueType* operator->() noexcept { return &(current_->node_pair); }
 
    private:
@@ -118,7 +127,7 @@ class Map {
         }
       } else {
         Pointer tmp = current_->parent;
-        while (tmp && tmp->node_pair.first > current_->node_pair.first) {
+        while (tmp && current_ == tmp->left) {
           current_ = tmp;
           tmp = tmp->parent;
         }
@@ -135,7 +144,7 @@ class Map {
         }
       } else {
         Pointer tmp = current_->parent;
-        while (tmp && tmp->node_pair.first < current_->node_pair.first) {
+        while (tmp && current_ == tmp->right) {
           current_ = tmp;
           tmp = tmp->parent;
         }
@@ -148,14 +157,21 @@ class Map {
       return (current_ != other.current_);
     }
 
-    ValueType* operator->() noexcept { return current_->node_pair; }
+    bool operator==(const MapConstIterator& other) const noexcept {
+      return (current_ == other.current_);
+    }
+
+    const ValueType* operator->() const noexcept {
+      return &(current_->node_pair);
+    }
 
    private:
-    const Pointer current_;
+    Pointer current_;
   };
 
   // Map Member functions
   Map() = default;
+  explicit Map(const Compare& comp) : comp_(comp) {}
   Map(std::initializer_list<ValueType> const& items);
   explicit Map(const Map& m);
   Map(Map&& m) noexcept;
@@ -164,16 +180,19 @@ class Map {
 
   // Map Element access
   T& At(const Key& key);
+  const T& At(const Key& key) const;
   T& operator[](const Key& key);
 
   // Map Iterators
   Iterator Begin();
   Iterator End();
+  ConstIterator Cbegin() const;
+  ConstIterator Cend() const;
 
   // Map Capacity
   bool Empty() const;
-  SizeType Size();
-  SizeType MaxSize();
+  SizeType Size() const;
+  SizeType MaxSize() const;
 
   // Map Modifiers
   void Clear();
@@ -185,15 +204,44 @@ class Map {
   void Merge(Map& other);
 
   // Map Lookup
-  bool Contains(const Key& key);
+  Iterator Find(const Key& key);
+  ConstIterator Find(const Key& key) const;
+  bool Contains(const Key& key) const;
+  // Lookups by any key Compare orders against Key, such as a string_view in
+  // a Map<std::string, T, std::less<>>, without building a Key. Only
+  // offered when Compare is transparent.
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  Iterator Find(const K& key) {
+    return Iterator(FindNode(key));
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  ConstIterator Find(const K& key) const {
+    return ConstIterator(FindNode(key));
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  bool Contains(const K& key) const {
+    return FindNode(key) != nullptr;
+  }
+  KeyCompare KeyComp() const { return comp_; }
+  // Batched Find and Contains: write an iterator, Cend if absent, or a bool
+  // to out for each of count keys read from keys. The searches descend in
+  // lockstep, kPrefetchGroup at a time, each prefetching its next node, so
+  // the cache misses of different keys overlap.
+  template <class ForwardIt, class OutputIt>
+  void FindBatch(ForwardIt keys, SizeType count, OutputIt out) const;
+  template <class ForwardIt, class OutputIt>
+  void ContainsBatch(ForwardIt keys, SizeType count, OutputIt out) const;
 
   // Bonus function
   template <typename... Args>
   Vector<Pair> Emplace(Args&&... args);
+  // Read-only copy laid out for fast lookups
+  FrozenMap<Key, T, Compare> Freeze() const;
 
  private:
   Pointer root_ = nullptr;
   SizeType size_{0};
+  Compare comp_;
 
   // Support functions
   void CopyTree(const Map& other);
@@ -203,41 +251,47 @@ class Map {
   void EraseRightBranch(
       Pointer tmp);             // delete element, that has only right branch
   void EraseNode(Pointer tmp);  // delete element, that has two children
-  Pair Search(const Key& key);
+  template <class K>
+  Pair Search(const K& key) const;
+  template <class K>
+  Pointer FindNode(const K& key) const;
+  static Pointer Successor(Pointer node);
+  template <class ForwardIt, class Emit>
+  void SearchBatch(ForwardIt keys, SizeType count, Emit emit) const;
 };
 
 // Constructors
-template <class Key, class T>
-Map<Key, T>::Map(std::initializer_list<ValueType> const& items) {
+template <class Key, class T, class Compare>
+Map<Key, T, Compare>::Map(std::initializer_list<ValueType> const& items) {
   for (auto it : items) {
     Insert(it);
   }
 }
 
-template <class Key, class T>
-Map<Key, T>::Map(const Map& m) {
+template <class Key, class T, class Compare>
+Map<Key, T, Compare>::Map(const Map& m) : comp_(m.comp_) {
   CopyTree(m);
 }
 
-template <class Key, class T>
-Map<Key, T>::Map(Map&& m) noexcept {
+template <class Key, class T, class Compare>
+Map<Key, T, Compare>::Map(Map&& m) noexcept {
   Swap(m);
 }
 
-template <class Key, class T>
-Map<Key, T>::~Map() {
+template <class Key, class T, class Compare>
+Map<Key, T, Compare>::~Map() {
   Clear();
 }
 
-template <class Key, class T>
-Map<Key, T>& Map<Key, T>::operator=(Map&& m) noexcept {
+template <class Key, class T, class Compare>
+Map<Key, T, Compare>& Map<Key, T, Compare>::operator=(Map&& m) noexcept {
   Clear();
   Swap(m);
   return *this;
 }
 
-template <class Key, class T>
-T& Map<Key, T>::At(const Key& key) {
+template <class Key, class T, class Compare>
+T& Map<Key, T, Compare>::At(const Key& key) {
   Pair res = Search(key);
   if (!res.second) {
     throw std::out_of_range("This element is not exists");
@@ -245,8 +299,17 @@ T& Map<Key, T>::At(const Key& key) {
   return res.first->second;
 }
 
-template <class Key, class T>
-T& Map<Key, T>::operator[](const Key& key) {
+template <class Key, class T, class Compare>
+const T& Map<Key, T, Compare>::At(const Key& key) const {
+  Pair res = Search(key);
+  if (!res.second) {
+    throw std::out_of_range("This element is not exists");
+  }
+  return res.first->second;
+}
+
+template <class Key, class T, class Compare>
+T& Map<Key, T, Compare>::operator[](const Key& key) {
   Pair res = Search(key);
   if (!res.second) {
     auto tmp = Insert(key, T());
@@ -256,8 +319,8 @@ T& Map<Key, T>::operator[](const Key& key) {
 }
 
 // Map Iterators
-template <class Key, class T>
-typename Map<Key, T>::Iterator Map<Key, T>::Begin() {
+template <class Key, class T, class Compare>
+typename Map<Key, T, Compare>::Iterator Map<Key, T, Compare>::Begin() {
   if (!root_) {
     return Iterator();
   } else {
@@ -269,30 +332,46 @@ typename Map<Key, T>::Iterator Map<Key, T>::Begin() {
   }
 }
 
-template <class Key, class T>
-typename Map<Key, T>::Iterator Map<Key, T>::End() {
+template <class Key, class T, class Compare>
+typename Map<Key, T, Compare>::Iterator Map<Key, T, Compare>::End() {
   return Iterator();
 }
 
+template <class Key, class T, class Compare>
+typename Map<Key, T, Compare>::ConstIterator Map<Key, T, Compare>::Cbegin()
+    const {
+  Pointer begin = root_;
+  while (begin && begin->left) {
+    begin = begin->left;
+  }
+  return ConstIterator(begin);
+}
+
+template <class Key, class T, class Compare>
+typename Map<Key, T, Compare>::ConstIterator Map<Key, T, Compare>::Cend()
+    const {
+  return ConstIterator();
+}
+
 // Map Capacity
-template <class Key, class T>
-bool Map<Key, T>::Empty() const {
+template <class Key, class T, class Compare>
+bool Map<Key, T, Compare>::Empty() const {
   return root_ == nullptr;
 }
 
-template <class Key, class T>
-typename Map<Key, T>::SizeType Map<Key, T>::Size() {
+template <class Key, class T, class Compare>
+typename Map<Key, T, Compare>::SizeType Map<Key, T, Compare>::Size() const {
   return size_;
 }
 
-template <class Key, class T>
-typename Map<Key, T>::SizeType Map<Key, T>::MaxSize() {
+template <class Key, class T, class Compare>
+typename Map<Key, T, Compare>::SizeType Map<Key, T, Compare>::MaxSize() const {
   return std::numeric_limits<SizeType>::max() / sizeof(Node);
 }
 
 // Map Modifiers
-template <class Key, class T>
-void Map<Key, T>::Clear() {
+template <class Key, class T, class Compare>
+void Map<Key, T, Compare>::Clear() {
   for (Iterator i = Begin(); i != End();) {
     Iterator tmp = i;
     ++i;
@@ -300,9 +379,9 @@ void Map<Key, T>::Clear() {
   }
 }
 
-template <class Key, class T>
-std::pair<typename Map<Key, T>::Iterator, bool> Map<Key, T>::Insert(
-    const ValueType& value) {
+template <class Key, class T, class Compare>
+std::pair<typename Map<Key, T, Compare>::Iterator, bool>
+Map<Key, T, Compare>::Insert(const ValueType& value) {
   Pointer tmp = new Node(value);
   if (!root_) {  // if set is empty
     root_ = tmp;
@@ -313,7 +392,7 @@ std::pair<typename Map<Key, T>::Iterator, bool> Map<Key, T>::Insert(
       return std::make_pair(Iterator(root_), false);
     } else {
       tmp->parent = top.first.current_;
-      if (top.first->first > value.first) {
+      if (comp_(value.first, top.first->first)) {
         top.first.current_->left = tmp;
       } else {
         top.first.current_->right = tmp;
@@ -324,15 +403,15 @@ std::pair<typename Map<Key, T>::Iterator, bool> Map<Key, T>::Insert(
   return std::make_pair(Iterator(tmp), true);
 }
 
-template <class Key, class T>
-std::pair<typename Map<Key, T>::Iterator, bool> Map<Key, T>::Insert(
-    const Key& key, const T& obj) {
+template <class Key, class T, class Compare>
+std::pair<typename Map<Key, T, Compare>::Iterator, bool>
+Map<Key, T, Compare>::Insert(const Key& key, const T& obj) {
   return Insert(std::make_pair(key, obj));
 }
 
-template <class Key, class T>
-std::pair<typename Map<Key, T>::Iterator, bool> Map<Key, T>::InsertOrAssign(
-    const Key& key, const T& obj) {
+template <class Key, class T, class Compare>
+std::pair<typename Map<Key, T, Compare>::Iterator, bool>
+Map<Key, T, Compare>::InsertOrAssign(const Key& key, const T& obj) {
   Pair res = Search(key);
   if (!res.second) {
     return Insert(key, obj);
@@ -342,8 +421,8 @@ std::pair<typename Map<Key, T>::Iterator, bool> Map<Key, T>::InsertOrAssign(
   }
 }
 
-template <class Key, class T>
-void Map<Key, T>::Erase(Iterator pos) {
+template <class Key, class T, class Compare>
+void Map<Key, T, Compare>::Erase(Iterator pos) {
   Pointer tmp = pos.current_;
   if (tmp) {
     if (!tmp->left && !tmp->right) {
@@ -360,32 +439,65 @@ void Map<Key, T>::Erase(Iterator pos) {
   }
 }
 
-template <class Key, class T>
-void Map<Key, T>::Swap(Map& other) {
+template <class Key, class T, class Compare>
+void Map<Key, T, Compare>::Swap(Map& other) {
   if (this != &other) {
     std::swap(root_, other.root_);
     std::swap(size_, other.size_);
+    std::swap(comp_, other.comp_);
   }
 }
 
-template <class Key, class T>
-void Map<Key, T>::Merge(Map& other) {
+template <class Key, class T, class Compare>
+void Map<Key, T, Compare>::Merge(Map& other) {
   for (Iterator i = other.Begin(); i != other.End(); ++i) {
     Insert(i.current_->node_pair);
   }
 }
 
 // Map Lookup
-template <class Key, class T>
-bool Map<Key, T>::Contains(const Key& key) {
-  Pair res = Search(key);
-  return res.second;
+template <class Key, class T, class Compare>
+typename Map<Key, T, Compare>::Iterator Map<Key, T, Compare>::Find(
+    const Key& key) {
+  return Iterator(FindNode(key));
+}
+
+template <class Key, class T, class Compare>
+typename Map<Key, T, Compare>::ConstIterator Map<Key, T, Compare>::Find(
+    const Key& key) const {
+  return ConstIterator(FindNode(key));
+}
+
+template <class Key, class T, class Compare>
+bool Map<Key, T, Compare>::Contains(const Key& key) const {
+  return FindNode(key) != nullptr;
+}
+
+template <class Key, class T, class Compare>
+template <class ForwardIt, class OutputIt>
+void Map<Key, T, Compare>::FindBatch(ForwardIt keys, SizeType count,
+                                     OutputIt out) const {
+  SearchBatch(keys, count, [&out](Pointer node) {
+    *out = ConstIterator(node);
+    ++out;
+  });
+}
+
+template <class Key, class T, class Compare>
+template <class ForwardIt, class OutputIt>
+void Map<Key, T, Compare>::ContainsBatch(ForwardIt keys, SizeType count,
+                                         OutputIt out) const {
+  SearchBatch(keys, count, [&out](Pointer node) {
+    *out = node != nullptr;
+    ++out;
+  });
 }
 
 // Bonus Function
-template <class Key, class T>
+template <class Key, class T, class Compare>
 template <typename... Args>
-Vector<typename Map<Key, T>::Pair> Map<Key, T>::Emplace(Args&&... args) {
+Vector<typename Map<Key, T, Compare>::Pair> Map<Key, T, Compare>::Emplace(
+    Args&&... args) {
   std::initializer_list<ValueType> items{args...};
   Vector<Pair> res;
 
@@ -395,9 +507,19 @@ Vector<typename Map<Key, T>::Pair> Map<Key, T>::Emplace(Args&&... args) {
   return res;
 }
 
+template <class Key, class T, class Compare>
+FrozenMap<Key, T, Compare> Map<Key, T, Compare>::Freeze() const {
+  Vector<std::pair<Key, T>> sorted;
+  sorted.Reserve(size_);
+  for (ConstIterator it = Cbegin(); it != Cend(); ++it) {
+    sorted.PushBack({it->first, it->second});
+  }
+  return FrozenMap<Key, T, Compare>(std::move(sorted), comp_);
+}
+
 // Other functions
-template <class Key, class T>
-void Map<Key, T>::CopyTree(const Map& other) {
+template <class Key, class T, class Compare>
+void Map<Key, T, Compare>::CopyTree(const Map& other) {
   if (other.root_) {
     s21::Queue<Pointer> tmp;
     tmp.Push(other.root_);
@@ -414,61 +536,61 @@ void Map<Key, T>::CopyTree(const Map& other) {
   }
 }
 
-template <class Key, class T>
-void Map<Key, T>::EraseList(Pointer tmp) {
+template <class Key, class T, class Compare>
+void Map<Key, T, Compare>::EraseList(Pointer tmp) {
   if (size_ == 1)
     root_ = nullptr;
   else {
-    if (tmp->parent->node_pair.first > tmp->node_pair.first)
+    if (tmp->parent->left == tmp)
       tmp->parent->left = nullptr;
     else
       tmp->parent->right = nullptr;
   }
 }
 
-template <class Key, class T>
-void Map<Key, T>::EraseLeftBranch(Pointer tmp) {
+template <class Key, class T, class Compare>
+void Map<Key, T, Compare>::EraseLeftBranch(Pointer tmp) {
   if (tmp == root_) {
     root_ = tmp->left;
     root_->parent = nullptr;
   } else {
     tmp->left->parent = tmp->parent;
-    if (tmp->parent->node_pair.first > tmp->node_pair.first)
+    if (tmp->parent->left == tmp)
       tmp->parent->left = tmp->left;
     else
       tmp->parent->right = tmp->left;
   }
 }
 
-template <class Key, class T>
-void Map<Key, T>::EraseRightBranch(Pointer tmp) {
+template <class Key, class T, class Compare>
+void Map<Key, T, Compare>::EraseRightBranch(Pointer tmp) {
   if (tmp == root_) {
     root_ = tmp->right;
     root_->parent = nullptr;
   } else {
     tmp->right->parent = tmp->parent;
-    if (tmp->parent->node_pair.first > tmp->node_pair.first)
+    if (tmp->parent->left == tmp)
       tmp->parent->left = tmp->right;
     else
       tmp->parent->right = tmp->right;
   }
 }
 
-template <class Key, class T>
-void Map<Key, T>::EraseNode(Pointer tmp) {
+template <class Key, class T, class Compare>
+void Map<Key, T, Compare>::EraseNode(Pointer tmp) {
   Iterator it(tmp);
   --it;
   Iterator p(it.current_->parent);
 
   if (it.current_->left) {
-    if (it->first > p->first) {
+    if (p.current_->right == it.current_) {
       p.current_->right = it.current_->left;
     } else {
       p.current_->left = it.current_->left;
     }
     it.current_->left->parent = p.current_;
   } else {
-    if (it->first > p->first)
+    if (p.current_->right == it.current_)
       p.current_->right = nullptr;
     else
       p.current_->left = nullptr;
@@ -483,7 +605,7 @@ void Map<Key, T>::EraseNode(Pointer tmp) {
   if (tmp == root_)
     root_ = it.current_;
   else {
-    if (it->first > tmp->parent->node_pair.first) {
+    if (tmp->parent->right == tmp) {
       tmp->parent->right = it.current_;
     } else {
       tmp->parent->left = it.current_;
@@ -491,22 +613,84 @@ void Map<Key, T>::EraseNode(Pointer tmp) {
   }
 }
 
-template <class Key, class T>
-std::pair<typename Map<Key, T>::Iterator, bool> Map<Key, T>::Search(
-    const Key& key) {
+// The node after node in order, for a node without a right child: the
+// first ancestor it lies to the left of
+template <class Key, class T, class Compare>
+typename Map<Key, T, Compare>::Pointer Map<Key, T, Compare>::Successor(
+    Pointer node) {
+  while (node->parent && node == node->parent->right) node = node->parent;
+  return node->parent;
+}
+
+// One comparison per level, as in Set::Search
+template <class Key, class T, class Compare>
+template <class K>
+std::pair<typename Map<Key, T, Compare>::Iterator, bool>
+Map<Key, T, Compare>::Search(const K& key) const {
   Pointer it = root_, top = it;
+  bool less = false;
   while (it) {
     top = it;
-    if (it->node_pair.first == key) {
-      return std::make_pair(Iterator(top), true);
-    } else if (it->node_pair.first > key) {
-      it = it->left;
-    } else {
-      it = it->right;
-    }
+    less = comp_(it->node_pair.first, key);
+    it = less ? it->right : it->left;
+  }
+  Pointer candidate = less ? Successor(top) : top;
+  if (candidate && !comp_(key, candidate->node_pair.first)) {
+    return std::make_pair(Iterator(candidate), true);
   }
   return std::make_pair(Iterator(top), false);
 }
+
+template <class Key, class T, class Compare>
+template <class K>
+typename Map<Key, T, Compare>::Pointer Map<Key, T, Compare>::FindNode(
+    const K& key) const {
+  Pair res = Search(key);
+  return res.second ? res.first.current_ : nullptr;
+}
+
+// Search for kPrefetchGroup keys at a time, one level of each per round,
+// each down to a leaf as in Search. emit gets the node of each key, nullptr
+// if it is absent.
+template <class Key, class T, class Compare>
+template <class ForwardIt, class Emit>
+void Map<Key, T, Compare>::SearchBatch(ForwardIt keys, SizeType count,
+                                       Emit emit) const {
+  const Key* key[kPrefetchGroup];
+  Pointer node[kPrefetchGroup];
+  Pointer candidate[kPrefetchGroup];
+  while (count) {
+    SizeType group = count < kPrefetchGroup ? count : kPrefetchGroup;
+    for (SizeType i = 0; i < group; ++i, ++keys) {
+      key[i] = &*keys;
+      node[i] = root_;
+      candidate[i] = nullptr;
+    }
+    for (bool pending = root_ != nullptr; pending;) {
+      pending = false;
+      for (SizeType i = 0; i < group; ++i) {
+        if (!node[i]) continue;
+        if (comp_(node[i]->node_pair.first, *key[i])) {
+          node[i] = node[i]->right;
+        } else {
+          candidate[i] = node[i];
+          node[i] = node[i]->left;
+        }
+        if (node[i]) {
+          Prefetch(node[i]);
+          pending = true;
+        }
+      }
+    }
+    for (SizeType i = 0; i < group; ++i) {
+      bool found =
+          candidate[i] && !comp_(*key[i], candidate[i]->node_pair.first);
+      emit(found ? candidate[i] : nullptr);
+    }
+    count -= group;
+  }
+}
+
 }  // namespace s21
 
 #endif  // SRC_CONTAINERS_S21_Map_H_
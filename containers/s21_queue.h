@@ -1,6 +1,10 @@
 #ifndef SRC_CONTAINERS_S21_QUEUE_H_
 #define SRC_CONTAINERS_S21_QUEUE_H_
 
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
 #include "s21_list.h"
 
 namespace s21 {
@@ -32,9 +36,19 @@ class Queue {
   // Queue Capacity
   bool Empty() const { return container_.Empty(); }
   SizeType Size() const { return container_.Size(); }
+  // Available when Container has them
+  template <class C = Container>
+  auto Reserve(SizeType n) -> decltype(std::declval<C &>().Reserve(n)) {
+    container_.Reserve(n);
+  }
+  template <class C = Container>
+  auto ShrinkToFit() -> decltype(std::declval<C &>().ShrinkToFit()) {
+    container_.ShrinkToFit();
+  }
 
   //  Queue Modifiers
   void Push(ConstReference value) { container_.PushBack(value); }
+  void Push(ValueType &&value) { container_.PushBack(std::move(value)); }
   void Pop() { container_.PopFront(); }
   void Swap(Queue &other) { container_.Swap(other.container_); }
 
@@ -43,8 +57,45 @@ class Queue {
     container_.EmplaceBack(std::forward<Args>(args)...);
   }
 
+  // Pushes [first, last) in order. For forward iterators a container with
+  // Reserve grows once for the whole range.
+  template <class InputIt>
+  void PushRange(InputIt first, InputIt last) {
+    using Category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of<std::forward_iterator_tag, Category>::value) {
+      auto count = static_cast<SizeType>(std::distance(first, last));
+      TryReserve(container_, container_.Size() + count, 0);
+    }
+    for (; first != last; ++first) container_.PushBack(*first);
+  }
+
+  // Pops up to n elements and appends them to out with PushBack, front
+  // first; returns the number of elements popped
+  template <class OutContainer>
+  SizeType PopN(SizeType n, OutContainer &out) {
+    if (n > container_.Size()) n = container_.Size();
+    TryReserve(out, out.Size() + n, 0);
+    for (SizeType i = 0; i < n; ++i) {
+      out.PushBack(container_.Front());
+      container_.PopFront();
+    }
+    return n;
+  }
+
  private:
   Container container_;
+
+  // Support functions
+  // Grows c to hold n elements, at least doubling it as PushBack would, so
+  // that many small batches stay amortized O(1) per element
+  template <class C>
+  static auto TryReserve(C &c, SizeType n, int)
+      -> decltype(c.Reserve(n), c.Capacity(), void()) {
+    if (n <= c.Capacity()) return;
+    c.Reserve(n > 2 * c.Capacity() ? n : 2 * c.Capacity());
+  }
+  template <class C>
+  static void TryReserve(C &, SizeType, long) {}
 };
 
 }  // namespace s21
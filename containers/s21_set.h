@@ -1,11 +1,14 @@
 #ifndef SRC_CONTAINERS_S21_SET_H_
 #define SRC_CONTAINERS_S21_SET_H_
 
+#include <functional>
 #include <initializer_list>
 #include <iterator>
 #include <limits>
 
+#include "../containers_extra/s21_frozen_set.h"
 #include "../containers_extra/s21_multiset.h"
+#include "../containers_extra/s21_prefetch.h"
 #include "s21_map.h"
 #include "s21_queue.h"
 #include "s21_vector.h"
@@ -21,7 +24,9 @@ struct SetNode {
   explicit SetNode(const T& v) : value(v) {}
 };
 
-template <class T>
+// Ordered by Compare, a strict weak ordering on T: two elements are
+// equivalent when neither is less than the other
+template <class T, class Compare = std::less<T>>
 class Set {
  public:
   class SetIterator;
@@ -37,6 +42,7 @@ class Set {
   using Iterator = SetIterator;
   using ConstIterator = SetConstIterator;
   using Pair = std::pair<Iterator, bool>;
+  using KeyCompare = Compare;
 
   // internal class SetIterator
   class SetIterator {
@@ -60,7 +66,7 @@ class Set {
         }
       } else {
         Pointer tmp = current_->parent;
-        while (tmp && tmp->value > current_->value) {
+        while (tmp && current_ == tmp->left) {
           current_ = tmp;
           tmp = tmp->parent;
         }
@@ -77,7 +83,7 @@ class Set {
         }
       } else {
         Pointer tmp = current_->parent;
-        while (tmp && tmp->value < current_->value) {
+        while (tmp && current_ == tmp->right) {
           current_ = tmp;
           tmp = tmp->parent;
         }
@@ -120,7 +126,7 @@ class Set {
         }
       } else {
         Pointer tmp = current_->parent;
-        while (tmp && tmp->value > current_->value) {
+        while (tmp && current_ == tmp->left) {
           current_ = tmp;
           tmp = tmp->parent;
         }
@@ -137,7 +143,7 @@ class Set {
         }
       } else {
         Pointer tmp = current_->parent;
-        while (tmp && tmp->value < current_->value) {
+        while (tmp && current_ == tmp->right) {
           current_ = tmp;
           tmp = tmp->parent;
         }
@@ -150,14 +156,19 @@ class Set {
       return (current_ != other.current_);
     }
 
-    ConstReference operator*() noexcept { return current_->value; }
+    bool operator==(const SetConstIterator& other) const noexcept {
+      return (current_ == other.current_);
+    }
+
+    ConstReference operator*() const noexcept { return current_->value; }
 
    private:
-    const Pointer current_;
+    Pointer current_;
   };
 
   // Set Member functions
   Set() = default;
+  explicit Set(const Compare& comp) : comp_(comp) {}
   Set(std::initializer_list<ValueType> const& items);
   Set(const Set& s);
   Set(Set&& s) noexcept;
@@ -167,11 +178,13 @@ class Set {
   // Set Iterators
   Iterator Begin();
   Iterator End();
+  ConstIterator Cbegin() const;
+  ConstIterator Cend() const;
 
   // Set Capacity
-  bool Empty();
-  SizeType Size();
-  SizeType MaxSize();
+  bool Empty() const;
+  SizeType Size() const;
+  SizeType MaxSize() const;
 
   // Set Modifiers
   void Clear();
@@ -182,15 +195,43 @@ class Set {
 
   // Set Lookup
   Iterator Find(ConstReference v);
-  bool Contains(ConstReference v);
+  ConstIterator Find(ConstReference v) const;
+  bool Contains(ConstReference v) const;
+  // Lookups by any key Compare orders against T, such as a string_view in a
+  // Set<std::string, std::less<>>, without building a T. Only offered when
+  // Compare is transparent.
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  Iterator Find(const K& key) {
+    return Iterator(FindNode(key));
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  ConstIterator Find(const K& key) const {
+    return ConstIterator(FindNode(key));
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  bool Contains(const K& key) const {
+    return FindNode(key) != nullptr;
+  }
+  KeyCompare KeyComp() const { return comp_; }
+  // Batched Find and Contains: write an iterator, Cend if absent, or a bool
+  // to out for each of count keys read from keys. The searches descend in
+  // lockstep, kPrefetchGroup at a time, each prefetching its next node, so
+  // the cache misses of different keys overlap.
+  template <class ForwardIt, class OutputIt>
+  void FindBatch(ForwardIt keys, SizeType count, OutputIt out) const;
+  template <class ForwardIt, class OutputIt>
+  void ContainsBatch(ForwardIt keys, SizeType count, OutputIt out) const;
 
   // Bonus Function
   template <typename... Args>
   Vector<Pair> Emplace(Args&&... args);
+  // Read-only copy laid out for fast lookups
+  FrozenSet<T, Compare> Freeze() const;
 
  private:
   Pointer root_ = nullptr;
   SizeType size_{0};
+  Compare comp_;
 
   // Support functions
   void CopyTree(const Set& other);
@@ -198,42 +239,48 @@ class Set {
   void EraseLeftBranch(Pointer tmp);
   void EraseRightBranch(Pointer tmp);
   void EraseNode(Pointer tmp);
-  std::pair<Iterator, bool> Search(ConstReference v);
+  template <class K>
+  std::pair<Iterator, bool> Search(const K& key) const;
+  template <class K>
+  Pointer FindNode(const K& key) const;
+  static Pointer Successor(Pointer node);
+  template <class ForwardIt, class Emit>
+  void SearchBatch(ForwardIt keys, SizeType count, Emit emit) const;
 };
 
 // Set Member functions
-template <class T>
-Set<T>::Set(std::initializer_list<ValueType> const& items) {
+template <class T, class Compare>
+Set<T, Compare>::Set(std::initializer_list<ValueType> const& items) {
   for (auto it : items) {
     Insert(it);
   }
 }
 
-template <class T>
-Set<T>::Set(const Set& s) {
+template <class T, class Compare>
+Set<T, Compare>::Set(const Set& s) : comp_(s.comp_) {
   CopyTree(s);
 }
 
-template <class T>
-Set<T>::Set(Set&& s) noexcept {
+template <class T, class Compare>
+Set<T, Compare>::Set(Set&& s) noexcept {
   Swap(s);
 }
 
-template <class T>
-Set<T>::~Set() {
+template <class T, class Compare>
+Set<T, Compare>::~Set() {
   Clear();
 }
 
-template <class T>
-Set<T>& Set<T>::operator=(Set&& s) noexcept {
+template <class T, class Compare>
+Set<T, Compare>& Set<T, Compare>::operator=(Set&& s) noexcept {
   Clear();
   Swap(s);
   return *this;
 }
 
 // Set Iterators
-template <class T>
-typename Set<T>::Iterator Set<T>::Begin() {
+template <class T, class Compare>
+typename Set<T, Compare>::Iterator Set<T, Compare>::Begin() {
   if (!root_) {
     return Iterator();
   } else {
@@ -245,30 +292,44 @@ typename Set<T>::Iterator Set<T>::Begin() {
   }
 }
 
-template <class T>
-typename Set<T>::Iterator Set<T>::End() {
+template <class T, class Compare>
+typename Set<T, Compare>::Iterator Set<T, Compare>::End() {
   return Iterator();
 }
 
+template <class T, class Compare>
+typename Set<T, Compare>::ConstIterator Set<T, Compare>::Cbegin() const {
+  Pointer begin = root_;
+  while (begin && begin->left) {
+    begin = begin->left;
+  }
+  return ConstIterator(begin);
+}
+
+template <class T, class Compare>
+typename Set<T, Compare>::ConstIterator Set<T, Compare>::Cend() const {
+  return ConstIterator();
+}
+
 // Set Capacity
-template <class T>
-bool Set<T>::Empty() {
+template <class T, class Compare>
+bool Set<T, Compare>::Empty() const {
   return root_ == nullptr;
 }
 
-template <class T>
-typename Set<T>::SizeType Set<T>::Size() {
+template <class T, class Compare>
+typename Set<T, Compare>::SizeType Set<T, Compare>::Size() const {
   return size_;
 }
 
-template <class T>
-typename Set<T>::SizeType Set<T>::MaxSize() {
+template <class T, class Compare>
+typename Set<T, Compare>::SizeType Set<T, Compare>::MaxSize() const {
   return std::numeric_limits<SizeType>::max() / sizeof(Node);
 }
 
 // Set Modifiers
-template <class T>
-void Set<T>::Clear() {
+template <class T, class Compare>
+void Set<T, Compare>::Clear() {
   for (Iterator i = Begin(); i != End();) {
     Iterator tmp = i;
     ++i;
@@ -276,8 +337,8 @@ void Set<T>::Clear() {
   }
 }
 
-template <class T>
-std::pair<typename Set<T>::Iterator, bool> Set<T>::Insert(
+template <class T, class Compare>
+std::pair<typename Set<T, Compare>::Iterator, bool> Set<T, Compare>::Insert(
     ConstReference value) {
   Pointer tmp = new Node(value);
   if (!root_) {  // if set is empty
@@ -289,7 +350,7 @@ std::pair<typename Set<T>::Iterator, bool> Set<T>::Insert(
       return std::make_pair(Iterator(root_), false);
     } else {
       tmp->parent = top.first.current_;
-      if (*(top.first) > value) {
+      if (comp_(value, *(top.first))) {
         top.first->left = tmp;
       } else {
         top.first->right = tmp;
@@ -300,8 +361,8 @@ std::pair<typename Set<T>::Iterator, bool> Set<T>::Insert(
   return std::make_pair(Iterator(tmp), true);
 }
 
-template <class T>
-void Set<T>::Erase(Iterator pos) {
+template <class T, class Compare>
+void Set<T, Compare>::Erase(Iterator pos) {
   Pointer tmp = pos.current_;
   if (tmp) {
     if (!tmp->left && !tmp->right) {
@@ -318,38 +379,63 @@ void Set<T>::Erase(Iterator pos) {
   }
 }
 
-template <class T>
-void Set<T>::Swap(Set& other) {
+template <class T, class Compare>
+void Set<T, Compare>::Swap(Set& other) {
   if (this != &other) {
     std::swap(size_, other.size_);
     std::swap(root_, other.root_);
+    std::swap(comp_, other.comp_);
   }
 }
 
-template <class T>
-void Set<T>::Merge(Set& other) {
+template <class T, class Compare>
+void Set<T, Compare>::Merge(Set& other) {
   for (Iterator i = other.Begin(); i != other.End(); ++i) {
     Insert(*i);
   }
 }
 
-template <class T>
-typename Set<T>::Iterator Set<T>::Find(ConstReference v) {
-  Pair res = Search(v);
-  if (res.second) return res.first;
-  return Iterator();
+template <class T, class Compare>
+typename Set<T, Compare>::Iterator Set<T, Compare>::Find(ConstReference v) {
+  return Iterator(FindNode(v));
 }
 
-template <class T>
-bool Set<T>::Contains(ConstReference v) {
-  Pair res = Search(v);
-  return res.second;
+template <class T, class Compare>
+typename Set<T, Compare>::ConstIterator Set<T, Compare>::Find(
+    ConstReference v) const {
+  return ConstIterator(FindNode(v));
+}
+
+template <class T, class Compare>
+bool Set<T, Compare>::Contains(ConstReference v) const {
+  return FindNode(v) != nullptr;
+}
+
+template <class T, class Compare>
+template <class ForwardIt, class OutputIt>
+void Set<T, Compare>::FindBatch(ForwardIt keys, SizeType count,
+                                OutputIt out) const {
+  SearchBatch(keys, count, [&out](Pointer node) {
+    *out = ConstIterator(node);
+    ++out;
+  });
+}
+
+template <class T, class Compare>
+template <class ForwardIt, class OutputIt>
+void Set<T, Compare>::ContainsBatch(ForwardIt keys, SizeType count,
+                                    OutputIt out) const {
+  SearchBatch(keys, count, [&out](Pointer node) {
+    *out = node != nullptr;
+    ++out;
+  });
 }
 
 // Bonus Function
-template <class T>
+template <class T, class Compare>
 template <typename... Args>
-Vector<typename Set<T>::Pair> Set<T>::Emplace(Args&&... args) {
+Vector<typename Set<T, Compare>::Pair> Set<T, Compare>::Emplace(
+    Args&&... args) {
   std::initializer_list<ValueType> items{args...};
   Vector<Pair> res;
   for (auto it = items.begin(); it != items.end(); ++it) {
@@ -358,9 +444,17 @@ Vector<typename Set<T>::Pair> Set<T>::Emplace(Args&&... args) {
   return res;
 }
 
+template <class T, class Compare>
+FrozenSet<T, Compare> Set<T, Compare>::Freeze() const {
+  Vector<T> sorted;
+  sorted.Reserve(size_);
+  for (ConstIterator it = Cbegin(); it != Cend(); ++it) sorted.PushBack(*it);
+  return FrozenSet<T, Compare>(std::move(sorted), comp_);
+}
+
 // Support functions
-template <class T>
-void Set<T>::CopyTree(const Set& other) {
+template <class T, class Compare>
+void Set<T, Compare>::CopyTree(const Set& other) {
   if (other.root_) {
     s21::Queue<Pointer> tmp;
     tmp.Push(other.root_);
@@ -377,61 +471,61 @@ void Set<T>::CopyTree(const Set& other) {
   }
 }
 
-template <class T>
-void Set<T>::EraseList(Pointer tmp) {
+template <class T, class Compare>
+void Set<T, Compare>::EraseList(Pointer tmp) {
   if (size_ == 1)
     root_ = nullptr;
   else {
-    if (tmp->parent->value > tmp->value)
+    if (tmp->parent->left == tmp)
       tmp->parent->left = nullptr;
     else
       tmp->parent->right = nullptr;
   }
 }
 
-template <class T>
-void Set<T>::EraseLeftBranch(Pointer tmp) {
+template <class T, class Compare>
+void Set<T, Compare>::EraseLeftBranch(Pointer tmp) {
   if (tmp == root_) {
     root_ = tmp->left;
     root_->parent = nullptr;
   } else {
     tmp->left->parent = tmp->parent;
-    if (tmp->parent->value > tmp->value)
+    if (tmp->parent->left == tmp)
       tmp->parent->left = tmp->left;
     else
       tmp->parent->right = tmp->left;
   }
 }
 
-template <class T>
-void Set<T>::EraseRightBranch(Pointer tmp) {
+template <class T, class Compare>
+void Set<T, Compare>::EraseRightBranch(Pointer tmp) {
   if (tmp == root_) {
     root_ = tmp->right;
     root_->parent = nullptr;
   } else {
     tmp->right->parent = tmp->parent;
-    if (tmp->parent->value > tmp->value)
+    if (tmp->parent->left == tmp)
       tmp->parent->left = tmp->right;
     else
       tmp->parent->right = tmp->right;
   }
 }
 
-template <class T>
-void Set<T>::EraseNode(Pointer tmp) {
+template <class T, class Compare>
+void Set<T, Compare>::EraseNode(Pointer tmp) {
   Iterator it(tmp);
   --it;
   Iterator p(it->parent);
 
   if (it->left) {
-    if (*it > *p) {
+    if (p.current_->right == it.current_) {
       p->right = it->left;
     } else {
       p->left = it->left;
     }
     it->left->parent = p.current_;
   } else {
-    if (*it > *p)
+    if (p.current_->right == it.current_)
       p->right = nullptr;
     else
       p->left = nullptr;
@@ -446,7 +540,7 @@ void Set<T>::EraseNode(Pointer tmp) {
   if (tmp == root_)
     root_ = it.current_;
   else {
-    if (*it > tmp->parent->value) {
+    if (tmp->parent->right == tmp) {
       tmp->parent->right = it.current_;
     } else {
       tmp->parent->left = it.current_;
@@ -454,22 +548,86 @@ void Set<T>::EraseNode(Pointer tmp) {
   }
 }
 
-template <class T>
-std::pair<typename Set<T>::Iterator, bool> Set<T>::Search(ConstReference v) {
+// The node after node in order, for a node without a right child: the
+// first ancestor it lies to the left of
+template <class T, class Compare>
+typename Set<T, Compare>::Pointer Set<T, Compare>::Successor(Pointer node) {
+  while (node->parent && node == node->parent->right) node = node->parent;
+  return node->parent;
+}
+
+// One comparison per level and no early exit: the search runs down to a
+// leaf, and the first node not less than key is the last one it went left
+// from, the leaf itself or an ancestor on the way back up. Only that node
+// is tested for equivalence. Returns the node equivalent to key, or else
+// the leaf key would hang from.
+template <class T, class Compare>
+template <class K>
+std::pair<typename Set<T, Compare>::Iterator, bool> Set<T, Compare>::Search(
+    const K& key) const {
   Pointer it = root_, top = it;
+  bool less = false;
   while (it) {
     top = it;
-    if (it->value == v) {
-      return std::make_pair(Iterator(top), true);
-    } else if (it->value > v) {
-      it = it->left;
-    } else {
-      it = it->right;
-    }
+    less = comp_(it->value, key);
+    it = less ? it->right : it->left;
+  }
+  Pointer candidate = less ? Successor(top) : top;
+  if (candidate && !comp_(key, candidate->value)) {
+    return std::make_pair(Iterator(candidate), true);
   }
   return std::make_pair(Iterator(top), false);
 }
 
+template <class T, class Compare>
+template <class K>
+typename Set<T, Compare>::Pointer Set<T, Compare>::FindNode(
+    const K& key) const {
+  Pair res = Search(key);
+  return res.second ? res.first.current_ : nullptr;
+}
+
+// Search for kPrefetchGroup keys at a time, one level of each per round,
+// each down to a leaf as in Search. emit gets the node of each key, nullptr
+// if it is absent.
+template <class T, class Compare>
+template <class ForwardIt, class Emit>
+void Set<T, Compare>::SearchBatch(ForwardIt keys, SizeType count,
+                                  Emit emit) const {
+  const T* key[kPrefetchGroup];
+  Pointer node[kPrefetchGroup];
+  Pointer candidate[kPrefetchGroup];
+  while (count) {
+    SizeType group = count < kPrefetchGroup ? count : kPrefetchGroup;
+    for (SizeType i = 0; i < group; ++i, ++keys) {
+      key[i] = &*keys;
+      node[i] = root_;
+      candidate[i] = nullptr;
+    }
+    for (bool pending = root_ != nullptr; pending;) {
+      pending = false;
+      for (SizeType i = 0; i < group; ++i) {
+        if (!node[i]) continue;
+        if (comp_(node[i]->value, *key[i])) {
+          node[i] = node[i]->right;
+        } else {
+          candidate[i] = node[i];
+          node[i] = node[i]->left;
+        }
+        if (node[i]) {
+          Prefetch(node[i]);
+          pending = true;
+        }
+      }
+    }
+    for (SizeType i = 0; i < group; ++i) {
+      bool found = candidate[i] && !comp_(*key[i], candidate[i]->value);
+      emit(found ? candidate[i] : nullptr);
+    }
+    count -= group;
+  }
+}
+
 }  // namespace s21
 
 #endif  // SRC_CONTAINERS_S21_SET_H_
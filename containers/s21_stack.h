@@ -1,6 +1,10 @@
 #ifndef SRC_CONTAINERS_S21_STACK_H_
 #define SRC_CONTAINERS_S21_STACK_H_
 
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
 #include "s21_vector.h"
 
 namespace s21 {
@@ -32,9 +36,19 @@ class Stack {
   bool Empty() const { return container_.Empty(); }
   SizeType Size() const { return container_.Size(); }
   SizeType MaxSize() { return container_.MaxSize(); }
+  // Available when Container has them
+  template <class C = Container>
+  auto Reserve(SizeType n) -> decltype(std::declval<C &>().Reserve(n)) {
+    container_.Reserve(n);
+  }
+  template <class C = Container>
+  auto ShrinkToFit() -> decltype(std::declval<C &>().ShrinkToFit()) {
+    container_.ShrinkToFit();
+  }
 
   // Stack Modifiers
   void Push(ConstReference value) { container_.PushBack(value); }
+  void Push(ValueType &&value) { container_.PushBack(std::move(value)); }
   void Pop() { container_.PopBack(); }
   void Swap(Stack &other) { container_.Swap(other.container_); }
 
@@ -44,8 +58,45 @@ class Stack {
     container_.EmplaceBack(std::forward<Args>(args)...);
   }
 
+  // Pushes [first, last) in order, so *(last - 1) ends up on top. For
+  // forward iterators the container grows once for the whole range.
+  template <class InputIt>
+  void PushRange(InputIt first, InputIt last) {
+    using Category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of<std::forward_iterator_tag, Category>::value) {
+      auto count = static_cast<SizeType>(std::distance(first, last));
+      TryReserve(container_, container_.Size() + count, 0);
+    }
+    for (; first != last; ++first) container_.PushBack(*first);
+  }
+
+  // Pops up to n elements and appends them to out with PushBack, top first;
+  // returns the number of elements popped
+  template <class OutContainer>
+  SizeType PopN(SizeType n, OutContainer &out) {
+    if (n > container_.Size()) n = container_.Size();
+    TryReserve(out, out.Size() + n, 0);
+    for (SizeType i = 0; i < n; ++i) {
+      out.PushBack(container_.Back());
+      container_.PopBack();
+    }
+    return n;
+  }
+
  private:
   Container container_;
+
+  // Support functions
+  // Grows c to hold n elements, at least doubling it as PushBack would, so
+  // that many small batches stay amortized O(1) per element
+  template <class C>
+  static auto TryReserve(C &c, SizeType n, int)
+      -> decltype(c.Reserve(n), c.Capacity(), void()) {
+    if (n <= c.Capacity()) return;
+    c.Reserve(n > 2 * c.Capacity() ? n : 2 * c.Capacity());
+  }
+  template <class C>
+  static void TryReserve(C &, SizeType, long) {}
 };
 
 }  // namespace s21
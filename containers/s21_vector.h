@@ -1,9 +1,11 @@
 ﻿#ifndef SRC_CONTAINERS_S21_VECTOR_H_
 #define SRC_CONTAINERS_S21_VECTOR_H_
 
+#include <algorithm>
 #include <initializer_list>
 #include <iterator>
 #include <limits>
+#include <utility>
 
 namespace s21 {
 template <class T>
@@ -118,6 +120,7 @@ class Vector {
   // Vector Element access
   Reference At(SizeType pos);
   Reference operator[](SizeType pos);
+  ConstReference operator[](SizeType pos) const;
   ConstReference Front() const;
   ConstReference Back() const;
   T* Data();
@@ -131,9 +134,9 @@ class Vector {
   // Vector Capacity
   bool Empty() const;
   SizeType Size() const;
-  SizeType MaxSize();
+  SizeType MaxSize() const;
   void Reserve(SizeType size);
-  SizeType Capacity();
+  SizeType Capacity() const;
   void ShrinkToFit();
 
   // Vector Modifiers
@@ -141,6 +144,7 @@ class Vector {
   Iterator Insert(Iterator pos, ConstReference value);
   void Erase(Iterator pos);
   void PushBack(ConstReference value);
+  void PushBack(ValueType&& value);
   void PopBack();
   void Swap(Vector& other);
 
@@ -211,6 +215,11 @@ typename Vector<T>::Reference Vector<T>::operator[](SizeType pos) {
   return vector_[pos];
 }
 
+template <class T>
+typename Vector<T>::ConstReference Vector<T>::operator[](SizeType pos) const {
+  return vector_[pos];
+}
+
 template <class T>
 typename Vector<T>::ConstReference Vector<T>::Front() const {
   return vector_[0];
@@ -259,7 +268,7 @@ typename Vector<T>::SizeType Vector<T>::Size() const {
 }
 
 template <class T>
-typename Vector<T>::SizeType Vector<T>::MaxSize() {
+typename Vector<T>::SizeType Vector<T>::MaxSize() const {
   return std::numeric_limits<SizeType>::max() / sizeof(vector_);
 }
 
@@ -272,7 +281,7 @@ void Vector<T>::Reserve(SizeType n) {
 }
 
 template <class T>
-typename Vector<T>::SizeType Vector<T>::Capacity() {
+typename Vector<T>::SizeType Vector<T>::Capacity() const {
   return capacity_;
 }
 
@@ -287,6 +296,7 @@ template <class T>
 void Vector<T>::Clear() {
   if (capacity_) {
     delete[] vector_;
+    vector_ = nullptr;
     size_ = capacity_ = 0;
   }
 }
@@ -325,6 +335,12 @@ void Vector<T>::PushBack(ConstReference value) {
   vector_[size_++] = value;
 }
 
+template <class T>
+void Vector<T>::PushBack(ValueType&& value) {
+  if (size_ == capacity_) ReSize();
+  vector_[size_++] = std::move(value);
+}
+
 template <class T>
 void Vector<T>::PopBack() {
   --size_;
@@ -379,7 +395,7 @@ void Vector<T>::MoveData() {
     vector_ = new ValueType[capacity_];
   } else {
     Pointer tmp = new ValueType[capacity_];
-    std::copy(vector_, vector_ + size_, tmp);
+    std::move(vector_, vector_ + size_, tmp);
     delete[] vector_;
     vector_ = tmp;
     tmp = nullptr;
@@ -0,0 +1,221 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_BLOCKING_QUEUE_H_
+#define SRC_CONTAINERS_EXTRA_S21_BLOCKING_QUEUE_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <utility>
+
+#include "../containers/s21_queue.h"
+
+namespace s21 {
+// Unbounded queue guarded by a single mutex whose consumers sleep on a
+// condition variable instead of polling. The number of sleeping consumers is
+// tracked under the lock, so producers only notify when somebody is actually
+// waiting, and notify outside the lock so the woken thread does not block on
+// it right away. After Close() pushes are rejected and consumers drain what
+// is left, then get false.
+template <class T, class Container = s21::Queue<T>>
+class BlockingQueue {
+ public:
+  // BlockingQueue Member type
+  using ValueType = T;
+  using Reference = T&;
+  using ConstReference = const T&;
+  using SizeType = size_t;
+
+  // BlockingQueue Member functions
+  BlockingQueue() = default;
+  BlockingQueue(const BlockingQueue& q) = delete;
+  BlockingQueue& operator=(const BlockingQueue& q) = delete;
+  ~BlockingQueue() = default;
+
+  // BlockingQueue Capacity
+  bool Empty() const;
+  SizeType Size() const;
+  bool Closed() const;
+
+  // BlockingQueue Modifiers
+  // Return false if the queue is closed
+  bool Push(ConstReference value);
+  bool Push(ValueType&& value);
+  template <typename... Args>
+  bool Emplace(Args&&... args);
+  // Pushes [first, last) under one lock and wakes at most one consumer per
+  // element; returns the number of elements pushed
+  template <class InputIt>
+  SizeType PushRange(InputIt first, InputIt last);
+
+  // Blocks until an element is available; returns false once the queue is
+  // closed and drained
+  bool Pop(Reference out);
+  bool TryPop(Reference out);
+  template <class Rep, class Period>
+  bool TryPopFor(Reference out,
+                 const std::chrono::duration<Rep, Period>& timeout);
+  // Blocks like Pop, then appends up to max elements to out with PushBack
+  // under the same lock; returns 0 once the queue is closed and drained.
+  // out is not reserved for max, so a caller collecting batches in one
+  // Vector only pays for its own amortized growth while holding the lock.
+  template <class OutContainer>
+  SizeType PopBatch(SizeType max, OutContainer& out);
+
+  // Rejects further pushes and wakes every waiting consumer
+  void Close();
+
+ private:
+  mutable std::mutex mutex_;
+  std::condition_variable not_empty_;
+  Container queue_;
+  SizeType waiting_ = 0;  // consumers blocked in not_empty_, under mutex_
+  bool closed_ = false;
+
+  // Support functions
+  void TakeFront(Reference out);
+  void Notify(SizeType waiting, SizeType pushed);
+};
+
+// BlockingQueue Capacity
+template <class T, class Container>
+bool BlockingQueue<T, Container>::Empty() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return queue_.Empty();
+}
+
+template <class T, class Container>
+typename BlockingQueue<T, Container>::SizeType
+BlockingQueue<T, Container>::Size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return queue_.Size();
+}
+
+template <class T, class Container>
+bool BlockingQueue<T, Container>::Closed() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return closed_;
+}
+
+// BlockingQueue Modifiers
+template <class T, class Container>
+bool BlockingQueue<T, Container>::Push(ConstReference value) {
+  return Emplace(value);
+}
+
+template <class T, class Container>
+bool BlockingQueue<T, Container>::Push(ValueType&& value) {
+  return Emplace(std::move(value));
+}
+
+template <class T, class Container>
+template <typename... Args>
+bool BlockingQueue<T, Container>::Emplace(Args&&... args) {
+  SizeType waiting;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (closed_) return false;
+    queue_.EmplaceBack(std::forward<Args>(args)...);
+    waiting = waiting_;
+  }
+  Notify(waiting, 1);
+  return true;
+}
+
+template <class T, class Container>
+template <class InputIt>
+typename BlockingQueue<T, Container>::SizeType
+BlockingQueue<T, Container>::PushRange(InputIt first, InputIt last) {
+  SizeType pushed = 0;
+  SizeType waiting;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (closed_) return 0;
+    for (; first != last; ++first, ++pushed) {
+      queue_.EmplaceBack(*first);
+    }
+    waiting = waiting_;
+  }
+  Notify(waiting, pushed);
+  return pushed;
+}
+
+template <class T, class Container>
+bool BlockingQueue<T, Container>::Pop(Reference out) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  ++waiting_;
+  not_empty_.wait(lock, [this] { return !queue_.Empty() || closed_; });
+  --waiting_;
+  if (queue_.Empty()) return false;
+  TakeFront(out);
+  return true;
+}
+
+template <class T, class Container>
+bool BlockingQueue<T, Container>::TryPop(Reference out) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (queue_.Empty()) return false;
+  TakeFront(out);
+  return true;
+}
+
+template <class T, class Container>
+template <class Rep, class Period>
+bool BlockingQueue<T, Container>::TryPopFor(
+    Reference out, const std::chrono::duration<Rep, Period>& timeout) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  ++waiting_;
+  not_empty_.wait_for(lock, timeout,
+                      [this] { return !queue_.Empty() || closed_; });
+  --waiting_;
+  if (queue_.Empty()) return false;
+  TakeFront(out);
+  return true;
+}
+
+template <class T, class Container>
+template <class OutContainer>
+typename BlockingQueue<T, Container>::SizeType
+BlockingQueue<T, Container>::PopBatch(SizeType max, OutContainer& out) {
+  if (max == 0) return 0;
+  std::unique_lock<std::mutex> lock(mutex_);
+  ++waiting_;
+  not_empty_.wait(lock, [this] { return !queue_.Empty() || closed_; });
+  --waiting_;
+  SizeType popped = 0;
+  for (; popped < max && !queue_.Empty(); ++popped) {
+    out.PushBack(queue_.Front());
+    queue_.Pop();
+  }
+  return popped;
+}
+
+template <class T, class Container>
+void BlockingQueue<T, Container>::Close() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = true;
+  }
+  not_empty_.notify_all();
+}
+
+// Support functions
+template <class T, class Container>
+void BlockingQueue<T, Container>::TakeFront(Reference out) {
+  out = queue_.Front();
+  queue_.Pop();
+}
+
+// waiting is sampled under the lock together with the push, so a consumer
+// that is not counted yet will find the element before it goes to sleep
+template <class T, class Container>
+void BlockingQueue<T, Container>::Notify(SizeType waiting, SizeType pushed) {
+  if (waiting == 0 || pushed == 0) return;
+  if (pushed >= waiting) {
+    not_empty_.notify_all();
+  } else {
+    for (SizeType i = 0; i < pushed; ++i) not_empty_.notify_one();
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_BLOCKING_QUEUE_H_
@@ -0,0 +1,290 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_BLOOM_FILTER_H_
+#define SRC_CONTAINERS_EXTRA_S21_BLOOM_FILTER_H_
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "../containers/s21_vector.h"
+
+namespace s21 {
+// Blocked Bloom filter: a set of keys that answers "maybe present" or
+// "surely absent" from a few bits per key. Each key maps to one 64 byte
+// block and sets its bits there, so a query touches one cache line whatever
+// the number of hashes.
+//
+// Hash is only a seed: its result is remixed, so std::hash, which leaves
+// integers as they are, spreads well enough.
+template <class T, class Hash = std::hash<T>>
+class BloomFilter {
+ public:
+  // BloomFilter Member type
+  using KeyType = T;
+  using SizeType = size_t;
+
+  static constexpr double kDefaultBitsPerKey = 10;
+
+  // BloomFilter Member functions
+  BloomFilter() : BloomFilter(0) {}
+  // Sized for capacity keys at bits_per_key bits each; beyond that the
+  // false positive rate climbs
+  explicit BloomFilter(SizeType capacity,
+                       double bits_per_key = kDefaultBitsPerKey);
+
+  // Bits per key for a false positive rate in (0, 1), as for a plain Bloom
+  // filter. The blocked layout lands above the rate, the more so the lower
+  // it is: about 1.4% for 1% and 0.45% for 0.1%.
+  static double BitsPerKey(double false_positive_rate);
+
+  // BloomFilter Lookup
+  // False if key was never inserted; true if it may have been
+  bool MayContain(const T& key) const;
+
+  // BloomFilter Capacity
+  SizeType Capacity() const { return capacity_; }
+  SizeType Bits() const { return blocks_.Size() * kBlockBits; }
+  int Hashes() const { return hashes_; }
+
+  // BloomFilter Modifiers
+  void Insert(const T& key);
+  // Forgets every key and keeps the capacity
+  void Clear();
+
+ private:
+  static constexpr SizeType kBlockBits = 512;
+  static constexpr double kLn2 = 0.6931471805599453;
+
+  struct alignas(64) Block {
+    std::uint64_t words[kBlockBits / 64] = {};
+  };
+
+  Vector<Block> blocks_;
+  SizeType capacity_ = 0;
+  int hashes_ = 1;
+
+  // Support functions
+  static std::uint64_t Mix(std::uint64_t hash);
+  SizeType BlockIndex(std::uint64_t hash) const;
+};
+
+// Options of the filter in front of a FilteredSet, FilteredMap or
+// FilteredMultiset
+struct FilterOptions {
+  double bits_per_key = BloomFilter<int>::kDefaultBitsPerKey;
+  // A filter cannot forget keys, so it is rebuilt once the erased ones make
+  // up this share of the keys it holds
+  double rebuild_ratio = 0.25;
+};
+
+struct FilterStats {
+  // Lookups the filter answered alone: the key is absent
+  size_t misses = 0;
+  // Lookups passed on to the tree that found the key
+  size_t hits = 0;
+  // Lookups passed on to the tree for nothing
+  size_t false_positives = 0;
+  size_t rebuilds = 0;
+};
+
+// Bloom filter upkeep shared by the filtered containers. The container owns
+// the keys: when Insert finds the filter full or Erase finds too many keys
+// erased, it answers false and the container calls Reset with its size and
+// inserts every key again.
+template <class Key, class Hash>
+class KeyFilter {
+ public:
+  // KeyFilter Member type
+  using SizeType = size_t;
+
+  // KeyFilter Member functions
+  explicit KeyFilter(FilterOptions options = FilterOptions())
+      : options_(options), bloom_(kMinCapacity, options.bits_per_key) {}
+
+  // KeyFilter Lookup
+  // False, counted as a miss, if key is surely absent
+  bool MayContain(const Key& key) const;
+  // Counts what the tree said of a key that passed MayContain
+  void Record(bool found) const {
+    (found ? hits_ : false_positives_).Bump();
+  }
+  FilterStats Stats() const;
+  void ResetStats();
+  const FilterOptions& Options() const { return options_; }
+
+  // KeyFilter Modifiers
+  // False when the filter is full and needs a Reset instead
+  bool Insert(const Key& key);
+  // False when enough keys have gone for a Reset to pay
+  bool Erase();
+  // Empties the filter for size keys to be inserted again
+  void Reset(SizeType size);
+  // Empties the filter along with its container
+  void Clear();
+
+ private:
+  static constexpr SizeType kMinCapacity = 64;
+
+  // Bumped with a relaxed load and store rather than an atomic add, so
+  // const lookups stay cheap and may run in parallel, at the price of
+  // losing counts when they do
+  struct Counter {
+    Counter() = default;
+    Counter(const Counter& other) : value(other.Load()) {}
+    Counter& operator=(const Counter& other) {
+      value.store(other.Load(), std::memory_order_relaxed);
+      return *this;
+    }
+    SizeType Load() const { return value.load(std::memory_order_relaxed); }
+    void Bump() { value.store(Load() + 1, std::memory_order_relaxed); }
+
+    std::atomic<SizeType> value{0};
+  };
+
+  FilterOptions options_;
+  BloomFilter<Key, Hash> bloom_;
+  // Keys inserted and erased since the last Reset
+  SizeType keys_ = 0;
+  SizeType erased_ = 0;
+  mutable Counter misses_;
+  mutable Counter hits_;
+  mutable Counter false_positives_;
+  SizeType rebuilds_ = 0;
+};
+
+// BloomFilter Member functions
+// k = bits_per_key * ln 2 hashes minimize the false positive rate
+template <class T, class Hash>
+BloomFilter<T, Hash>::BloomFilter(SizeType capacity, double bits_per_key)
+    : capacity_(capacity) {
+  if (!(bits_per_key >= 1)) bits_per_key = 1;
+  double bits = capacity * bits_per_key;
+  blocks_ = Vector<Block>(static_cast<SizeType>(bits / kBlockBits) + 1);
+  hashes_ = static_cast<int>(bits_per_key * kLn2 + 0.5);
+  if (hashes_ < 1) hashes_ = 1;
+  if (hashes_ > 16) hashes_ = 16;
+}
+
+template <class T, class Hash>
+double BloomFilter<T, Hash>::BitsPerKey(double false_positive_rate) {
+  if (!(false_positive_rate > 0)) false_positive_rate = 1e-9;
+  if (false_positive_rate >= 1) return 1;
+  return -std::log(false_positive_rate) / (kLn2 * kLn2);
+}
+
+// BloomFilter Lookup
+// The low half of the hash picks the bits, stepping by a rotation of
+// itself; the high half picks the block
+template <class T, class Hash>
+bool BloomFilter<T, Hash>::MayContain(const T& key) const {
+  std::uint64_t hash = Mix(Hash()(key));
+  const Block& block = blocks_[BlockIndex(hash)];
+  std::uint32_t bit = static_cast<std::uint32_t>(hash);
+  std::uint32_t step = (bit >> 17) | (bit << 15);
+  for (int i = 0; i < hashes_; ++i, bit += step) {
+    SizeType index = bit % kBlockBits;
+    if (!(block.words[index / 64] >> (index % 64) & 1)) return false;
+  }
+  return true;
+}
+
+// BloomFilter Modifiers
+template <class T, class Hash>
+void BloomFilter<T, Hash>::Insert(const T& key) {
+  std::uint64_t hash = Mix(Hash()(key));
+  Block& block = blocks_[BlockIndex(hash)];
+  std::uint32_t bit = static_cast<std::uint32_t>(hash);
+  std::uint32_t step = (bit >> 17) | (bit << 15);
+  for (int i = 0; i < hashes_; ++i, bit += step) {
+    SizeType index = bit % kBlockBits;
+    block.words[index / 64] |= std::uint64_t(1) << (index % 64);
+  }
+}
+
+template <class T, class Hash>
+void BloomFilter<T, Hash>::Clear() {
+  for (SizeType i = 0; i < blocks_.Size(); ++i) blocks_[i] = Block();
+}
+
+// Support functions
+// The finalizer of MurmurHash3
+template <class T, class Hash>
+std::uint64_t BloomFilter<T, Hash>::Mix(std::uint64_t hash) {
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+// Scales the high half of the hash to the block count, which avoids a
+// division
+template <class T, class Hash>
+typename BloomFilter<T, Hash>::SizeType BloomFilter<T, Hash>::BlockIndex(
+    std::uint64_t hash) const {
+  return ((hash >> 32) * blocks_.Size()) >> 32;
+}
+
+// KeyFilter Lookup
+template <class Key, class Hash>
+bool KeyFilter<Key, Hash>::MayContain(const Key& key) const {
+  if (bloom_.MayContain(key)) return true;
+  misses_.Bump();
+  return false;
+}
+
+template <class Key, class Hash>
+FilterStats KeyFilter<Key, Hash>::Stats() const {
+  FilterStats stats;
+  stats.misses = misses_.Load();
+  stats.hits = hits_.Load();
+  stats.false_positives = false_positives_.Load();
+  stats.rebuilds = rebuilds_;
+  return stats;
+}
+
+template <class Key, class Hash>
+void KeyFilter<Key, Hash>::ResetStats() {
+  misses_ = Counter();
+  hits_ = Counter();
+  false_positives_ = Counter();
+  rebuilds_ = 0;
+}
+
+// KeyFilter Modifiers
+template <class Key, class Hash>
+bool KeyFilter<Key, Hash>::Insert(const Key& key) {
+  if (keys_ == bloom_.Capacity()) return false;
+  bloom_.Insert(key);
+  ++keys_;
+  return true;
+}
+
+template <class Key, class Hash>
+bool KeyFilter<Key, Hash>::Erase() {
+  ++erased_;
+  return erased_ <= options_.rebuild_ratio * keys_;
+}
+
+// Leaves room for the container to double before the next Reset
+template <class Key, class Hash>
+void KeyFilter<Key, Hash>::Reset(SizeType size) {
+  SizeType capacity = 2 * size < kMinCapacity ? kMinCapacity : 2 * size;
+  bloom_ = BloomFilter<Key, Hash>(capacity, options_.bits_per_key);
+  keys_ = 0;
+  erased_ = 0;
+  ++rebuilds_;
+}
+
+template <class Key, class Hash>
+void KeyFilter<Key, Hash>::Clear() {
+  bloom_.Clear();
+  keys_ = 0;
+  erased_ = 0;
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_BLOOM_FILTER_H_
@@ -0,0 +1,540 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_CACHE_H_
+#define SRC_CONTAINERS_EXTRA_S21_CACHE_H_
+
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+#include "../containers/s21_list.h"
+#include "../containers/s21_vector.h"
+
+namespace s21 {
+struct CacheStats {
+  size_t hits = 0;
+  size_t misses = 0;
+  size_t evictions = 0;
+};
+
+// Open addressing hash index from keys to list positions, shared by the
+// caches below. Handle is a list iterator whose element has a `key` member;
+// an empty slot holds a default constructed Handle. Keys are spread with
+// Fibonacci hashing, probed linearly and erased by shifting the rest of the
+// probe run back, so there are no tombstones and lookups stay short.
+template <class Key, class Handle, class Hash = std::hash<Key>>
+class CacheIndex {
+ public:
+  // CacheIndex Member type
+  using SizeType = size_t;
+
+  // CacheIndex Capacity
+  SizeType Size() const { return size_; }
+  // Makes room for n keys, so that inserting them does not rehash
+  void Reserve(SizeType n);
+
+  // CacheIndex Lookup
+  // Returns Handle() when the key is absent
+  Handle Find(const Key& key) const;
+
+  // CacheIndex Modifiers
+  // The key of handle must not be in the index yet
+  void Insert(Handle handle);
+  void Erase(const Key& key);
+  void Clear();
+
+ private:
+  static constexpr SizeType kMinSlots = 16;
+
+  Vector<Handle> slots_;
+  SizeType size_ = 0;
+  int shift_ = 64;
+  Hash hash_;
+
+  // Support functions
+  SizeType Home(const Key& key) const;
+  SizeType Mask() const { return slots_.Size() - 1; }
+  bool Vacant(SizeType slot) const { return slots_[slot] == Handle(); }
+  void Rehash(SizeType slots);
+};
+
+// Least recently used cache. Entries live in a List ordered from the least
+// to the most recently used one, so a hit is an index lookup plus a Splice
+// to the back and eviction takes the front. Nodes of evicted and erased
+// entries are parked on a spare list and reused by later puts, so once the
+// cache is full it stops allocating.
+//
+// The capacity is a number of entries, or a total weight when a weigher is
+// given; the weigher is called once per Put. Pointers returned by Get stay
+// valid until the entry is evicted or erased.
+template <class K, class V, class Hash = std::hash<K>>
+class LruCache {
+ public:
+  // LruCache Member type
+  using KeyType = K;
+  using MappedType = V;
+  using SizeType = size_t;
+  using Weigher = std::function<SizeType(const K&, const V&)>;
+
+  // LruCache Member functions
+  explicit LruCache(SizeType capacity);
+  LruCache(SizeType capacity, Weigher weigher);
+  LruCache(const LruCache& c) = delete;
+  ~LruCache() = default;
+  LruCache& operator=(const LruCache& c) = delete;
+
+  // LruCache Lookup
+  // Marks the entry as most recently used; nullptr on a miss
+  V* Get(const K& key);
+  // Neither reorders entries nor counts towards the stats
+  bool Contains(const K& key) const { return index_.Find(key) != Handle(); }
+
+  // LruCache Capacity
+  bool Empty() const { return entries_.Empty(); }
+  SizeType Size() const { return entries_.Size(); }
+  SizeType Capacity() const { return capacity_; }
+  SizeType Weight() const { return weight_; }
+  const CacheStats& Stats() const { return stats_; }
+
+  // LruCache Modifiers
+  // Inserts or replaces the entry and evicts until the cache fits again.
+  // Returns false, caching nothing, if the entry alone exceeds the capacity
+  bool Put(const K& key, V value);
+  bool Erase(const K& key);
+  void Clear();
+
+ private:
+  struct Entry {
+    K key;
+    V value;
+    SizeType weight;
+  };
+
+  using EntryList = List<Entry>;
+  using Handle = typename EntryList::Iterator;
+
+  EntryList entries_;  // least recently used first
+  EntryList spare_;
+  CacheIndex<K, Handle, Hash> index_;
+  SizeType capacity_;
+  SizeType weight_ = 0;
+  Weigher weigher_;
+  CacheStats stats_;
+
+  // Support functions
+  void EvictFor(SizeType incoming, Handle keep);
+  void Release(Handle node);
+};
+
+// Least frequently used cache, ties broken by recency. Entries sit in one
+// List sorted by use count, and every run of equal counts has a bucket that
+// points at the run's last entry. A hit moves the entry behind the last
+// entry of the next bucket (creating it if needed), so Get, Put and
+// eviction of the front entry are all O(1). Entry and bucket nodes are
+// recycled like in LruCache.
+template <class K, class V, class Hash = std::hash<K>>
+class LfuCache {
+ public:
+  // LfuCache Member type
+  using KeyType = K;
+  using MappedType = V;
+  using SizeType = size_t;
+  using Weigher = std::function<SizeType(const K&, const V&)>;
+
+  // LfuCache Member functions
+  explicit LfuCache(SizeType capacity);
+  LfuCache(SizeType capacity, Weigher weigher);
+  LfuCache(const LfuCache& c) = delete;
+  ~LfuCache() = default;
+  LfuCache& operator=(const LfuCache& c) = delete;
+
+  // LfuCache Lookup
+  // Counts a use of the entry; nullptr on a miss
+  V* Get(const K& key);
+  bool Contains(const K& key) const { return index_.Find(key) != Handle(); }
+  // Number of uses of a cached entry, 0 if it is not cached
+  SizeType Frequency(const K& key) const;
+
+  // LfuCache Capacity
+  bool Empty() const { return entries_.Empty(); }
+  SizeType Size() const { return entries_.Size(); }
+  SizeType Capacity() const { return capacity_; }
+  SizeType Weight() const { return weight_; }
+  const CacheStats& Stats() const { return stats_; }
+
+  // LfuCache Modifiers
+  // Replacing an entry counts as a use of it
+  bool Put(const K& key, V value);
+  bool Erase(const K& key);
+  void Clear();
+
+ private:
+  struct Entry;
+  struct Bucket {
+    SizeType frequency;
+    SizeType count;
+    typename List<Entry>::Iterator last;
+  };
+
+  using BucketList = List<Bucket>;
+  using BucketHandle = typename BucketList::Iterator;
+
+  struct Entry {
+    K key;
+    V value;
+    SizeType weight;
+    BucketHandle bucket;
+  };
+
+  using EntryList = List<Entry>;
+  using Handle = typename EntryList::Iterator;
+
+  EntryList entries_;  // by frequency, then least recently used first
+  EntryList spare_;
+  BucketList buckets_;  // by frequency
+  BucketList spare_buckets_;
+  CacheIndex<K, Handle, Hash> index_;
+  SizeType capacity_;
+  SizeType weight_ = 0;
+  Weigher weigher_;
+  CacheStats stats_;
+
+  // Support functions
+  void Touch(Handle node);
+  void EvictFor(SizeType incoming, Handle keep);
+  void Release(Handle node);
+  void LeaveBucket(Handle node);
+  BucketHandle NewBucket(BucketHandle pos, const Bucket& bucket);
+};
+
+// CacheIndex Capacity
+template <class Key, class Handle, class Hash>
+void CacheIndex<Key, Handle, Hash>::Reserve(SizeType n) {
+  SizeType slots = kMinSlots;
+  while (slots < 2 * n) slots *= 2;
+  if (slots > slots_.Size()) Rehash(slots);
+}
+
+// CacheIndex Lookup
+template <class Key, class Handle, class Hash>
+Handle CacheIndex<Key, Handle, Hash>::Find(const Key& key) const {
+  if (size_ == 0) return Handle();
+  for (SizeType slot = Home(key); !Vacant(slot); slot = (slot + 1) & Mask()) {
+    if ((*slots_[slot]).key == key) return slots_[slot];
+  }
+  return Handle();
+}
+
+// CacheIndex Modifiers
+template <class Key, class Handle, class Hash>
+void CacheIndex<Key, Handle, Hash>::Insert(Handle handle) {
+  if (2 * (size_ + 1) > slots_.Size()) {
+    Rehash(slots_.Size() ? 2 * slots_.Size() : kMinSlots);
+  }
+  SizeType slot = Home((*handle).key);
+  while (!Vacant(slot)) slot = (slot + 1) & Mask();
+  slots_[slot] = handle;
+  ++size_;
+}
+
+template <class Key, class Handle, class Hash>
+void CacheIndex<Key, Handle, Hash>::Erase(const Key& key) {
+  if (size_ == 0) return;
+  SizeType hole = Home(key);
+  while (!Vacant(hole) && !((*slots_[hole]).key == key)) {
+    hole = (hole + 1) & Mask();
+  }
+  if (Vacant(hole)) return;
+  // An entry further along the run moves into the hole unless its home
+  // lies cyclically after the hole, where it would become unreachable
+  for (SizeType slot = (hole + 1) & Mask(); !Vacant(slot);
+       slot = (slot + 1) & Mask()) {
+    SizeType home = Home((*slots_[slot]).key);
+    if (((slot - home) & Mask()) >= ((slot - hole) & Mask())) {
+      slots_[hole] = slots_[slot];
+      hole = slot;
+    }
+  }
+  slots_[hole] = Handle();
+  --size_;
+}
+
+template <class Key, class Handle, class Hash>
+void CacheIndex<Key, Handle, Hash>::Clear() {
+  for (SizeType slot = 0; slot < slots_.Size(); ++slot) {
+    slots_[slot] = Handle();
+  }
+  size_ = 0;
+}
+
+// Support functions
+template <class Key, class Handle, class Hash>
+typename CacheIndex<Key, Handle, Hash>::SizeType
+CacheIndex<Key, Handle, Hash>::Home(const Key& key) const {
+  std::uint64_t mixed =
+      static_cast<std::uint64_t>(hash_(key)) * 0x9E3779B97F4A7C15ULL;
+  return static_cast<SizeType>(mixed >> shift_);
+}
+
+template <class Key, class Handle, class Hash>
+void CacheIndex<Key, Handle, Hash>::Rehash(SizeType slots) {
+  Vector<Handle> old(slots);
+  old.Swap(slots_);
+  shift_ = 64;
+  for (SizeType n = slots; n > 1; n /= 2) --shift_;
+  for (SizeType slot = 0; slot < old.Size(); ++slot) {
+    if (old[slot] == Handle()) continue;
+    SizeType target = Home((*old[slot]).key);
+    while (!Vacant(target)) target = (target + 1) & Mask();
+    slots_[target] = old[slot];
+  }
+}
+
+// LruCache Member functions
+template <class K, class V, class Hash>
+LruCache<K, V, Hash>::LruCache(SizeType capacity) : capacity_(capacity) {
+  index_.Reserve(capacity);
+}
+
+template <class K, class V, class Hash>
+LruCache<K, V, Hash>::LruCache(SizeType capacity, Weigher weigher)
+    : capacity_(capacity), weigher_(std::move(weigher)) {}
+
+// LruCache Lookup
+template <class K, class V, class Hash>
+V* LruCache<K, V, Hash>::Get(const K& key) {
+  Handle node = index_.Find(key);
+  if (node == Handle()) {
+    ++stats_.misses;
+    return nullptr;
+  }
+  ++stats_.hits;
+  entries_.Splice(entries_.Cend(), entries_, node);
+  return &(*node).value;
+}
+
+// LruCache Modifiers
+template <class K, class V, class Hash>
+bool LruCache<K, V, Hash>::Put(const K& key, V value) {
+  SizeType weight = weigher_ ? weigher_(key, value) : 1;
+  if (weight > capacity_) {
+    Erase(key);
+    return false;
+  }
+  Handle node = index_.Find(key);
+  if (node == Handle()) {
+    EvictFor(weight, Handle());
+    if (spare_.Empty()) {
+      node = entries_.Insert(entries_.End(), Entry{key, std::move(value), 0});
+    } else {
+      node = spare_.Begin();
+      entries_.Splice(entries_.Cend(), spare_, node);
+      (*node).key = key;
+      (*node).value = std::move(value);
+    }
+    index_.Insert(node);
+  } else {
+    weight_ -= (*node).weight;
+    (*node).value = std::move(value);
+    entries_.Splice(entries_.Cend(), entries_, node);
+    EvictFor(weight, node);
+  }
+  (*node).weight = weight;
+  weight_ += weight;
+  return true;
+}
+
+template <class K, class V, class Hash>
+bool LruCache<K, V, Hash>::Erase(const K& key) {
+  Handle node = index_.Find(key);
+  if (node == Handle()) return false;
+  Release(node);
+  return true;
+}
+
+template <class K, class V, class Hash>
+void LruCache<K, V, Hash>::Clear() {
+  entries_.Clear();
+  spare_.Clear();
+  index_.Clear();
+  weight_ = 0;
+}
+
+// Support functions
+// Evicts from the least recently used end until incoming more weight fits,
+// passing over keep
+template <class K, class V, class Hash>
+void LruCache<K, V, Hash>::EvictFor(SizeType incoming, Handle keep) {
+  while (weight_ + incoming > capacity_) {
+    Handle victim = entries_.Begin();
+    if (victim == keep) ++victim;
+    Release(victim);
+    ++stats_.evictions;
+  }
+}
+
+template <class K, class V, class Hash>
+void LruCache<K, V, Hash>::Release(Handle node) {
+  index_.Erase((*node).key);
+  weight_ -= (*node).weight;
+  spare_.Splice(spare_.Cbegin(), entries_, node);
+}
+
+// LfuCache Member functions
+template <class K, class V, class Hash>
+LfuCache<K, V, Hash>::LfuCache(SizeType capacity) : capacity_(capacity) {
+  index_.Reserve(capacity);
+}
+
+template <class K, class V, class Hash>
+LfuCache<K, V, Hash>::LfuCache(SizeType capacity, Weigher weigher)
+    : capacity_(capacity), weigher_(std::move(weigher)) {}
+
+// LfuCache Lookup
+template <class K, class V, class Hash>
+V* LfuCache<K, V, Hash>::Get(const K& key) {
+  Handle node = index_.Find(key);
+  if (node == Handle()) {
+    ++stats_.misses;
+    return nullptr;
+  }
+  ++stats_.hits;
+  Touch(node);
+  return &(*node).value;
+}
+
+template <class K, class V, class Hash>
+typename LfuCache<K, V, Hash>::SizeType LfuCache<K, V, Hash>::Frequency(
+    const K& key) const {
+  Handle node = index_.Find(key);
+  return node == Handle() ? 0 : (*(*node).bucket).frequency;
+}
+
+// LfuCache Modifiers
+template <class K, class V, class Hash>
+bool LfuCache<K, V, Hash>::Put(const K& key, V value) {
+  SizeType weight = weigher_ ? weigher_(key, value) : 1;
+  if (weight > capacity_) {
+    Erase(key);
+    return false;
+  }
+  Handle node = index_.Find(key);
+  if (node != Handle()) {
+    weight_ -= (*node).weight;
+    (*node).value = std::move(value);
+    (*node).weight = weight;
+    Touch(node);
+    EvictFor(weight, node);
+    weight_ += weight;
+    return true;
+  }
+  EvictFor(weight, Handle());
+  // A new entry is the most recent one with a single use
+  BucketHandle bucket = buckets_.Begin();
+  Handle pos = entries_.Begin();
+  if (bucket == buckets_.End() || (*bucket).frequency != 1) {
+    bucket = NewBucket(bucket, Bucket{1, 0, Handle()});
+  } else {
+    pos = (*bucket).last;
+    ++pos;
+  }
+  if (spare_.Empty()) {
+    node = entries_.Insert(pos, Entry{key, std::move(value), weight, bucket});
+  } else {
+    node = spare_.Begin();
+    entries_.Splice(pos, spare_, node);
+    (*node).key = key;
+    (*node).value = std::move(value);
+    (*node).weight = weight;
+    (*node).bucket = bucket;
+  }
+  (*bucket).last = node;
+  ++(*bucket).count;
+  index_.Insert(node);
+  weight_ += weight;
+  return true;
+}
+
+template <class K, class V, class Hash>
+bool LfuCache<K, V, Hash>::Erase(const K& key) {
+  Handle node = index_.Find(key);
+  if (node == Handle()) return false;
+  Release(node);
+  return true;
+}
+
+template <class K, class V, class Hash>
+void LfuCache<K, V, Hash>::Clear() {
+  entries_.Clear();
+  spare_.Clear();
+  buckets_.Clear();
+  spare_buckets_.Clear();
+  index_.Clear();
+  weight_ = 0;
+}
+
+// Support functions
+// Moves the entry from its bucket to the end of the bucket one use higher
+template <class K, class V, class Hash>
+void LfuCache<K, V, Hash>::Touch(Handle node) {
+  BucketHandle bucket = (*node).bucket;
+  SizeType frequency = (*bucket).frequency + 1;
+  BucketHandle next = bucket;
+  ++next;
+  if (next == buckets_.End() || (*next).frequency != frequency) {
+    if ((*bucket).count == 1) {
+      (*bucket).frequency = frequency;
+      return;
+    }
+    next = NewBucket(next, Bucket{frequency, 0, (*bucket).last});
+  }
+  Handle pos = (*next).last;
+  ++pos;
+  LeaveBucket(node);
+  entries_.Splice(pos, entries_, node);
+  (*next).last = node;
+  ++(*next).count;
+  (*node).bucket = next;
+}
+
+template <class K, class V, class Hash>
+void LfuCache<K, V, Hash>::EvictFor(SizeType incoming, Handle keep) {
+  while (weight_ + incoming > capacity_) {
+    Handle victim = entries_.Begin();
+    if (victim == keep) ++victim;
+    Release(victim);
+    ++stats_.evictions;
+  }
+}
+
+template <class K, class V, class Hash>
+void LfuCache<K, V, Hash>::Release(Handle node) {
+  index_.Erase((*node).key);
+  weight_ -= (*node).weight;
+  LeaveBucket(node);
+  spare_.Splice(spare_.Cbegin(), entries_, node);
+}
+
+// Drops the entry from its bucket's bookkeeping, retiring an emptied bucket;
+// the entry itself stays where it is in entries_
+template <class K, class V, class Hash>
+void LfuCache<K, V, Hash>::LeaveBucket(Handle node) {
+  BucketHandle bucket = (*node).bucket;
+  if (--(*bucket).count == 0) {
+    spare_buckets_.Splice(spare_buckets_.Cbegin(), buckets_, bucket);
+  } else if ((*bucket).last == node) {
+    --(*bucket).last;
+  }
+}
+
+template <class K, class V, class Hash>
+typename LfuCache<K, V, Hash>::BucketHandle LfuCache<K, V, Hash>::NewBucket(
+    BucketHandle pos, const Bucket& bucket) {
+  if (spare_buckets_.Empty()) return buckets_.Insert(pos, bucket);
+  BucketHandle node = spare_buckets_.Begin();
+  buckets_.Splice(pos, spare_buckets_, node);
+  *node = bucket;
+  return node;
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_CACHE_H_
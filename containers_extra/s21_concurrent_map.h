@@ -0,0 +1,320 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_CONCURRENT_MAP_H_
+#define SRC_CONTAINERS_EXTRA_S21_CONCURRENT_MAP_H_
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+
+#include "../containers/s21_map.h"
+#include "../containers/s21_vector.h"
+
+namespace s21 {
+// Map shared between threads, split into Shards independently locked Maps
+// picked by the hash of the key. Lookups take their shard's lock shared, so
+// readers of a shard run in parallel, and writers to different shards never
+// contend. Every member function is atomic with respect to its key; Size()
+// and Empty() add up the shards one at a time, while ForEach holds all of
+// them and so sees a single consistent state.
+//
+// Values are returned by copy, since a reference would outlive the lock.
+template <class K, class V, size_t Shards = 16, class Hash = std::hash<K>>
+class ConcurrentMap {
+  static_assert(Shards > 0, "ConcurrentMap needs at least one shard");
+
+ public:
+  // ConcurrentMap Member type
+  using KeyType = K;
+  using MappedType = V;
+  using SizeType = size_t;
+
+  // ConcurrentMap Member functions
+  ConcurrentMap() = default;
+  ConcurrentMap(const ConcurrentMap& m) = delete;
+  ConcurrentMap& operator=(const ConcurrentMap& m) = delete;
+  ~ConcurrentMap() = default;
+
+  // ConcurrentMap Lookup
+  // Copies the value to out; false if the key is absent
+  bool Find(const K& key, V& out) const;
+  bool Contains(const K& key) const;
+  // Throws std::out_of_range if the key is absent
+  V At(const K& key) const;
+  // Batched Contains and Find. The keys are grouped by shard and every
+  // shard is read-locked once for all of its keys, which it looks up with
+  // Map's batched search. ContainsBatch writes a bool per key to out.
+  // FindBatch writes whether each key was found to found and copies the
+  // value of every key found to the matching position of values, a
+  // forward iterator; it returns the number found. Each shard's part of a
+  // batch is consistent, the batch as a whole is not atomic.
+  template <class ForwardIt, class OutputIt>
+  void ContainsBatch(ForwardIt keys, SizeType count, OutputIt out) const;
+  template <class ForwardIt, class ValueIt, class FoundIt>
+  SizeType FindBatch(ForwardIt keys, SizeType count, ValueIt values,
+                     FoundIt found) const;
+
+  // ConcurrentMap Capacity
+  bool Empty() const;
+  SizeType Size() const;
+
+  // ConcurrentMap Modifiers
+  // Leaves an existing value alone and returns false
+  bool Insert(const K& key, const V& value);
+  // Returns true if the key was new
+  bool InsertOrAssign(const K& key, const V& value);
+  bool Erase(const K& key);
+  // Calls fn(value) under the shard's exclusive lock, with value default
+  // constructed if the key was absent. The entry is kept if fn returns true
+  // and erased otherwise; returns whether the key is present afterwards.
+  // fn must not call back into the map.
+  template <class Fn>
+  bool Compute(const K& key, Fn fn);
+  void Clear();
+
+  // Calls fn(key, value) for every entry while all shards are read-locked,
+  // so concurrent writers wait and fn sees one consistent state. fn must not
+  // call back into the map.
+  template <class Fn>
+  void ForEach(Fn fn) const;
+
+ private:
+  // Each shard on its own cache line, so that locking one does not bounce
+  // the line holding its neighbour
+  struct alignas(64) Shard {
+    mutable std::shared_mutex mutex;
+    Map<K, V> map;
+  };
+
+  // The keys of a batch ordered by shard: those of shard s are keys[j] for
+  // begin[s] <= j < begin[s + 1], and key i of the batch is keys[slot[i]]
+  struct Batch {
+    Vector<K> keys;
+    Vector<SizeType> slot;
+    SizeType begin[Shards + 1] = {};
+  };
+
+  Shard shards_[Shards];
+  Hash hash_;
+
+  // Support functions
+  SizeType ShardIndex(const K& key) const;
+  Shard& ShardFor(const K& key) { return shards_[ShardIndex(key)]; }
+  const Shard& ShardFor(const K& key) const {
+    return shards_[ShardIndex(key)];
+  }
+  template <class ForwardIt>
+  void Group(ForwardIt keys, SizeType count, Batch& batch) const;
+};
+
+// ConcurrentMap Lookup
+template <class K, class V, size_t Shards, class Hash>
+bool ConcurrentMap<K, V, Shards, Hash>::Find(const K& key, V& out) const {
+  const Shard& shard = ShardFor(key);
+  std::shared_lock<std::shared_mutex> lock(shard.mutex);
+  auto it = shard.map.Find(key);
+  if (it == shard.map.Cend()) return false;
+  out = it->second;
+  return true;
+}
+
+template <class K, class V, size_t Shards, class Hash>
+bool ConcurrentMap<K, V, Shards, Hash>::Contains(const K& key) const {
+  const Shard& shard = ShardFor(key);
+  std::shared_lock<std::shared_mutex> lock(shard.mutex);
+  return shard.map.Contains(key);
+}
+
+template <class K, class V, size_t Shards, class Hash>
+V ConcurrentMap<K, V, Shards, Hash>::At(const K& key) const {
+  const Shard& shard = ShardFor(key);
+  std::shared_lock<std::shared_mutex> lock(shard.mutex);
+  return shard.map.At(key);
+}
+
+template <class K, class V, size_t Shards, class Hash>
+template <class ForwardIt, class OutputIt>
+void ConcurrentMap<K, V, Shards, Hash>::ContainsBatch(ForwardIt keys,
+                                                      SizeType count,
+                                                      OutputIt out) const {
+  Batch batch;
+  Group(keys, count, batch);
+  Vector<bool> grouped(count);
+  for (SizeType s = 0; s < Shards; ++s) {
+    SizeType begin = batch.begin[s];
+    if (begin == batch.begin[s + 1]) continue;
+    std::shared_lock<std::shared_mutex> lock(shards_[s].mutex);
+    shards_[s].map.ContainsBatch(&batch.keys[begin],
+                                 batch.begin[s + 1] - begin, &grouped[begin]);
+  }
+  for (SizeType i = 0; i < count; ++i, ++out) *out = grouped[batch.slot[i]];
+}
+
+template <class K, class V, size_t Shards, class Hash>
+template <class ForwardIt, class ValueIt, class FoundIt>
+typename ConcurrentMap<K, V, Shards, Hash>::SizeType
+ConcurrentMap<K, V, Shards, Hash>::FindBatch(ForwardIt keys, SizeType count,
+                                             ValueIt values,
+                                             FoundIt found) const {
+  Batch batch;
+  Group(keys, count, batch);
+  Vector<typename Map<K, V>::ConstIterator> nodes(count);
+  Vector<V> grouped(count);
+  Vector<bool> present(count);
+  for (SizeType s = 0; s < Shards; ++s) {
+    SizeType begin = batch.begin[s];
+    SizeType end = batch.begin[s + 1];
+    if (begin == end) continue;
+    const Map<K, V>& map = shards_[s].map;
+    std::shared_lock<std::shared_mutex> lock(shards_[s].mutex);
+    map.FindBatch(&batch.keys[begin], end - begin, &nodes[begin]);
+    for (SizeType j = begin; j < end; ++j) {
+      present[j] = nodes[j] != map.Cend();
+      if (present[j]) grouped[j] = nodes[j]->second;
+    }
+  }
+  SizeType hits = 0;
+  for (SizeType i = 0; i < count; ++i, ++values, ++found) {
+    SizeType j = batch.slot[i];
+    *found = present[j];
+    if (present[j]) {
+      *values = grouped[j];
+      ++hits;
+    }
+  }
+  return hits;
+}
+
+// ConcurrentMap Capacity
+template <class K, class V, size_t Shards, class Hash>
+bool ConcurrentMap<K, V, Shards, Hash>::Empty() const {
+  for (const Shard& shard : shards_) {
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    if (!shard.map.Empty()) return false;
+  }
+  return true;
+}
+
+template <class K, class V, size_t Shards, class Hash>
+typename ConcurrentMap<K, V, Shards, Hash>::SizeType
+ConcurrentMap<K, V, Shards, Hash>::Size() const {
+  SizeType size = 0;
+  for (const Shard& shard : shards_) {
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    size += shard.map.Size();
+  }
+  return size;
+}
+
+// ConcurrentMap Modifiers
+template <class K, class V, size_t Shards, class Hash>
+bool ConcurrentMap<K, V, Shards, Hash>::Insert(const K& key, const V& value) {
+  Shard& shard = ShardFor(key);
+  std::unique_lock<std::shared_mutex> lock(shard.mutex);
+  if (shard.map.Contains(key)) return false;
+  shard.map.Insert(key, value);
+  return true;
+}
+
+template <class K, class V, size_t Shards, class Hash>
+bool ConcurrentMap<K, V, Shards, Hash>::InsertOrAssign(const K& key,
+                                                       const V& value) {
+  Shard& shard = ShardFor(key);
+  std::unique_lock<std::shared_mutex> lock(shard.mutex);
+  auto it = shard.map.Find(key);
+  if (it != shard.map.End()) {
+    it->second = value;
+    return false;
+  }
+  shard.map.Insert(key, value);
+  return true;
+}
+
+template <class K, class V, size_t Shards, class Hash>
+bool ConcurrentMap<K, V, Shards, Hash>::Erase(const K& key) {
+  Shard& shard = ShardFor(key);
+  std::unique_lock<std::shared_mutex> lock(shard.mutex);
+  auto it = shard.map.Find(key);
+  if (it == shard.map.End()) return false;
+  shard.map.Erase(it);
+  return true;
+}
+
+template <class K, class V, size_t Shards, class Hash>
+template <class Fn>
+bool ConcurrentMap<K, V, Shards, Hash>::Compute(const K& key, Fn fn) {
+  Shard& shard = ShardFor(key);
+  std::unique_lock<std::shared_mutex> lock(shard.mutex);
+  auto it = shard.map.Find(key);
+  if (it == shard.map.End()) it = shard.map.Insert(key, V()).first;
+  if (fn(it->second)) return true;
+  shard.map.Erase(it);
+  return false;
+}
+
+template <class K, class V, size_t Shards, class Hash>
+void ConcurrentMap<K, V, Shards, Hash>::Clear() {
+  for (Shard& shard : shards_) {
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    shard.map.Clear();
+  }
+}
+
+// Shards are always locked in index order, so two ForEach calls cannot
+// deadlock on each other
+template <class K, class V, size_t Shards, class Hash>
+template <class Fn>
+void ConcurrentMap<K, V, Shards, Hash>::ForEach(Fn fn) const {
+  for (const Shard& shard : shards_) shard.mutex.lock_shared();
+  try {
+    for (const Shard& shard : shards_) {
+      for (auto it = shard.map.Cbegin(); it != shard.map.Cend(); ++it) {
+        fn(it->first, it->second);
+      }
+    }
+  } catch (...) {
+    for (const Shard& shard : shards_) shard.mutex.unlock_shared();
+    throw;
+  }
+  for (const Shard& shard : shards_) shard.mutex.unlock_shared();
+}
+
+// Support functions
+// std::hash of an integer is usually the integer itself, so the hash is
+// scrambled before it picks a shard
+template <class K, class V, size_t Shards, class Hash>
+typename ConcurrentMap<K, V, Shards, Hash>::SizeType
+ConcurrentMap<K, V, Shards, Hash>::ShardIndex(const K& key) const {
+  std::uint64_t mixed =
+      static_cast<std::uint64_t>(hash_(key)) * 0x9E3779B97F4A7C15ULL;
+  return (mixed >> 32) % Shards;
+}
+
+// A counting sort of the keys by shard
+template <class K, class V, size_t Shards, class Hash>
+template <class ForwardIt>
+void ConcurrentMap<K, V, Shards, Hash>::Group(ForwardIt keys, SizeType count,
+                                              Batch& batch) const {
+  Vector<SizeType> shard(count);
+  ForwardIt it = keys;
+  for (SizeType i = 0; i < count; ++i, ++it) {
+    shard[i] = ShardIndex(*it);
+    ++batch.begin[shard[i] + 1];
+  }
+  SizeType next[Shards];
+  for (SizeType s = 0; s < Shards; ++s) {
+    batch.begin[s + 1] += batch.begin[s];
+    next[s] = batch.begin[s];
+  }
+  batch.keys = Vector<K>(count);
+  batch.slot = Vector<SizeType>(count);
+  it = keys;
+  for (SizeType i = 0; i < count; ++i, ++it) {
+    SizeType j = next[shard[i]]++;
+    batch.keys[j] = *it;
+    batch.slot[i] = j;
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_CONCURRENT_MAP_H_
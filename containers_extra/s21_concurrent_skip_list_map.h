@@ -0,0 +1,427 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_CONCURRENT_SKIP_LIST_MAP_H_
+#define SRC_CONTAINERS_EXTRA_S21_CONCURRENT_SKIP_LIST_MAP_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_epoch.h"
+
+namespace s21 {
+// Ordered map shared between threads without any lock: a skip list whose
+// links are compare-and-swapped (Herlihy and Shavit's lock-free skip list).
+// A node is erased in two steps: marking the low bit of its links removes
+// it logically, and any traversal that meets a marked node unlinks it.
+//
+// Unlinked nodes are freed through an Epoch. Every operation and every live
+// iterator pins it, so iterators hold back reclamation and should not be
+// kept around longer than needed, nor passed to another thread.
+//
+// Iteration is weakly consistent: it never returns an element twice and
+// sees every element present for the whole walk, but may or may not see
+// those inserted or erased meanwhile. A value never changes once inserted;
+// replace it with Erase followed by Insert.
+template <class K, class V>
+class ConcurrentSkipListMap {
+  struct Node;
+
+ public:
+  // ConcurrentSkipListMap Member type
+  using KeyType = K;
+  using MappedType = V;
+  using ValueType = std::pair<const K, V>;
+  using ConstReference = const ValueType&;
+  using SizeType = size_t;
+
+  // internal class ConcurrentSkipListMapConstIterator
+  class ConstIterator {
+    friend class ConcurrentSkipListMap;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = ValueType;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const ValueType*;
+    using reference = const ValueType&;
+
+    ConstIterator() = default;
+
+    reference operator*() const noexcept { return node_->value_; }
+    pointer operator->() const noexcept { return &node_->value_; }
+
+    ConstIterator& operator++() noexcept {
+      node_ = NextLive(node_->Links()[0]);
+      return *this;
+    }
+
+    ConstIterator operator++(int) noexcept {
+      ConstIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    bool operator==(const ConstIterator& other) const noexcept {
+      return node_ == other.node_;
+    }
+
+    bool operator!=(const ConstIterator& other) const noexcept {
+      return node_ != other.node_;
+    }
+
+   private:
+    explicit ConstIterator(const ConcurrentSkipListMap* map)
+        : guard_(map->epoch_) {}
+
+    Epoch::Guard guard_;
+    Node* node_ = nullptr;
+  };
+
+  using Iterator = ConstIterator;
+
+  // ConcurrentSkipListMap Member functions
+  ConcurrentSkipListMap() = default;
+  ConcurrentSkipListMap(const ConcurrentSkipListMap& m) = delete;
+  ConcurrentSkipListMap& operator=(const ConcurrentSkipListMap& m) = delete;
+  ~ConcurrentSkipListMap();
+
+  // ConcurrentSkipListMap Lookup
+  ConstIterator Find(const K& key) const;
+  // Copies the value to out; false if the key is absent
+  bool Find(const K& key, V& out) const;
+  bool Contains(const K& key) const;
+  // Throws std::out_of_range if the key is absent
+  V At(const K& key) const;
+  // First element whose key is not less than key
+  ConstIterator LowerBound(const K& key) const;
+
+  // ConcurrentSkipListMap Iterators
+  ConstIterator Begin() const { return Cbegin(); }
+  ConstIterator End() const { return ConstIterator(); }
+  ConstIterator Cbegin() const;
+  ConstIterator Cend() const { return ConstIterator(); }
+
+  // ConcurrentSkipListMap Capacity
+  // Both are maintained next to the links, so they may lag behind them by
+  // the operations still in flight
+  bool Empty() const { return Size() == 0; }
+  SizeType Size() const { return size_.load(std::memory_order_relaxed); }
+
+  // ConcurrentSkipListMap Modifiers
+  // Leaves an existing value alone and returns false
+  bool Insert(const K& key, const V& value);
+  bool Erase(const K& key);
+
+ private:
+  using Link = std::atomic<std::uintptr_t>;
+
+  static constexpr int kMaxHeight = 16;
+
+  struct Node {
+    ValueType value_;
+    int height_;
+    // The inserting and the erasing thread each drop one; the last retires
+    // the node, once both are done linking and unlinking it
+    std::atomic<int> owners_{2};
+
+    Node(const K& key, const V& value, int height)
+        : value_(key, value), height_(height) {}
+
+    Link* Links() {
+      return reinterpret_cast<Link*>(reinterpret_cast<char*>(this) +
+                                     LinksOffset());
+    }
+    static constexpr size_t LinksOffset() {
+      return (sizeof(Node) + alignof(Link) - 1) / alignof(Link) *
+             alignof(Link);
+    }
+  };
+
+  Link head_[kMaxHeight] = {};
+  std::atomic<SizeType> size_{0};
+  mutable Epoch epoch_;
+
+  // Support functions
+  static Node* Address(std::uintptr_t link) {
+    return reinterpret_cast<Node*>(link & ~std::uintptr_t(1));
+  }
+  static bool Marked(std::uintptr_t link) { return link & 1; }
+  static Node* NextLive(const Link& link);
+  static Node* NewNode(const K& key, const V& value, int height);
+  static void DeleteNode(Node* node);
+  static void DeleteRetired(void* node);
+  static int RandomHeight();
+  bool Locate(const K& key, Link** preds, Node** succs);
+  Node* LowerNode(const K& key) const;
+  void Release(Node* node);
+};
+
+// ConcurrentSkipListMap Member functions
+template <class K, class V>
+ConcurrentSkipListMap<K, V>::~ConcurrentSkipListMap() {
+  Node* node = Address(head_[0].load(std::memory_order_relaxed));
+  while (node) {
+    Node* next = Address(node->Links()[0].load(std::memory_order_relaxed));
+    DeleteNode(node);
+    node = next;
+  }
+}
+
+// ConcurrentSkipListMap Lookup
+template <class K, class V>
+typename ConcurrentSkipListMap<K, V>::ConstIterator
+ConcurrentSkipListMap<K, V>::Find(const K& key) const {
+  ConstIterator it(this);
+  Node* node = LowerNode(key);
+  if (node && !(key < node->value_.first)) it.node_ = node;
+  return it;
+}
+
+template <class K, class V>
+bool ConcurrentSkipListMap<K, V>::Find(const K& key, V& out) const {
+  Epoch::Guard guard(epoch_);
+  Node* node = LowerNode(key);
+  if (!node || key < node->value_.first) return false;
+  out = node->value_.second;
+  return true;
+}
+
+template <class K, class V>
+bool ConcurrentSkipListMap<K, V>::Contains(const K& key) const {
+  Epoch::Guard guard(epoch_);
+  Node* node = LowerNode(key);
+  return node && !(key < node->value_.first);
+}
+
+template <class K, class V>
+V ConcurrentSkipListMap<K, V>::At(const K& key) const {
+  Epoch::Guard guard(epoch_);
+  Node* node = LowerNode(key);
+  if (!node || key < node->value_.first) {
+    throw std::out_of_range("This element is not exists");
+  }
+  return node->value_.second;
+}
+
+template <class K, class V>
+typename ConcurrentSkipListMap<K, V>::ConstIterator
+ConcurrentSkipListMap<K, V>::LowerBound(const K& key) const {
+  ConstIterator it(this);
+  it.node_ = LowerNode(key);
+  return it;
+}
+
+// ConcurrentSkipListMap Iterators
+template <class K, class V>
+typename ConcurrentSkipListMap<K, V>::ConstIterator
+ConcurrentSkipListMap<K, V>::Cbegin() const {
+  ConstIterator it(this);
+  it.node_ = NextLive(head_[0]);
+  return it;
+}
+
+// ConcurrentSkipListMap Modifiers
+// The node is published by linking it at the bottom level, which is when
+// the key becomes visible; the upper levels only speed up searches and are
+// linked afterwards, one compare-and-swap each
+template <class K, class V>
+bool ConcurrentSkipListMap<K, V>::Insert(const K& key, const V& value) {
+  Epoch::Guard guard(epoch_);
+  Link* preds[kMaxHeight];
+  Node* succs[kMaxHeight];
+  Node* node = nullptr;
+  while (true) {
+    if (Locate(key, preds, succs)) {
+      if (node) DeleteNode(node);
+      return false;
+    }
+    if (!node) node = NewNode(key, value, RandomHeight());
+    for (int level = 0; level < node->height_; ++level) {
+      node->Links()[level].store(reinterpret_cast<std::uintptr_t>(succs[level]),
+                                 std::memory_order_relaxed);
+    }
+    std::uintptr_t expected = reinterpret_cast<std::uintptr_t>(succs[0]);
+    if (preds[0]->compare_exchange_strong(
+            expected, reinterpret_cast<std::uintptr_t>(node),
+            std::memory_order_release, std::memory_order_relaxed)) {
+      break;
+    }
+  }
+  size_.fetch_add(1, std::memory_order_relaxed);
+  for (int level = 1; level < node->height_; ++level) {
+    Link& link = node->Links()[level];
+    while (true) {
+      std::uintptr_t next = link.load(std::memory_order_acquire);
+      if (Marked(next)) break;
+      std::uintptr_t succ = reinterpret_cast<std::uintptr_t>(succs[level]);
+      if (next != succ && !link.compare_exchange_strong(next, succ)) continue;
+      if (preds[level]->compare_exchange_strong(
+              succ, reinterpret_cast<std::uintptr_t>(node),
+              std::memory_order_release, std::memory_order_relaxed)) {
+        break;
+      }
+      Locate(key, preds, succs);
+      if (succs[0] != node) break;
+    }
+    if (Marked(link.load(std::memory_order_acquire))) break;
+  }
+  // An Erase that ran while the upper levels were being linked may have
+  // missed some of them
+  if (Marked(node->Links()[0].load(std::memory_order_acquire))) {
+    Locate(key, preds, succs);
+  }
+  Release(node);
+  return true;
+}
+
+// The links are marked from the top down; whoever marks the bottom one has
+// erased the key
+template <class K, class V>
+bool ConcurrentSkipListMap<K, V>::Erase(const K& key) {
+  Epoch::Guard guard(epoch_);
+  Link* preds[kMaxHeight];
+  Node* succs[kMaxHeight];
+  if (!Locate(key, preds, succs)) return false;
+  Node* victim = succs[0];
+  for (int level = victim->height_ - 1; level >= 0; --level) {
+    Link& link = victim->Links()[level];
+    std::uintptr_t next = link.load(std::memory_order_relaxed);
+    while (!Marked(next) && !link.compare_exchange_weak(next, next | 1)) {
+    }
+    if (level == 0 && Marked(next)) return false;
+  }
+  size_.fetch_sub(1, std::memory_order_relaxed);
+  Locate(key, preds, succs);
+  Release(victim);
+  return true;
+}
+
+// Support functions
+template <class K, class V>
+typename ConcurrentSkipListMap<K, V>::Node*
+ConcurrentSkipListMap<K, V>::NextLive(const Link& link) {
+  Node* node = Address(link.load(std::memory_order_acquire));
+  while (node) {
+    std::uintptr_t next = node->Links()[0].load(std::memory_order_acquire);
+    if (!Marked(next)) break;
+    node = Address(next);
+  }
+  return node;
+}
+
+template <class K, class V>
+typename ConcurrentSkipListMap<K, V>::Node*
+ConcurrentSkipListMap<K, V>::NewNode(const K& key, const V& value,
+                                     int height) {
+  void* raw = ::operator new(Node::LinksOffset() + height * sizeof(Link));
+  Node* node;
+  try {
+    node = new (raw) Node(key, value, height);
+  } catch (...) {
+    ::operator delete(raw);
+    throw;
+  }
+  for (int level = 0; level < height; ++level) new (node->Links() + level) Link;
+  return node;
+}
+
+template <class K, class V>
+void ConcurrentSkipListMap<K, V>::DeleteNode(Node* node) {
+  node->~Node();
+  ::operator delete(node);
+}
+
+template <class K, class V>
+void ConcurrentSkipListMap<K, V>::DeleteRetired(void* node) {
+  DeleteNode(static_cast<Node*>(node));
+}
+
+// Each level holds a quarter of the nodes of the one below
+template <class K, class V>
+int ConcurrentSkipListMap<K, V>::RandomHeight() {
+  thread_local std::uint64_t state =
+      0x9E3779B97F4A7C15ULL ^ reinterpret_cast<std::uintptr_t>(&state);
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  std::uint64_t bits = state;
+  int height = 1;
+  while (height < kMaxHeight && (bits & 3) == 0) {
+    ++height;
+    bits >>= 2;
+  }
+  return height;
+}
+
+// Fills preds and succs with the links and nodes around key on every level,
+// unlinking the marked nodes on the way, and returns whether the bottom
+// level holds key. Starts over when a link it tried to swing turns out to
+// belong to a node erased meanwhile.
+template <class K, class V>
+bool ConcurrentSkipListMap<K, V>::Locate(const K& key, Link** preds,
+                                         Node** succs) {
+retry:
+  Link* pred = head_;
+  for (int level = kMaxHeight - 1; level >= 0; --level) {
+    Node* curr = Address(pred[level].load(std::memory_order_acquire));
+    while (curr) {
+      std::uintptr_t next =
+          curr->Links()[level].load(std::memory_order_acquire);
+      if (Marked(next)) {
+        std::uintptr_t expected = reinterpret_cast<std::uintptr_t>(curr);
+        if (!pred[level].compare_exchange_strong(
+                expected, next & ~std::uintptr_t(1), std::memory_order_acq_rel,
+                std::memory_order_relaxed)) {
+          goto retry;
+        }
+        curr = Address(next);
+      } else if (curr->value_.first < key) {
+        pred = curr->Links();
+        curr = Address(next);
+      } else {
+        break;
+      }
+    }
+    preds[level] = pred + level;
+    succs[level] = curr;
+  }
+  return succs[0] && !(key < succs[0]->value_.first);
+}
+
+// Read-only search that steps over marked nodes instead of unlinking them
+template <class K, class V>
+typename ConcurrentSkipListMap<K, V>::Node*
+ConcurrentSkipListMap<K, V>::LowerNode(const K& key) const {
+  const Link* pred = head_;
+  Node* curr = nullptr;
+  for (int level = kMaxHeight - 1; level >= 0; --level) {
+    curr = Address(pred[level].load(std::memory_order_acquire));
+    while (curr) {
+      std::uintptr_t next =
+          curr->Links()[level].load(std::memory_order_acquire);
+      if (Marked(next)) {
+        curr = Address(next);
+      } else if (curr->value_.first < key) {
+        pred = curr->Links();
+        curr = Address(next);
+      } else {
+        break;
+      }
+    }
+  }
+  return curr;
+}
+
+template <class K, class V>
+void ConcurrentSkipListMap<K, V>::Release(Node* node) {
+  if (node->owners_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    epoch_.Retire(node, &DeleteRetired);
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_CONCURRENT_SKIP_LIST_MAP_H_
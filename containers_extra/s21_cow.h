@@ -0,0 +1,98 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_COW_H_
+#define SRC_CONTAINERS_EXTRA_S21_COW_H_
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace s21 {
+// Copy-on-write holder behind CowVector and CowMap. Copies share one
+// container, counted atomically, and the first Write on a shared holder
+// clones it, so a value passed by copy costs one increment until somebody
+// changes it. Distinct holders may be used from different threads even
+// while they share a container; one holder is no more thread-safe than the
+// container it holds.
+//
+// An empty holder owns nothing, so default construction and moves do not
+// allocate.
+template <class C>
+class Cow {
+  struct Block {
+    std::atomic<size_t> refs{1};
+    C value;
+
+    Block() = default;
+    explicit Block(const C& v) : value(v) {}
+    explicit Block(C&& v) : value(std::move(v)) {}
+  };
+
+ public:
+  // Cow Member type
+  using SizeType = size_t;
+
+  // Cow Member functions
+  Cow() = default;
+  explicit Cow(C&& value) : block_(new Block(std::move(value))) {}
+  Cow(const Cow& other) : block_(other.block_) {
+    if (block_) block_->refs.fetch_add(1, std::memory_order_relaxed);
+  }
+  Cow(Cow&& other) noexcept : block_(other.block_) { other.block_ = nullptr; }
+  Cow& operator=(Cow other) noexcept {
+    std::swap(block_, other.block_);
+    return *this;
+  }
+  ~Cow() { Release(); }
+
+  // Cow Element access
+  const C& Read() const { return block_ ? block_->value : Empty(); }
+  // Clones the container first if it is shared
+  C& Write();
+
+  // Cow Capacity
+  // Holders sharing the container, 0 for an empty holder
+  SizeType UseCount() const {
+    return block_ ? block_->refs.load(std::memory_order_acquire) : 0;
+  }
+
+  // Cow Modifiers
+  // Drops this holder's share without cloning
+  void Reset() {
+    Release();
+    block_ = nullptr;
+  }
+  void Swap(Cow& other) noexcept { std::swap(block_, other.block_); }
+
+ private:
+  Block* block_ = nullptr;
+
+  // Support functions
+  static const C& Empty() {
+    static const C empty;
+    return empty;
+  }
+  void Release() {
+    if (block_ && block_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete block_;
+    }
+  }
+};
+
+// Cow Element access
+// The acquire load pairs with the release of the other holders, so once
+// the count is back to one their reads are over and the container may be
+// changed in place
+template <class C>
+C& Cow<C>::Write() {
+  if (!block_) {
+    block_ = new Block;
+  } else if (block_->refs.load(std::memory_order_acquire) != 1) {
+    Block* copy = new Block(block_->value);
+    Release();
+    block_ = copy;
+  }
+  return block_->value;
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_COW_H_
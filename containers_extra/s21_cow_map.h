@@ -0,0 +1,113 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_COW_MAP_H_
+#define SRC_CONTAINERS_EXTRA_S21_COW_MAP_H_
+
+#include <initializer_list>
+#include <utility>
+
+#include "../containers/s21_map.h"
+#include "s21_cow.h"
+
+namespace s21 {
+// Map with copy-on-write storage: a copy shares the tree and the first
+// change made through either copy clones it. Lookups are const and never
+// clone, so a stage that only looks things up in what it was passed by
+// value copies nothing.
+//
+// Only the modifiers, operator[] and Mutate clone a shared tree. A reference
+// they hand out stays tied to this tree: it must not be written through
+// once the map has been copied again.
+template <class K, class V>
+class CowMap {
+  using Storage = Map<K, V>;
+
+ public:
+  // CowMap Member type
+  using KeyType = K;
+  using MappedType = V;
+  using ValueType = std::pair<const K, V>;
+  using Reference = ValueType&;
+  using ConstReference = const ValueType&;
+  using SizeType = size_t;
+  using Iterator = typename Storage::Iterator;
+  using ConstIterator = typename Storage::ConstIterator;
+  using Pair = std::pair<Iterator, bool>;
+
+  // CowMap Member functions
+  CowMap() = default;
+  CowMap(std::initializer_list<ValueType> const& items)
+      : cow_(Storage(items)) {}
+  // Takes over the tree of m
+  explicit CowMap(Storage&& m) : cow_(std::move(m)) {}
+
+  // CowMap Element access
+  const V& At(const K& key) const { return cow_.Read().At(key); }
+  // Inserts V() if the key is absent; clones a shared tree even to read
+  V& operator[](const K& key) { return cow_.Write()[key]; }
+  // The shared map itself, for code that takes an s21::Map
+  const Storage& Get() const { return cow_.Read(); }
+  // The map itself, cloned if shared, for changes in place
+  Storage& Mutate() { return cow_.Write(); }
+
+  // CowMap Iterators
+  ConstIterator Begin() const { return cow_.Read().Cbegin(); }
+  ConstIterator End() const { return cow_.Read().Cend(); }
+  ConstIterator Cbegin() const { return cow_.Read().Cbegin(); }
+  ConstIterator Cend() const { return cow_.Read().Cend(); }
+
+  // CowMap Capacity
+  bool Empty() const { return cow_.Read().Empty(); }
+  SizeType Size() const { return cow_.Read().Size(); }
+  SizeType MaxSize() const { return cow_.Read().MaxSize(); }
+  // Copies sharing the tree, this one included
+  SizeType UseCount() const { return cow_.UseCount(); }
+
+  // CowMap Modifiers
+  // Drops the share without cloning it
+  void Clear() { cow_.Reset(); }
+  Pair Insert(const ValueType& value) { return cow_.Write().Insert(value); }
+  Pair Insert(const K& key, const V& obj) {
+    return cow_.Write().Insert(key, obj);
+  }
+  Pair InsertOrAssign(const K& key, const V& obj) {
+    return cow_.Write().InsertOrAssign(key, obj);
+  }
+  // pos must come from this map, though possibly before it was cloned: the
+  // entry is erased by its key
+  void Erase(ConstIterator pos) { Erase(pos->first); }
+  // Clones a shared tree only when the key is there; false if it is not
+  bool Erase(const K& key);
+  void Swap(CowMap& other) { cow_.Swap(other.cow_); }
+  void Merge(const CowMap& other);
+
+  // CowMap Lookup
+  ConstIterator Find(const K& key) const { return cow_.Read().Find(key); }
+  bool Contains(const K& key) const { return cow_.Read().Contains(key); }
+
+ private:
+  Cow<Storage> cow_;
+};
+
+// CowMap Modifiers
+template <class K, class V>
+bool CowMap<K, V>::Erase(const K& key) {
+  if (!Contains(key)) return false;
+  Storage& map = cow_.Write();
+  map.Erase(map.Find(key));
+  return true;
+}
+
+// Keeps the values already in this map, as Map::Merge does. Holding a share
+// of other keeps the source intact when other is this map or a copy of it.
+template <class K, class V>
+void CowMap<K, V>::Merge(const CowMap& other) {
+  if (other.Empty()) return;
+  CowMap source = other;
+  Storage& map = cow_.Write();
+  for (auto it = source.Cbegin(); it != source.Cend(); ++it) {
+    map.Insert(it->first, it->second);
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_COW_MAP_H_
@@ -0,0 +1,160 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_COW_VECTOR_H_
+#define SRC_CONTAINERS_EXTRA_S21_COW_VECTOR_H_
+
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "../containers/s21_vector.h"
+#include "s21_cow.h"
+
+namespace s21 {
+// Vector with copy-on-write storage: a copy shares the buffer and the first
+// change made through either copy clones it. Accessors other than
+// operator[] are const and never clone, so a stage that only reads what it
+// was passed by value copies nothing.
+//
+// Only the modifiers, the non-const operator[] and Mutate clone a shared
+// buffer. A reference they hand out stays tied to this buffer: it must not
+// be written through once the vector has been copied again. Iterators hold
+// an index instead, so a clone does not invalidate them; they belong to
+// this CowVector object rather than to its buffer.
+template <class T>
+class CowVector {
+  using Storage = Vector<T>;
+
+ public:
+  // CowVector Member type
+  using ValueType = T;
+  using Reference = T&;
+  using ConstReference = const T&;
+  using SizeType = size_t;
+
+  // internal class CowVectorConstIterator
+  class CowVectorConstIterator {
+    friend class CowVector;
+
+   public:
+    CowVectorConstIterator() = default;
+
+    CowVectorConstIterator(const CowVector* owner, SizeType index)
+        : owner_(owner), index_(index) {}
+
+    CowVectorConstIterator& operator--() noexcept {
+      --index_;
+      return *this;
+    }
+
+    CowVectorConstIterator& operator++() noexcept {
+      ++index_;
+      return *this;
+    }
+
+    CowVectorConstIterator operator+(SizeType n) const noexcept {
+      return CowVectorConstIterator(owner_, index_ + n);
+    }
+
+    bool operator==(const CowVectorConstIterator& other) const noexcept {
+      return owner_ == other.owner_ && index_ == other.index_;
+    }
+
+    bool operator!=(const CowVectorConstIterator& other) const noexcept {
+      return !(*this == other);
+    }
+
+    ConstReference operator*() const { return (*owner_)[index_]; }
+
+   private:
+    const CowVector* owner_ = nullptr;
+    SizeType index_ = 0;
+  };
+
+  // Elements are written through operator[] or Mutate, so both are const
+  using ConstIterator = CowVectorConstIterator;
+  using Iterator = ConstIterator;
+
+  // CowVector Member functions
+  CowVector() = default;
+  explicit CowVector(SizeType n) : cow_(Storage(n)) {}
+  CowVector(std::initializer_list<ValueType> const& items)
+      : cow_(Storage(items)) {}
+  // Takes over the buffer of v
+  explicit CowVector(Storage&& v) : cow_(std::move(v)) {}
+
+  // CowVector Element access
+  ConstReference At(SizeType pos) const;
+  // The write accessor: clones a shared buffer even to read
+  Reference operator[](SizeType pos) { return cow_.Write()[pos]; }
+  ConstReference operator[](SizeType pos) const { return cow_.Read()[pos]; }
+  ConstReference Front() const { return cow_.Read().Front(); }
+  ConstReference Back() const { return cow_.Read().Back(); }
+  const T* Data() const { return Empty() ? nullptr : &cow_.Read()[0]; }
+  // The shared vector itself, for code that takes an s21::Vector
+  const Storage& Get() const { return cow_.Read(); }
+  // The vector itself, cloned if shared, for changes in place
+  Storage& Mutate() { return cow_.Write(); }
+
+  // CowVector Iterators
+  ConstIterator Begin() const { return ConstIterator(this, 0); }
+  ConstIterator End() const { return ConstIterator(this, Size()); }
+  ConstIterator Cbegin() const { return Begin(); }
+  ConstIterator Cend() const { return End(); }
+
+  // CowVector Capacity
+  bool Empty() const { return cow_.Read().Empty(); }
+  SizeType Size() const { return cow_.Read().Size(); }
+  SizeType MaxSize() const { return cow_.Read().MaxSize(); }
+  void Reserve(SizeType size) { cow_.Write().Reserve(size); }
+  SizeType Capacity() const { return cow_.Read().Capacity(); }
+  void ShrinkToFit() { cow_.Write().ShrinkToFit(); }
+  // Copies sharing the buffer, this one included
+  SizeType UseCount() const { return cow_.UseCount(); }
+
+  // CowVector Modifiers
+  // Drops the share without cloning it
+  void Clear() { cow_.Reset(); }
+  // pos must come from this vector
+  ConstIterator Insert(ConstIterator pos, ConstReference value);
+  void Erase(ConstIterator pos);
+  void PushBack(ConstReference value) { cow_.Write().PushBack(value); }
+  void PushBack(ValueType&& value) {
+    cow_.Write().PushBack(std::move(value));
+  }
+  void PopBack() { cow_.Write().PopBack(); }
+  void Swap(CowVector& other) { cow_.Swap(other.cow_); }
+
+  // Bonus functions
+  template <typename... Args>
+  void EmplaceBack(Args&&... args) {
+    cow_.Write().EmplaceBack(std::forward<Args>(args)...);
+  }
+
+ private:
+  Cow<Storage> cow_;
+};
+
+// CowVector Element access
+template <class T>
+typename CowVector<T>::ConstReference CowVector<T>::At(SizeType pos) const {
+  if (pos >= Size()) throw std::out_of_range("This index is out of range");
+  return cow_.Read()[pos];
+}
+
+// CowVector Modifiers
+template <class T>
+typename CowVector<T>::ConstIterator CowVector<T>::Insert(
+    ConstIterator pos, ConstReference value) {
+  Storage& vector = cow_.Write();
+  vector.Insert(vector.Begin() + pos.index_, value);
+  return pos;
+}
+
+template <class T>
+void CowVector<T>::Erase(ConstIterator pos) {
+  Storage& vector = cow_.Write();
+  vector.Erase(vector.Begin() + pos.index_);
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_COW_VECTOR_H_
@@ -0,0 +1,440 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_DEQUE_H_
+#define SRC_CONTAINERS_EXTRA_S21_DEQUE_H_
+
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+template <class T>
+class Deque {
+ public:
+  // Deque Member type
+  using ValueType = T;
+  using Pointer = T*;
+  using Reference = T&;
+  using ConstReference = const T&;
+  using SizeType = size_t;
+  using DifferenceType = std::ptrdiff_t;
+
+  // Elements live in fixed-size blocks, the block map only holds pointers to
+  // them, so growing the map never moves an element
+  static constexpr SizeType kBlockSize =
+      sizeof(T) < 32 ? 512 / sizeof(T) : 16;
+
+  // internal class DequeIterator
+  template <class Value>
+  class DequeIteratorBase {
+    friend class Deque;
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = DifferenceType;
+    using pointer = Value*;
+    using reference = Value&;
+
+    DequeIteratorBase() = default;
+    DequeIteratorBase(Pointer* map, SizeType index)
+        : map_(map), index_(index) {}
+
+    reference operator*() const noexcept {
+      return map_[index_ / kBlockSize][index_ % kBlockSize];
+    }
+
+    pointer operator->() const noexcept { return &**this; }
+
+    reference operator[](DifferenceType n) const noexcept {
+      return *(*this + n);
+    }
+
+    DequeIteratorBase& operator++() noexcept {
+      ++index_;
+      return *this;
+    }
+
+    DequeIteratorBase operator++(int) noexcept {
+      DequeIteratorBase tmp = *this;
+      ++index_;
+      return tmp;
+    }
+
+    DequeIteratorBase& operator--() noexcept {
+      --index_;
+      return *this;
+    }
+
+    DequeIteratorBase operator--(int) noexcept {
+      DequeIteratorBase tmp = *this;
+      --index_;
+      return tmp;
+    }
+
+    DequeIteratorBase& operator+=(DifferenceType n) noexcept {
+      index_ += n;
+      return *this;
+    }
+
+    DequeIteratorBase& operator-=(DifferenceType n) noexcept {
+      index_ -= n;
+      return *this;
+    }
+
+    DequeIteratorBase operator+(DifferenceType n) const noexcept {
+      return DequeIteratorBase(map_, index_ + n);
+    }
+
+    DequeIteratorBase operator-(DifferenceType n) const noexcept {
+      return DequeIteratorBase(map_, index_ - n);
+    }
+
+    DifferenceType operator-(const DequeIteratorBase& other) const noexcept {
+      return static_cast<DifferenceType>(index_) -
+             static_cast<DifferenceType>(other.index_);
+    }
+
+    bool operator==(const DequeIteratorBase& other) const noexcept {
+      return index_ == other.index_;
+    }
+
+    bool operator!=(const DequeIteratorBase& other) const noexcept {
+      return index_ != other.index_;
+    }
+
+    bool operator<(const DequeIteratorBase& other) const noexcept {
+      return index_ < other.index_;
+    }
+
+    bool operator>(const DequeIteratorBase& other) const noexcept {
+      return index_ > other.index_;
+    }
+
+    bool operator<=(const DequeIteratorBase& other) const noexcept {
+      return index_ <= other.index_;
+    }
+
+    bool operator>=(const DequeIteratorBase& other) const noexcept {
+      return index_ >= other.index_;
+    }
+
+   private:
+    Pointer* map_ = nullptr;
+    SizeType index_ = 0;
+  };
+
+  using Iterator = DequeIteratorBase<ValueType>;
+  using ConstIterator = DequeIteratorBase<const ValueType>;
+
+  // Deque Member functions
+  Deque() = default;
+  explicit Deque(SizeType n);
+  Deque(std::initializer_list<ValueType> const& items);
+  Deque(const Deque& d);
+  Deque(Deque&& d) noexcept;
+  ~Deque();
+  Deque& operator=(Deque&& d) noexcept;
+
+  // Deque Element access
+  Reference At(SizeType pos);
+  Reference operator[](SizeType pos);
+  ConstReference operator[](SizeType pos) const;
+  ConstReference Front() const;
+  ConstReference Back() const;
+
+  // Deque Iterators
+  Iterator Begin();
+  Iterator End();
+  ConstIterator Cbegin() const;
+  ConstIterator Cend() const;
+
+  // Deque Capacity
+  bool Empty() const;
+  SizeType Size() const;
+  SizeType MaxSize();
+  void ShrinkToFit();
+
+  // Deque Modifiers
+  void Clear();
+  void PushBack(ConstReference value);
+  void PopBack();
+  void PushFront(ConstReference value);
+  void PopFront();
+  void Swap(Deque& other);
+
+  template <typename... Args>
+  void EmplaceBack(Args&&... args);
+  template <typename... Args>
+  void EmplaceFront(Args&&... args);
+
+ private:
+  Pointer* map_ = nullptr;
+  SizeType map_size_ = 0;
+  SizeType start_ = 0;  // index of the first element counted from map_[0]
+  SizeType size_ = 0;
+
+  // Support functions
+  Pointer Slot(SizeType index) const;
+  void ReserveBack();
+  void ReserveFront();
+  void ReMap(SizeType new_map_size);
+  static Pointer AllocateBlock();
+  static void DeallocateBlock(Pointer block);
+};
+
+// Deque Member functions
+template <class T>
+Deque<T>::Deque(SizeType n) {
+  while (n--) {
+    EmplaceBack();
+  }
+}
+
+template <class T>
+Deque<T>::Deque(std::initializer_list<ValueType> const& items) {
+  for (auto it = items.begin(); it != items.end(); ++it) {
+    PushBack(*it);
+  }
+}
+
+template <class T>
+Deque<T>::Deque(const Deque& d) {
+  for (ConstIterator it = d.Cbegin(); it != d.Cend(); ++it) {
+    PushBack(*it);
+  }
+}
+
+template <class T>
+Deque<T>::Deque(Deque&& d) noexcept {
+  Swap(d);
+}
+
+template <class T>
+Deque<T>::~Deque() {
+  Clear();
+  for (SizeType i = 0; i < map_size_; ++i) {
+    DeallocateBlock(map_[i]);
+  }
+  delete[] map_;
+}
+
+template <class T>
+Deque<T>& Deque<T>::operator=(Deque&& d) noexcept {
+  Clear();
+  Swap(d);
+  return *this;
+}
+
+// Deque Element access
+template <class T>
+typename Deque<T>::Reference Deque<T>::At(SizeType pos) {
+  if (pos >= size_) throw std::out_of_range("This index is out of range");
+  return *Slot(start_ + pos);
+}
+
+template <class T>
+typename Deque<T>::Reference Deque<T>::operator[](SizeType pos) {
+  return *Slot(start_ + pos);
+}
+
+template <class T>
+typename Deque<T>::ConstReference Deque<T>::operator[](SizeType pos) const {
+  return *Slot(start_ + pos);
+}
+
+template <class T>
+typename Deque<T>::ConstReference Deque<T>::Front() const {
+  if (Empty()) {
+    throw std::out_of_range("Container is empty");
+  }
+  return *Slot(start_);
+}
+
+template <class T>
+typename Deque<T>::ConstReference Deque<T>::Back() const {
+  if (Empty()) {
+    throw std::out_of_range("Container is empty");
+  }
+  return *Slot(start_ + size_ - 1);
+}
+
+// Deque Iterators
+template <class T>
+typename Deque<T>::Iterator Deque<T>::Begin() {
+  return Iterator(map_, start_);
+}
+
+template <class T>
+typename Deque<T>::Iterator Deque<T>::End() {
+  return Iterator(map_, start_ + size_);
+}
+
+template <class T>
+typename Deque<T>::ConstIterator Deque<T>::Cbegin() const {
+  return ConstIterator(map_, start_);
+}
+
+template <class T>
+typename Deque<T>::ConstIterator Deque<T>::Cend() const {
+  return ConstIterator(map_, start_ + size_);
+}
+
+// Deque Capacity
+template <class T>
+bool Deque<T>::Empty() const {
+  return size_ == 0;
+}
+
+template <class T>
+typename Deque<T>::SizeType Deque<T>::Size() const {
+  return size_;
+}
+
+template <class T>
+typename Deque<T>::SizeType Deque<T>::MaxSize() {
+  return std::numeric_limits<SizeType>::max() / sizeof(ValueType);
+}
+
+template <class T>
+void Deque<T>::ShrinkToFit() {
+  SizeType first = start_ / kBlockSize;
+  SizeType last = size_ ? (start_ + size_ - 1) / kBlockSize + 1 : first;
+  for (SizeType i = 0; i < map_size_; ++i) {
+    if (i < first || i >= last) {
+      DeallocateBlock(map_[i]);
+      map_[i] = nullptr;
+    }
+  }
+  if (!size_) {
+    delete[] map_;
+    map_ = nullptr;
+    map_size_ = start_ = 0;
+  }
+}
+
+// Deque Modifiers
+template <class T>
+void Deque<T>::Clear() {
+  while (size_) {
+    PopBack();
+  }
+}
+
+template <class T>
+void Deque<T>::PushBack(ConstReference value) {
+  EmplaceBack(value);
+}
+
+template <class T>
+void Deque<T>::PopBack() {
+  if (size_) {
+    Slot(start_ + --size_)->~ValueType();
+  }
+}
+
+template <class T>
+void Deque<T>::PushFront(ConstReference value) {
+  EmplaceFront(value);
+}
+
+template <class T>
+void Deque<T>::PopFront() {
+  if (size_) {
+    Slot(start_++)->~ValueType();
+    --size_;
+  }
+}
+
+template <class T>
+void Deque<T>::Swap(Deque& other) {
+  std::swap(map_, other.map_);
+  std::swap(map_size_, other.map_size_);
+  std::swap(start_, other.start_);
+  std::swap(size_, other.size_);
+}
+
+template <class T>
+template <typename... Args>
+void Deque<T>::EmplaceBack(Args&&... args) {
+  ReserveBack();
+  new (Slot(start_ + size_)) ValueType(std::forward<Args>(args)...);
+  ++size_;
+}
+
+template <class T>
+template <typename... Args>
+void Deque<T>::EmplaceFront(Args&&... args) {
+  ReserveFront();
+  new (Slot(start_ - 1)) ValueType(std::forward<Args>(args)...);
+  --start_;
+  ++size_;
+}
+
+// Support functions
+template <class T>
+typename Deque<T>::Pointer Deque<T>::Slot(SizeType index) const {
+  return map_[index / kBlockSize] + index % kBlockSize;
+}
+
+template <class T>
+void Deque<T>::ReserveBack() {
+  SizeType end = start_ + size_;
+  if (end == map_size_ * kBlockSize) {
+    ReMap(map_size_ ? map_size_ * 2 : 8);
+    end = start_ + size_;
+  }
+  if (!map_[end / kBlockSize]) map_[end / kBlockSize] = AllocateBlock();
+}
+
+template <class T>
+void Deque<T>::ReserveFront() {
+  if (start_ == 0) ReMap(map_size_ ? map_size_ * 2 : 8);
+  SizeType block = (start_ - 1) / kBlockSize;
+  if (!map_[block]) map_[block] = AllocateBlock();
+}
+
+// Centers the used blocks in a map of new_map_size slots. When the used
+// blocks take no more than half of the current map the map is only
+// recentered, so a deque used as a queue does not keep growing. Spare blocks
+// are carried over into the free slots and reused by later pushes.
+template <class T>
+void Deque<T>::ReMap(SizeType new_map_size) {
+  SizeType first = start_ / kBlockSize;
+  SizeType used = size_ ? (start_ + size_ - 1) / kBlockSize + 1 - first : 0;
+  if (map_size_ && used * 2 <= map_size_) new_map_size = map_size_;
+  SizeType offset = (new_map_size - used) / 2;
+  if (offset == 0) offset = 1;
+  if (offset + used >= new_map_size) new_map_size = offset + used + 1;
+
+  Pointer* map = new Pointer[new_map_size]();
+  for (SizeType i = 0; i < used; ++i) {
+    map[offset + i] = map_[first + i];
+  }
+  SizeType free_slot = 0;
+  for (SizeType i = 0; i < map_size_; ++i) {
+    if (map_[i] && (i < first || i >= first + used)) {
+      while (free_slot >= offset && free_slot < offset + used) ++free_slot;
+      map[free_slot++] = map_[i];
+    }
+  }
+  start_ = offset * kBlockSize + start_ % kBlockSize;
+  delete[] map_;
+  map_ = map;
+  map_size_ = new_map_size;
+}
+
+template <class T>
+typename Deque<T>::Pointer Deque<T>::AllocateBlock() {
+  return static_cast<Pointer>(::operator new(sizeof(ValueType) * kBlockSize));
+}
+
+template <class T>
+void Deque<T>::DeallocateBlock(Pointer block) {
+  ::operator delete(block);
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_DEQUE_H_
@@ -0,0 +1,317 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_EPOCH_H_
+#define SRC_CONTAINERS_EXTRA_S21_EPOCH_H_
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+#include "../containers/s21_set.h"
+#include "../containers/s21_vector.h"
+
+namespace s21 {
+// Epoch-based reclamation for lock-free containers: a node unlinked by one
+// thread may still be read by others, so instead of deleting it the
+// container retires it here and it is deleted once no thread can hold it.
+//
+// A thread reads shared nodes only while pinned, through a Guard. The global
+// epoch moves from e to e + 1 once every pinned thread has seen e, so a node
+// retired in epoch e is unreachable to everyone when the epoch reaches
+// e + 2. Every thread keeps its retired nodes in three limbo lists, one per
+// live epoch, and frees a list as a batch once its epoch is old enough.
+//
+// Threads register on their first pin and keep their registration until
+// they exit, when it is handed to the next thread that registers. A Guard
+// belongs to the thread that created it and must be destroyed there.
+class Epoch {
+  struct Record;
+
+ public:
+  // Epoch Member type
+  using SizeType = size_t;
+
+  // Every that many retirements a thread tries to advance the epoch
+  static constexpr SizeType kRetireBatch = 64;
+
+  // Keeps the calling thread pinned while alive; pins nest
+  class Guard {
+   public:
+    Guard() = default;
+    explicit Guard(Epoch& epoch) : epoch_(&epoch) { Pin(); }
+    Guard(const Guard& other) : epoch_(other.epoch_) { Pin(); }
+    Guard(Guard&& other) noexcept;
+    Guard& operator=(Guard other) noexcept;
+    ~Guard() { Unpin(); }
+
+   private:
+    void Pin();
+    void Unpin();
+
+    Epoch* epoch_ = nullptr;
+    Record* record_ = nullptr;
+  };
+
+  // Epoch Member functions
+  Epoch();
+  Epoch(const Epoch& e) = delete;
+  Epoch& operator=(const Epoch& e) = delete;
+  // Deletes everything still retired; no thread may be pinned any more
+  ~Epoch();
+
+  // Epoch Lookup
+  std::uint64_t Current() const { return epoch_.load(); }
+  // Retired pointers not deleted yet, over all threads
+  SizeType Pending() const { return pending_.load(std::memory_order_relaxed); }
+
+  // Epoch Modifiers
+  Guard Pin() { return Guard(*this); }
+  // Deletes pointer with delete once no pinned thread can see it, as List,
+  // Set and Map delete their nodes
+  template <class T>
+  void Retire(T* pointer);
+  void Retire(void* pointer, void (*deleter)(void*));
+  // Moves the epoch on if every pinned thread has seen the current one
+  bool TryAdvance();
+  // Tries to advance and frees what the calling thread may free by now
+  void Collect();
+
+ private:
+  struct Retired {
+    void* pointer = nullptr;
+    void (*deleter)(void*) = nullptr;
+  };
+
+  // One per registered thread. Only state is read by other threads; the
+  // rest belongs to the owner, or to the next thread after in_use is
+  // released.
+  struct alignas(64) Record {
+    // Epoch shifted left by one, low bit set while pinned
+    std::atomic<std::uint64_t> state{0};
+    std::atomic<bool> in_use{true};
+    Record* next = nullptr;
+    SizeType nesting = 0;
+    SizeType retired = 0;
+    Vector<Retired> limbo[3];
+    std::uint64_t limbo_epoch[3] = {};
+  };
+
+  // Records of the calling thread, by the id of their Epoch
+  struct ThreadRecords {
+    Vector<std::pair<std::uint64_t, Record*>> records;
+    std::uint64_t last_id = 0;
+    Record* last = nullptr;
+    ~ThreadRecords();
+    // Drops the records of Epochs destroyed since
+    void Prune();
+  };
+
+  // Ids of the Epochs alive, so that an exiting thread only releases the
+  // records whose Epoch still exists
+  struct Registry {
+    std::mutex mutex;
+    Set<std::uint64_t> live;
+    std::uint64_t next_id = 1;
+  };
+
+  const std::uint64_t id_;
+  std::atomic<std::uint64_t> epoch_{0};
+  std::atomic<Record*> records_{nullptr};
+  std::atomic<SizeType> pending_{0};
+
+  // Support functions
+  static Registry& Live();
+  static ThreadRecords& Local();
+  Record* LocalRecord();
+  Record* Register();
+  void Free(Record* record, SizeType bucket);
+  void Collect(Record* record);
+  template <class T>
+  static void Delete(void* pointer) {
+    delete static_cast<T*>(pointer);
+  }
+};
+
+// Guard
+inline Epoch::Guard::Guard(Guard&& other) noexcept
+    : epoch_(other.epoch_), record_(other.record_) {
+  other.epoch_ = nullptr;
+  other.record_ = nullptr;
+}
+
+inline Epoch::Guard& Epoch::Guard::operator=(Guard other) noexcept {
+  std::swap(epoch_, other.epoch_);
+  std::swap(record_, other.record_);
+  return *this;
+}
+
+// The epoch is read again once the pin is published: either a thread
+// advancing the epoch sees the pin or this thread sees the new epoch
+inline void Epoch::Guard::Pin() {
+  if (!epoch_) return;
+  record_ = epoch_->LocalRecord();
+  if (record_->nesting++ > 0) return;
+  std::uint64_t epoch = epoch_->epoch_.load();
+  while (true) {
+    record_->state.store(epoch << 1 | 1);
+    std::uint64_t current = epoch_->epoch_.load();
+    if (current == epoch) return;
+    epoch = current;
+  }
+}
+
+inline void Epoch::Guard::Unpin() {
+  if (!record_ || --record_->nesting > 0) return;
+  record_->state.store(record_->state.load(std::memory_order_relaxed) & ~1ULL,
+                       std::memory_order_release);
+}
+
+// Epoch Member functions
+inline Epoch::Epoch()
+    : id_([] {
+        Registry& registry = Live();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.live.Insert(registry.next_id);
+        return registry.next_id++;
+      }()) {}
+
+inline Epoch::~Epoch() {
+  {
+    Registry& registry = Live();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.live.Erase(registry.live.Find(id_));
+  }
+  Record* record = records_.load();
+  while (record) {
+    for (SizeType bucket = 0; bucket < 3; ++bucket) Free(record, bucket);
+    Record* next = record->next;
+    delete record;
+    record = next;
+  }
+}
+
+// Epoch Modifiers
+template <class T>
+void Epoch::Retire(T* pointer) {
+  Retire(pointer, &Delete<T>);
+}
+
+// The epoch read here is at least the one the pointer was unlinked in. A
+// list still holding an older epoch dates from three epochs back at most
+// and can be freed before it is reused.
+inline void Epoch::Retire(void* pointer, void (*deleter)(void*)) {
+  Record* record = LocalRecord();
+  std::uint64_t epoch = epoch_.load();
+  SizeType bucket = epoch % 3;
+  if (record->limbo_epoch[bucket] != epoch) {
+    Free(record, bucket);
+    record->limbo_epoch[bucket] = epoch;
+  }
+  record->limbo[bucket].PushBack(Retired{pointer, deleter});
+  pending_.fetch_add(1, std::memory_order_relaxed);
+  if (++record->retired % kRetireBatch == 0) Collect(record);
+}
+
+inline bool Epoch::TryAdvance() {
+  std::uint64_t epoch = epoch_.load();
+  for (Record* record = records_.load(); record; record = record->next) {
+    std::uint64_t state = record->state.load();
+    if ((state & 1) && (state >> 1) != epoch) return false;
+  }
+  epoch_.compare_exchange_strong(epoch, epoch + 1);
+  return true;
+}
+
+inline void Epoch::Collect() { Collect(LocalRecord()); }
+
+// Support functions
+inline Epoch::Registry& Epoch::Live() {
+  static Registry registry;
+  return registry;
+}
+
+inline Epoch::ThreadRecords& Epoch::Local() {
+  thread_local ThreadRecords records;
+  return records;
+}
+
+// Thread-local objects die before static ones, so the registry is still
+// there when the last thread exits
+inline Epoch::ThreadRecords::~ThreadRecords() {
+  Registry& registry = Live();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (SizeType i = 0; i < records.Size(); ++i) {
+    if (registry.live.Contains(records[i].first)) {
+      records[i].second->in_use.store(false, std::memory_order_release);
+    }
+  }
+}
+
+// Ids are never reused, so a record whose Epoch is gone is never looked up
+// again; without this a thread that outlives many Epochs would keep one
+// entry for each, dangling, until it exits
+inline void Epoch::ThreadRecords::Prune() {
+  Registry& registry = Live();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  SizeType kept = 0;
+  for (SizeType i = 0; i < records.Size(); ++i) {
+    if (registry.live.Contains(records[i].first)) records[kept++] = records[i];
+  }
+  while (records.Size() > kept) records.PopBack();
+}
+
+inline Epoch::Record* Epoch::LocalRecord() {
+  ThreadRecords& local = Local();
+  if (local.last_id == id_) return local.last;
+  Record* record = nullptr;
+  for (SizeType i = 0; i < local.records.Size() && !record; ++i) {
+    if (local.records[i].first == id_) record = local.records[i].second;
+  }
+  if (!record) {
+    record = Register();
+    local.Prune();
+    local.records.PushBack({id_, record});
+  }
+  local.last_id = id_;
+  local.last = record;
+  return record;
+}
+
+// Takes over the record of an exited thread, or adds a new one
+inline Epoch::Record* Epoch::Register() {
+  for (Record* record = records_.load(); record; record = record->next) {
+    bool free = false;
+    if (!record->in_use.load(std::memory_order_relaxed) &&
+        record->in_use.compare_exchange_strong(free, true,
+                                               std::memory_order_acquire)) {
+      return record;
+    }
+  }
+  Record* record = new Record;
+  record->next = records_.load();
+  while (!records_.compare_exchange_weak(record->next, record)) {
+  }
+  return record;
+}
+
+inline void Epoch::Free(Record* record, SizeType bucket) {
+  Vector<Retired>& limbo = record->limbo[bucket];
+  SizeType count = limbo.Size();
+  while (!limbo.Empty()) {
+    Retired retired = limbo[limbo.Size() - 1];
+    limbo.PopBack();
+    retired.deleter(retired.pointer);
+  }
+  if (count) pending_.fetch_sub(count, std::memory_order_relaxed);
+}
+
+inline void Epoch::Collect(Record* record) {
+  TryAdvance();
+  std::uint64_t epoch = epoch_.load();
+  for (SizeType bucket = 0; bucket < 3; ++bucket) {
+    if (record->limbo_epoch[bucket] + 2 <= epoch) Free(record, bucket);
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_EPOCH_H_
@@ -0,0 +1,207 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_FILTERED_MAP_H_
+#define SRC_CONTAINERS_EXTRA_S21_FILTERED_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "../containers/s21_map.h"
+#include "s21_bloom_filter.h"
+
+namespace s21 {
+// Map with a Bloom filter of its keys in front of its lookups; see
+// FilteredSet. Hash must agree with the key equality.
+template <class K, class V, class Hash = std::hash<K>>
+class FilteredMap {
+  using Storage = Map<K, V>;
+
+ public:
+  // FilteredMap Member type
+  using KeyType = K;
+  using MappedType = V;
+  using ValueType = std::pair<const K, V>;
+  using Reference = ValueType&;
+  using ConstReference = const ValueType&;
+  using SizeType = size_t;
+  using Iterator = typename Storage::Iterator;
+  using ConstIterator = typename Storage::ConstIterator;
+  using Pair = std::pair<Iterator, bool>;
+
+  // FilteredMap Member functions
+  FilteredMap() = default;
+  explicit FilteredMap(FilterOptions options) : filter_(options) {}
+  FilteredMap(std::initializer_list<ValueType> const& items,
+              FilterOptions options = FilterOptions());
+
+  // FilteredMap Element access
+  // Throws std::out_of_range if the key is absent
+  V& At(const K& key);
+  const V& At(const K& key) const;
+  // Inserts V() if the key is absent
+  V& operator[](const K& key);
+  // The map itself, for code that takes an s21::Map
+  const Storage& Get() const { return map_; }
+
+  // FilteredMap Iterators
+  Iterator Begin() { return map_.Begin(); }
+  Iterator End() { return map_.End(); }
+  ConstIterator Cbegin() const { return map_.Cbegin(); }
+  ConstIterator Cend() const { return map_.Cend(); }
+
+  // FilteredMap Capacity
+  bool Empty() const { return map_.Empty(); }
+  SizeType Size() const { return map_.Size(); }
+  SizeType MaxSize() const { return map_.MaxSize(); }
+
+  // FilteredMap Modifiers
+  void Clear();
+  Pair Insert(const ValueType& value) {
+    return Insert(value.first, value.second);
+  }
+  Pair Insert(const K& key, const V& obj);
+  Pair InsertOrAssign(const K& key, const V& obj);
+  // pos must come from this map
+  void Erase(Iterator pos);
+  // False if the key is not there
+  bool Erase(const K& key);
+  void Swap(FilteredMap& other);
+
+  // FilteredMap Lookup
+  Iterator Find(const K& key);
+  ConstIterator Find(const K& key) const;
+  bool Contains(const K& key) const;
+
+  // FilteredMap Filter
+  FilterStats Stats() const { return filter_.Stats(); }
+  void ResetStats() { filter_.ResetStats(); }
+
+ private:
+  Storage map_;
+  KeyFilter<K, Hash> filter_;
+
+  // Support functions
+  void Rebuild();
+};
+
+// FilteredMap Member functions
+template <class K, class V, class Hash>
+FilteredMap<K, V, Hash>::FilteredMap(
+    std::initializer_list<ValueType> const& items, FilterOptions options)
+    : filter_(options) {
+  for (auto it = items.begin(); it != items.end(); ++it) Insert(*it);
+}
+
+// FilteredMap Element access
+template <class K, class V, class Hash>
+V& FilteredMap<K, V, Hash>::At(const K& key) {
+  Iterator pos = Find(key);
+  if (pos == map_.End()) {
+    throw std::out_of_range("This element is not exists");
+  }
+  return pos->second;
+}
+
+template <class K, class V, class Hash>
+const V& FilteredMap<K, V, Hash>::At(const K& key) const {
+  ConstIterator pos = Find(key);
+  if (pos == map_.Cend()) {
+    throw std::out_of_range("This element is not exists");
+  }
+  return pos->second;
+}
+
+// Looked up through the filter first, as Map::Insert would not hand back
+// the node of a key already there
+template <class K, class V, class Hash>
+V& FilteredMap<K, V, Hash>::operator[](const K& key) {
+  Iterator pos = Find(key);
+  if (pos == map_.End()) pos = Insert(key, V()).first;
+  return pos->second;
+}
+
+// FilteredMap Modifiers
+template <class K, class V, class Hash>
+void FilteredMap<K, V, Hash>::Clear() {
+  map_.Clear();
+  filter_.Clear();
+}
+
+template <class K, class V, class Hash>
+typename FilteredMap<K, V, Hash>::Pair FilteredMap<K, V, Hash>::Insert(
+    const K& key, const V& obj) {
+  Pair result = map_.Insert(key, obj);
+  if (result.second && !filter_.Insert(key)) Rebuild();
+  return result;
+}
+
+// Map::InsertOrAssign answers true for an assignment too, so a new key is
+// told by the size
+template <class K, class V, class Hash>
+typename FilteredMap<K, V, Hash>::Pair FilteredMap<K, V, Hash>::InsertOrAssign(
+    const K& key, const V& obj) {
+  SizeType size = map_.Size();
+  Pair result = map_.InsertOrAssign(key, obj);
+  if (map_.Size() != size && !filter_.Insert(key)) Rebuild();
+  return result;
+}
+
+template <class K, class V, class Hash>
+void FilteredMap<K, V, Hash>::Erase(Iterator pos) {
+  map_.Erase(pos);
+  if (!filter_.Erase()) Rebuild();
+}
+
+template <class K, class V, class Hash>
+bool FilteredMap<K, V, Hash>::Erase(const K& key) {
+  Iterator pos = Find(key);
+  bool found = pos != map_.End();
+  if (found) Erase(pos);
+  return found;
+}
+
+template <class K, class V, class Hash>
+void FilteredMap<K, V, Hash>::Swap(FilteredMap& other) {
+  map_.Swap(other.map_);
+  std::swap(filter_, other.filter_);
+}
+
+// FilteredMap Lookup
+template <class K, class V, class Hash>
+typename FilteredMap<K, V, Hash>::Iterator FilteredMap<K, V, Hash>::Find(
+    const K& key) {
+  if (!filter_.MayContain(key)) return map_.End();
+  Iterator pos = map_.Find(key);
+  filter_.Record(pos != map_.End());
+  return pos;
+}
+
+template <class K, class V, class Hash>
+typename FilteredMap<K, V, Hash>::ConstIterator FilteredMap<K, V, Hash>::Find(
+    const K& key) const {
+  if (!filter_.MayContain(key)) return map_.Cend();
+  ConstIterator pos = map_.Find(key);
+  filter_.Record(pos != map_.Cend());
+  return pos;
+}
+
+template <class K, class V, class Hash>
+bool FilteredMap<K, V, Hash>::Contains(const K& key) const {
+  if (!filter_.MayContain(key)) return false;
+  bool found = map_.Contains(key);
+  filter_.Record(found);
+  return found;
+}
+
+// Support functions
+template <class K, class V, class Hash>
+void FilteredMap<K, V, Hash>::Rebuild() {
+  filter_.Reset(map_.Size());
+  for (ConstIterator it = map_.Cbegin(); it != map_.Cend(); ++it) {
+    filter_.Insert(it->first);
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_FILTERED_MAP_H_
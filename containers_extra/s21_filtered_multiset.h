@@ -0,0 +1,153 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_FILTERED_MULTISET_H_
+#define SRC_CONTAINERS_EXTRA_S21_FILTERED_MULTISET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "s21_bloom_filter.h"
+#include "s21_multiset.h"
+
+namespace s21 {
+// Multiset with a Bloom filter in front of its lookups; see FilteredSet.
+// Hash must agree with the multiset's equality.
+template <class T, class Hash = std::hash<T>>
+class FilteredMultiset {
+  using Storage = Multiset<T>;
+
+ public:
+  // FilteredMultiset Member type
+  using KeyType = T;
+  using ValueType = T;
+  using Reference = T&;
+  using ConstReference = const T&;
+  using SizeType = size_t;
+  using Iterator = typename Storage::Iterator;
+  using ConstIterator = typename Storage::ConstIterator;
+
+  // FilteredMultiset Member functions
+  FilteredMultiset() = default;
+  explicit FilteredMultiset(FilterOptions options) : filter_(options) {}
+  FilteredMultiset(std::initializer_list<ValueType> const& items,
+                   FilterOptions options = FilterOptions());
+
+  // FilteredMultiset Iterators
+  Iterator Begin() { return multiset_.Begin(); }
+  Iterator End() { return multiset_.End(); }
+
+  // FilteredMultiset Capacity
+  bool Empty() const { return multiset_.Empty(); }
+  SizeType Size() const { return multiset_.Size(); }
+  SizeType MaxSize() const { return multiset_.MaxSize(); }
+
+  // FilteredMultiset Modifiers
+  void Clear();
+  Iterator Insert(ConstReference value);
+  // pos must come from this multiset
+  void Erase(Iterator pos);
+  // Erases one copy of value; false if there is none
+  bool Erase(ConstReference value);
+  void Swap(FilteredMultiset& other);
+
+  // FilteredMultiset Lookup
+  SizeType Count(ConstReference value) const;
+  Iterator Find(ConstReference value);
+  bool Contains(ConstReference value) const;
+
+  // FilteredMultiset Filter
+  FilterStats Stats() const { return filter_.Stats(); }
+  void ResetStats() { filter_.ResetStats(); }
+  // The multiset itself, for code that takes an s21::Multiset
+  const Storage& Get() const { return multiset_; }
+
+ private:
+  Storage multiset_;
+  KeyFilter<T, Hash> filter_;
+
+  // Support functions
+  void Rebuild();
+};
+
+// FilteredMultiset Member functions
+template <class T, class Hash>
+FilteredMultiset<T, Hash>::FilteredMultiset(
+    std::initializer_list<ValueType> const& items, FilterOptions options)
+    : filter_(options) {
+  for (auto it = items.begin(); it != items.end(); ++it) Insert(*it);
+}
+
+// FilteredMultiset Modifiers
+template <class T, class Hash>
+void FilteredMultiset<T, Hash>::Clear() {
+  multiset_.Clear();
+  filter_.Clear();
+}
+
+// Every copy counts against the capacity of the filter, duplicates too
+template <class T, class Hash>
+typename FilteredMultiset<T, Hash>::Iterator FilteredMultiset<T, Hash>::Insert(
+    ConstReference value) {
+  Iterator pos = multiset_.Insert(value);
+  if (!filter_.Insert(value)) Rebuild();
+  return pos;
+}
+
+template <class T, class Hash>
+void FilteredMultiset<T, Hash>::Erase(Iterator pos) {
+  multiset_.Erase(pos);
+  if (!filter_.Erase()) Rebuild();
+}
+
+template <class T, class Hash>
+bool FilteredMultiset<T, Hash>::Erase(ConstReference value) {
+  Iterator pos = Find(value);
+  bool found = pos != multiset_.End();
+  if (found) Erase(pos);
+  return found;
+}
+
+template <class T, class Hash>
+void FilteredMultiset<T, Hash>::Swap(FilteredMultiset& other) {
+  multiset_.Swap(other.multiset_);
+  std::swap(filter_, other.filter_);
+}
+
+// FilteredMultiset Lookup
+template <class T, class Hash>
+typename FilteredMultiset<T, Hash>::SizeType FilteredMultiset<T, Hash>::Count(
+    ConstReference value) const {
+  if (!filter_.MayContain(value)) return 0;
+  SizeType count = multiset_.Count(value);
+  filter_.Record(count != 0);
+  return count;
+}
+
+template <class T, class Hash>
+typename FilteredMultiset<T, Hash>::Iterator FilteredMultiset<T, Hash>::Find(
+    ConstReference value) {
+  if (!filter_.MayContain(value)) return multiset_.End();
+  Iterator pos = multiset_.Find(value);
+  filter_.Record(pos != multiset_.End());
+  return pos;
+}
+
+template <class T, class Hash>
+bool FilteredMultiset<T, Hash>::Contains(ConstReference value) const {
+  if (!filter_.MayContain(value)) return false;
+  bool found = multiset_.Contains(value);
+  filter_.Record(found);
+  return found;
+}
+
+// Support functions
+template <class T, class Hash>
+void FilteredMultiset<T, Hash>::Rebuild() {
+  filter_.Reset(multiset_.Size());
+  for (Iterator it = multiset_.Begin(); it != multiset_.End(); ++it) {
+    filter_.Insert(*it);
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_FILTERED_MULTISET_H_
@@ -0,0 +1,160 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_FILTERED_SET_H_
+#define SRC_CONTAINERS_EXTRA_S21_FILTERED_SET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "../containers/s21_set.h"
+#include "s21_bloom_filter.h"
+
+namespace s21 {
+// Set with a Bloom filter in front of its lookups, for workloads where most
+// keys asked for are absent: such a lookup costs a hash and one cache line
+// instead of a walk down the tree. Hash must agree with the set's equality.
+//
+// The filter grows with the set and is rebuilt from it once
+// FilterOptions::rebuild_ratio of its keys have been erased. Lookups, Erase
+// by value included, are counted in Stats.
+template <class T, class Hash = std::hash<T>>
+class FilteredSet {
+  using Storage = Set<T>;
+
+ public:
+  // FilteredSet Member type
+  using KeyType = T;
+  using ValueType = T;
+  using Reference = T&;
+  using ConstReference = const T&;
+  using SizeType = size_t;
+  using Iterator = typename Storage::Iterator;
+  using ConstIterator = typename Storage::ConstIterator;
+  using Pair = std::pair<Iterator, bool>;
+
+  // FilteredSet Member functions
+  FilteredSet() = default;
+  explicit FilteredSet(FilterOptions options) : filter_(options) {}
+  FilteredSet(std::initializer_list<ValueType> const& items,
+              FilterOptions options = FilterOptions());
+
+  // FilteredSet Iterators
+  Iterator Begin() { return set_.Begin(); }
+  Iterator End() { return set_.End(); }
+  ConstIterator Cbegin() const { return set_.Cbegin(); }
+  ConstIterator Cend() const { return set_.Cend(); }
+
+  // FilteredSet Capacity
+  bool Empty() const { return set_.Empty(); }
+  SizeType Size() const { return set_.Size(); }
+  SizeType MaxSize() const { return set_.MaxSize(); }
+
+  // FilteredSet Modifiers
+  void Clear();
+  Pair Insert(ConstReference value);
+  // pos must come from this set
+  void Erase(Iterator pos);
+  // False if value is not there
+  bool Erase(ConstReference value);
+  void Swap(FilteredSet& other);
+
+  // FilteredSet Lookup
+  Iterator Find(ConstReference value);
+  ConstIterator Find(ConstReference value) const;
+  bool Contains(ConstReference value) const;
+
+  // FilteredSet Filter
+  FilterStats Stats() const { return filter_.Stats(); }
+  void ResetStats() { filter_.ResetStats(); }
+  // The set itself, for code that takes an s21::Set
+  const Storage& Get() const { return set_; }
+
+ private:
+  Storage set_;
+  KeyFilter<T, Hash> filter_;
+
+  // Support functions
+  void Rebuild();
+};
+
+// FilteredSet Member functions
+template <class T, class Hash>
+FilteredSet<T, Hash>::FilteredSet(
+    std::initializer_list<ValueType> const& items, FilterOptions options)
+    : filter_(options) {
+  for (auto it = items.begin(); it != items.end(); ++it) Insert(*it);
+}
+
+// FilteredSet Modifiers
+template <class T, class Hash>
+void FilteredSet<T, Hash>::Clear() {
+  set_.Clear();
+  filter_.Clear();
+}
+
+template <class T, class Hash>
+typename FilteredSet<T, Hash>::Pair FilteredSet<T, Hash>::Insert(
+    ConstReference value) {
+  Pair result = set_.Insert(value);
+  if (result.second && !filter_.Insert(value)) Rebuild();
+  return result;
+}
+
+template <class T, class Hash>
+void FilteredSet<T, Hash>::Erase(Iterator pos) {
+  set_.Erase(pos);
+  if (!filter_.Erase()) Rebuild();
+}
+
+template <class T, class Hash>
+bool FilteredSet<T, Hash>::Erase(ConstReference value) {
+  Iterator pos = Find(value);
+  bool found = pos != set_.End();
+  if (found) Erase(pos);
+  return found;
+}
+
+template <class T, class Hash>
+void FilteredSet<T, Hash>::Swap(FilteredSet& other) {
+  set_.Swap(other.set_);
+  std::swap(filter_, other.filter_);
+}
+
+// FilteredSet Lookup
+template <class T, class Hash>
+typename FilteredSet<T, Hash>::Iterator FilteredSet<T, Hash>::Find(
+    ConstReference value) {
+  if (!filter_.MayContain(value)) return set_.End();
+  Iterator pos = set_.Find(value);
+  filter_.Record(pos != set_.End());
+  return pos;
+}
+
+template <class T, class Hash>
+typename FilteredSet<T, Hash>::ConstIterator FilteredSet<T, Hash>::Find(
+    ConstReference value) const {
+  if (!filter_.MayContain(value)) return set_.Cend();
+  ConstIterator pos = set_.Find(value);
+  filter_.Record(pos != set_.Cend());
+  return pos;
+}
+
+template <class T, class Hash>
+bool FilteredSet<T, Hash>::Contains(ConstReference value) const {
+  if (!filter_.MayContain(value)) return false;
+  bool found = set_.Contains(value);
+  filter_.Record(found);
+  return found;
+}
+
+// Support functions
+template <class T, class Hash>
+void FilteredSet<T, Hash>::Rebuild() {
+  filter_.Reset(set_.Size());
+  for (ConstIterator it = set_.Cbegin(); it != set_.Cend(); ++it) {
+    filter_.Insert(*it);
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_FILTERED_SET_H_
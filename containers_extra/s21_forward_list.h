@@ -0,0 +1,394 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_FORWARD_LIST_H_
+#define SRC_CONTAINERS_EXTRA_S21_FORWARD_LIST_H_
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+// Singly linked list: a node is the value plus one pointer and the list
+// itself is a head link and a size, so every operation writes one link less
+// than List. Since a node cannot reach its predecessor, insertion, erasure
+// and splicing take the position before the affected element, and
+// BeforeBegin() names the position in front of the first element.
+template <class T>
+class ForwardList {
+  struct Link {
+    Link* next_ = nullptr;
+  };
+
+  struct Node : Link {
+    T value_;
+    template <typename... Args>
+    explicit Node(Args&&... args) : value_(std::forward<Args>(args)...) {}
+  };
+
+ public:
+  // ForwardList Member type
+  using ValueType = T;
+  using Reference = T&;
+  using ConstReference = const T&;
+  using SizeType = size_t;
+
+  // internal class ForwardListIterator
+  template <class Value>
+  class IteratorBase {
+    friend class ForwardList;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value*;
+    using reference = Value&;
+
+    IteratorBase() = default;
+    explicit IteratorBase(Link* link) : link_(link) {}
+    // Iterator converts to ConstIterator
+    template <class Other>
+    IteratorBase(const IteratorBase<Other>& other) : link_(other.link_) {}
+
+    reference operator*() const noexcept {
+      return static_cast<Node*>(link_)->value_;
+    }
+    pointer operator->() const noexcept { return &**this; }
+
+    IteratorBase& operator++() noexcept {
+      link_ = link_->next_;
+      return *this;
+    }
+
+    IteratorBase operator++(int) noexcept {
+      IteratorBase tmp = *this;
+      link_ = link_->next_;
+      return tmp;
+    }
+
+    bool operator==(const IteratorBase& other) const noexcept {
+      return link_ == other.link_;
+    }
+
+    bool operator!=(const IteratorBase& other) const noexcept {
+      return link_ != other.link_;
+    }
+
+   private:
+    template <class>
+    friend class IteratorBase;
+    Link* link_ = nullptr;
+  };
+
+  using Iterator = IteratorBase<T>;
+  using ConstIterator = IteratorBase<const T>;
+
+  // ForwardList Member functions
+  ForwardList() = default;
+  explicit ForwardList(SizeType n);
+  ForwardList(std::initializer_list<ValueType> const& items);
+  ForwardList(const ForwardList& l);
+  ForwardList(ForwardList&& l) noexcept { Swap(l); }
+  ~ForwardList() { Clear(); }
+  ForwardList& operator=(const ForwardList& l);
+  ForwardList& operator=(ForwardList&& l) noexcept;
+
+  // ForwardList Element access
+  ConstReference Front() const;
+
+  // ForwardList Iterators
+  Iterator BeforeBegin() { return Iterator(&head_); }
+  Iterator Begin() { return Iterator(head_.next_); }
+  Iterator End() { return Iterator(); }
+  ConstIterator CbeforeBegin() const;
+  ConstIterator Cbegin() const { return ConstIterator(head_.next_); }
+  ConstIterator Cend() const { return ConstIterator(); }
+
+  // ForwardList Capacity
+  bool Empty() const { return size_ == 0; }
+  SizeType Size() const { return size_; }
+  SizeType MaxSize() const;
+
+  // ForwardList Modifiers
+  void Clear();
+  void PushFront(ConstReference value) { EmplaceAfter(BeforeBegin(), value); }
+  void PushFront(ValueType&& value);
+  void PopFront();
+  // Inserts after pos and returns an iterator to the new element
+  Iterator InsertAfter(Iterator pos, ConstReference value);
+  Iterator InsertAfter(Iterator pos, ValueType&& value);
+  // Erases the element following pos and returns the one after it
+  Iterator EraseAfter(Iterator pos);
+  void Swap(ForwardList& other);
+  // Moves all elements of other after pos; walks other to find its end
+  void SpliceAfter(Iterator pos, ForwardList& other);
+  // Moves the element following it in other after pos, in O(1)
+  void SpliceAfter(Iterator pos, ForwardList& other, Iterator it);
+  // Merges the sorted list other into this sorted list, stably
+  void Merge(ForwardList& other);
+  void Reverse();
+  void Unique();
+  // Stable bottom-up merge sort, O(n log n) and no allocation
+  void Sort();
+
+  template <typename... Args>
+  Iterator EmplaceAfter(Iterator pos, Args&&... args);
+  template <typename... Args>
+  void EmplaceFront(Args&&... args);
+
+ private:
+  Link head_;
+  SizeType size_ = 0;
+
+  // Support functions
+  static Link* CutAfter(Link* first, SizeType n);
+  static Link* MergeChains(Link* first, Link* second, Link* tail);
+  static const T& Value(Link* link) { return static_cast<Node*>(link)->value_; }
+};
+
+// ForwardList Member functions
+template <class T>
+ForwardList<T>::ForwardList(SizeType n) {
+  while (n--) {
+    PushFront(ValueType());
+  }
+}
+
+template <class T>
+ForwardList<T>::ForwardList(std::initializer_list<ValueType> const& items) {
+  Iterator last = BeforeBegin();
+  for (auto it = items.begin(); it != items.end(); ++it) {
+    last = InsertAfter(last, *it);
+  }
+}
+
+template <class T>
+ForwardList<T>::ForwardList(const ForwardList& l) {
+  Iterator last = BeforeBegin();
+  for (ConstIterator it = l.Cbegin(); it != l.Cend(); ++it) {
+    last = InsertAfter(last, *it);
+  }
+}
+
+template <class T>
+ForwardList<T>& ForwardList<T>::operator=(const ForwardList& l) {
+  if (this != &l) {
+    ForwardList copy(l);
+    Swap(copy);
+  }
+  return *this;
+}
+
+template <class T>
+ForwardList<T>& ForwardList<T>::operator=(ForwardList&& l) noexcept {
+  Clear();
+  Swap(l);
+  return *this;
+}
+
+// ForwardList Element access
+template <class T>
+typename ForwardList<T>::ConstReference ForwardList<T>::Front() const {
+  if (Empty()) {
+    throw std::out_of_range("Container is empty");
+  }
+  return Value(head_.next_);
+}
+
+// ForwardList Iterators
+template <class T>
+typename ForwardList<T>::ConstIterator ForwardList<T>::CbeforeBegin() const {
+  return ConstIterator(const_cast<Link*>(&head_));
+}
+
+// ForwardList Capacity
+template <class T>
+typename ForwardList<T>::SizeType ForwardList<T>::MaxSize() const {
+  return std::numeric_limits<SizeType>::max() / sizeof(Node);
+}
+
+// ForwardList Modifiers
+template <class T>
+void ForwardList<T>::Clear() {
+  Link* link = head_.next_;
+  while (link) {
+    Link* next = link->next_;
+    delete static_cast<Node*>(link);
+    link = next;
+  }
+  head_.next_ = nullptr;
+  size_ = 0;
+}
+
+template <class T>
+void ForwardList<T>::PushFront(ValueType&& value) {
+  EmplaceAfter(BeforeBegin(), std::move(value));
+}
+
+template <class T>
+void ForwardList<T>::PopFront() {
+  if (Empty()) {
+    throw std::out_of_range("Container is empty");
+  }
+  EraseAfter(BeforeBegin());
+}
+
+template <class T>
+typename ForwardList<T>::Iterator ForwardList<T>::InsertAfter(
+    Iterator pos, ConstReference value) {
+  return EmplaceAfter(pos, value);
+}
+
+template <class T>
+typename ForwardList<T>::Iterator ForwardList<T>::InsertAfter(
+    Iterator pos, ValueType&& value) {
+  return EmplaceAfter(pos, std::move(value));
+}
+
+template <class T>
+typename ForwardList<T>::Iterator ForwardList<T>::EraseAfter(Iterator pos) {
+  Link* link = pos.link_ ? pos.link_->next_ : nullptr;
+  if (link == nullptr) {
+    throw std::out_of_range("Iterator is NULL");
+  }
+  pos.link_->next_ = link->next_;
+  delete static_cast<Node*>(link);
+  --size_;
+  return Iterator(pos.link_->next_);
+}
+
+template <class T>
+void ForwardList<T>::Swap(ForwardList& other) {
+  std::swap(head_.next_, other.head_.next_);
+  std::swap(size_, other.size_);
+}
+
+template <class T>
+void ForwardList<T>::SpliceAfter(Iterator pos, ForwardList& other) {
+  if (&other == this || other.Empty()) return;
+  Link* last = other.head_.next_;
+  while (last->next_) last = last->next_;
+  last->next_ = pos.link_->next_;
+  pos.link_->next_ = other.head_.next_;
+  size_ += other.size_;
+  other.head_.next_ = nullptr;
+  other.size_ = 0;
+}
+
+template <class T>
+void ForwardList<T>::SpliceAfter(Iterator pos, ForwardList& other,
+                                 Iterator it) {
+  Link* link = it.link_->next_;
+  if (link == nullptr || link == pos.link_ || it == pos) return;
+  it.link_->next_ = link->next_;
+  link->next_ = pos.link_->next_;
+  pos.link_->next_ = link;
+  --other.size_;
+  ++size_;
+}
+
+template <class T>
+void ForwardList<T>::Merge(ForwardList& other) {
+  if (&other == this || other.Empty()) return;
+  MergeChains(head_.next_, other.head_.next_, &head_);
+  size_ += other.size_;
+  other.head_.next_ = nullptr;
+  other.size_ = 0;
+}
+
+template <class T>
+void ForwardList<T>::Reverse() {
+  Link* reversed = nullptr;
+  Link* link = head_.next_;
+  while (link) {
+    Link* next = link->next_;
+    link->next_ = reversed;
+    reversed = link;
+    link = next;
+  }
+  head_.next_ = reversed;
+}
+
+template <class T>
+void ForwardList<T>::Unique() {
+  Iterator it = Begin();
+  if (it == End()) return;
+  while (it.link_->next_) {
+    if (Value(it.link_) == Value(it.link_->next_)) {
+      EraseAfter(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+// Each pass merges neighbouring sorted runs of width elements; the width
+// doubles until a single run is left
+template <class T>
+void ForwardList<T>::Sort() {
+  for (SizeType width = 1; width < size_; width *= 2) {
+    Link* rest = head_.next_;
+    Link* tail = &head_;
+    while (rest) {
+      Link* first = rest;
+      Link* second = CutAfter(first, width);
+      rest = CutAfter(second, width);
+      tail = MergeChains(first, second, tail);
+    }
+  }
+}
+
+template <class T>
+template <typename... Args>
+typename ForwardList<T>::Iterator ForwardList<T>::EmplaceAfter(
+    Iterator pos, Args&&... args) {
+  Link* node = new Node(std::forward<Args>(args)...);
+  node->next_ = pos.link_->next_;
+  pos.link_->next_ = node;
+  ++size_;
+  return Iterator(node);
+}
+
+template <class T>
+template <typename... Args>
+void ForwardList<T>::EmplaceFront(Args&&... args) {
+  EmplaceAfter(BeforeBegin(), std::forward<Args>(args)...);
+}
+
+// Support functions
+// Detaches the chain after its first n links and returns the remainder
+template <class T>
+typename ForwardList<T>::Link* ForwardList<T>::CutAfter(Link* first,
+                                                        SizeType n) {
+  for (; first && n > 1; --n) first = first->next_;
+  if (first == nullptr) return nullptr;
+  Link* rest = first->next_;
+  first->next_ = nullptr;
+  return rest;
+}
+
+// Merges two sorted null-terminated chains behind tail and returns the last
+// link of the result; ties take the element of first
+template <class T>
+typename ForwardList<T>::Link* ForwardList<T>::MergeChains(Link* first,
+                                                           Link* second,
+                                                           Link* tail) {
+  while (first && second) {
+    if (Value(second) < Value(first)) {
+      tail->next_ = second;
+      second = second->next_;
+    } else {
+      tail->next_ = first;
+      first = first->next_;
+    }
+    tail = tail->next_;
+  }
+  tail->next_ = first ? first : second;
+  while (tail->next_) tail = tail->next_;
+  return tail;
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_FORWARD_LIST_H_
@@ -0,0 +1,127 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_FROZEN_MAP_H_
+#define SRC_CONTAINERS_EXTRA_S21_FROZEN_MAP_H_
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "../containers/s21_vector.h"
+#include "s21_frozen_tree.h"
+
+namespace s21 {
+template <class Key, class T, class Compare>
+class Map;
+
+// Read-only ordered map for lookup tables built once and searched many
+// times, as made by Map::Freeze. The entries live in one array in
+// Eytzinger order, searched without pointer chasing; see FrozenTree.
+template <class K, class V, class Compare = std::less<K>>
+class FrozenMap {
+  friend class Map<K, V, Compare>;
+
+  struct KeyOfPair {
+    const K& operator()(const std::pair<K, V>& value) const {
+      return value.first;
+    }
+  };
+
+  using Tree = FrozenTree<K, std::pair<K, V>, KeyOfPair, Compare>;
+
+ public:
+  // FrozenMap Member type
+  using KeyType = K;
+  using MappedType = V;
+  using ValueType = std::pair<K, V>;
+  using ConstReference = const ValueType&;
+  using SizeType = size_t;
+  using ConstIterator = typename Tree::ConstIterator;
+  using Iterator = ConstIterator;
+
+  // FrozenMap Member functions
+  FrozenMap() = default;
+  // The first value given for a key wins, as with Map
+  FrozenMap(std::initializer_list<ValueType> const& items,
+            const Compare& comp = Compare());
+
+  // FrozenMap Element access
+  // Throws std::out_of_range if the key is absent
+  const V& At(const K& key) const;
+
+  // FrozenMap Lookup
+  ConstIterator Find(const K& key) const { return tree_.FindIterator(key); }
+  bool Contains(const K& key) const { return tree_.Find(key) != nullptr; }
+  // First element whose key is not less than key
+  ConstIterator LowerBound(const K& key) const {
+    return tree_.LowerBound(key);
+  }
+
+  // Batched Find and Contains: write an iterator or a bool to out for each
+  // of count keys read from keys, searching kPrefetchGroup of them in
+  // lockstep
+  template <class ForwardIt, class OutputIt>
+  void FindBatch(ForwardIt keys, SizeType count, OutputIt out) const {
+    tree_.FindBatch(keys, count, out);
+  }
+  template <class ForwardIt, class OutputIt>
+  void ContainsBatch(ForwardIt keys, SizeType count, OutputIt out) const {
+    tree_.ContainsBatch(keys, count, out);
+  }
+
+  // FrozenMap Iterators
+  ConstIterator Begin() const { return tree_.Begin(); }
+  ConstIterator End() const { return tree_.End(); }
+  ConstIterator Cbegin() const { return tree_.Begin(); }
+  ConstIterator Cend() const { return tree_.End(); }
+
+  // FrozenMap Capacity
+  bool Empty() const { return tree_.Empty(); }
+  SizeType Size() const { return tree_.Size(); }
+  SizeType MaxSize() const {
+    return std::numeric_limits<SizeType>::max() / sizeof(ValueType);
+  }
+
+ private:
+  Tree tree_;
+
+  // sorted must be ordered by comp on the keys, without equivalent keys
+  FrozenMap(Vector<ValueType>&& sorted, const Compare& comp)
+      : tree_(std::move(sorted), comp) {}
+};
+
+// FrozenMap Member functions
+template <class K, class V, class Compare>
+FrozenMap<K, V, Compare>::FrozenMap(
+    std::initializer_list<ValueType> const& items, const Compare& comp) {
+  Vector<ValueType> sorted;
+  sorted.Reserve(items.size());
+  for (auto it = items.begin(); it != items.end(); ++it) sorted.PushBack(*it);
+  ValueType* begin = sorted.Data();
+  ValueType* end = begin + sorted.Size();
+  std::stable_sort(begin, end,
+                   [&comp](const ValueType& a, const ValueType& b) {
+                     return comp(a.first, b.first);
+                   });
+  end = std::unique(begin, end, [&comp](const ValueType& a,
+                                        const ValueType& b) {
+    return !comp(a.first, b.first) && !comp(b.first, a.first);
+  });
+  while (sorted.Size() > SizeType(end - begin)) sorted.PopBack();
+  tree_ = Tree(std::move(sorted), comp);
+}
+
+// FrozenMap Element access
+template <class K, class V, class Compare>
+const V& FrozenMap<K, V, Compare>::At(const K& key) const {
+  const ValueType* value = tree_.Find(key);
+  if (!value) {
+    throw std::out_of_range("This element is not exists");
+  }
+  return value->second;
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_FROZEN_MAP_H_
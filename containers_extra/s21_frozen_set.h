@@ -0,0 +1,108 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_FROZEN_SET_H_
+#define SRC_CONTAINERS_EXTRA_S21_FROZEN_SET_H_
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <utility>
+
+#include "../containers/s21_vector.h"
+#include "s21_frozen_tree.h"
+
+namespace s21 {
+template <class T, class Compare>
+class Set;
+
+// Read-only ordered set for lookup tables built once and searched many
+// times, as made by Set::Freeze. The elements live in one array in
+// Eytzinger order, searched without pointer chasing; see FrozenTree.
+template <class T, class Compare = std::less<T>>
+class FrozenSet {
+  friend class Set<T, Compare>;
+
+  struct KeyOfValue {
+    const T& operator()(const T& value) const { return value; }
+  };
+
+  using Tree = FrozenTree<T, T, KeyOfValue, Compare>;
+
+ public:
+  // FrozenSet Member type
+  using KeyType = T;
+  using ValueType = T;
+  using ConstReference = const T&;
+  using SizeType = size_t;
+  using ConstIterator = typename Tree::ConstIterator;
+  using Iterator = ConstIterator;
+
+  // FrozenSet Member functions
+  FrozenSet() = default;
+  FrozenSet(std::initializer_list<ValueType> const& items,
+            const Compare& comp = Compare());
+
+  // FrozenSet Lookup
+  ConstIterator Find(ConstReference value) const {
+    return tree_.FindIterator(value);
+  }
+  bool Contains(ConstReference value) const {
+    return tree_.Find(value) != nullptr;
+  }
+  // First element not less than value
+  ConstIterator LowerBound(ConstReference value) const {
+    return tree_.LowerBound(value);
+  }
+
+  // Batched Find and Contains: write an iterator or a bool to out for each
+  // of count keys read from keys, searching kPrefetchGroup of them in
+  // lockstep
+  template <class ForwardIt, class OutputIt>
+  void FindBatch(ForwardIt keys, SizeType count, OutputIt out) const {
+    tree_.FindBatch(keys, count, out);
+  }
+  template <class ForwardIt, class OutputIt>
+  void ContainsBatch(ForwardIt keys, SizeType count, OutputIt out) const {
+    tree_.ContainsBatch(keys, count, out);
+  }
+
+  // FrozenSet Iterators
+  ConstIterator Begin() const { return tree_.Begin(); }
+  ConstIterator End() const { return tree_.End(); }
+  ConstIterator Cbegin() const { return tree_.Begin(); }
+  ConstIterator Cend() const { return tree_.End(); }
+
+  // FrozenSet Capacity
+  bool Empty() const { return tree_.Empty(); }
+  SizeType Size() const { return tree_.Size(); }
+  SizeType MaxSize() const {
+    return std::numeric_limits<SizeType>::max() / sizeof(ValueType);
+  }
+
+ private:
+  Tree tree_;
+
+  // sorted must be ordered by comp and free of equivalent elements
+  FrozenSet(Vector<T>&& sorted, const Compare& comp)
+      : tree_(std::move(sorted), comp) {}
+};
+
+// FrozenSet Member functions
+template <class T, class Compare>
+FrozenSet<T, Compare>::FrozenSet(std::initializer_list<ValueType> const& items,
+                                 const Compare& comp) {
+  Vector<T> sorted;
+  sorted.Reserve(items.size());
+  for (auto it = items.begin(); it != items.end(); ++it) sorted.PushBack(*it);
+  T* begin = sorted.Data();
+  T* end = begin + sorted.Size();
+  std::sort(begin, end, comp);
+  end = std::unique(begin, end, [&comp](const T& a, const T& b) {
+    return !comp(a, b) && !comp(b, a);
+  });
+  while (sorted.Size() > SizeType(end - begin)) sorted.PopBack();
+  tree_ = Tree(std::move(sorted), comp);
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_FROZEN_SET_H_
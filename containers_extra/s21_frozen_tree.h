@@ -0,0 +1,291 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_FROZEN_TREE_H_
+#define SRC_CONTAINERS_EXTRA_S21_FROZEN_TREE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
+#include "../containers/s21_vector.h"
+#include "s21_prefetch.h"
+
+namespace s21 {
+// Read-only search tree behind FrozenSet and FrozenMap, laid out in
+// Eytzinger (breadth-first) order in one array: node k sits at index k and
+// its children at 2k and 2k + 1, so the tree has no pointers and the top
+// levels, which every search passes, share a few cache lines.
+//
+// A search descends with one comparison per level and no data-dependent
+// branch, and prefetches the descendants a cache line's worth of levels
+// ahead, so the memory latency of the lower levels overlaps the work on
+// the upper ones.
+//
+// KeyOf maps a stored Value to its Key, which Compare orders.
+template <class Key, class Value, class KeyOf, class Compare>
+class FrozenTree {
+ public:
+  // FrozenTree Member type
+  using SizeType = size_t;
+
+  // internal class FrozenTreeConstIterator. Walks the implicit tree in
+  // order; valid as long as the tree it came from.
+  class ConstIterator {
+    friend class FrozenTree;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Value*;
+    using reference = const Value&;
+
+    ConstIterator() = default;
+
+    reference operator*() const noexcept { return data_[index_]; }
+    pointer operator->() const noexcept { return &data_[index_]; }
+
+    // Down to the leftmost node of the right subtree, or else up past the
+    // right children to the first ancestor entered from its left
+    ConstIterator& operator++() noexcept {
+      if (2 * index_ + 1 <= size_) {
+        index_ = 2 * index_ + 1;
+        while (2 * index_ <= size_) index_ *= 2;
+      } else {
+        index_ >>= TrailingOnes(index_) + 1;
+      }
+      return *this;
+    }
+
+    ConstIterator operator++(int) noexcept {
+      ConstIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    bool operator==(const ConstIterator& other) const noexcept {
+      return index_ == other.index_;
+    }
+
+    bool operator!=(const ConstIterator& other) const noexcept {
+      return index_ != other.index_;
+    }
+
+   private:
+    ConstIterator(const Value* data, SizeType size, SizeType index)
+        : data_(data), size_(size), index_(index) {}
+
+    const Value* data_ = nullptr;
+    SizeType size_ = 0;
+    // 0 past the end
+    SizeType index_ = 0;
+  };
+
+  // FrozenTree Member functions
+  FrozenTree() = default;
+  // sorted must be ordered by Compare, without equivalent keys
+  explicit FrozenTree(Vector<Value>&& sorted,
+                      const Compare& comp = Compare());
+
+  // FrozenTree Lookup
+  const Value* Find(const Key& key) const;
+  ConstIterator FindIterator(const Key& key) const;
+  ConstIterator LowerBound(const Key& key) const {
+    return At(LowerIndex(key));
+  }
+  // Look up count keys read from keys and write an iterator, End if
+  // absent, or a bool per key to out. The searches descend in lockstep, so
+  // the misses of a level overlap across keys.
+  template <class ForwardIt, class OutputIt>
+  void FindBatch(ForwardIt keys, SizeType count, OutputIt out) const;
+  template <class ForwardIt, class OutputIt>
+  void ContainsBatch(ForwardIt keys, SizeType count, OutputIt out) const;
+
+  // FrozenTree Iterators
+  ConstIterator Begin() const;
+  ConstIterator End() const { return At(0); }
+
+  // FrozenTree Capacity
+  bool Empty() const { return data_.Empty(); }
+  SizeType Size() const { return Empty() ? 0 : data_.Size() - 1; }
+
+ private:
+  // Index 0 is unused, so that the children of k are 2k and 2k + 1; empty
+  // for an empty tree
+  Vector<Value> data_;
+  Compare comp_;
+
+  // Levels spanned by one cache line of descendants: the 2^levels nodes
+  // that many levels below k are adjacent, from k << levels on
+  static constexpr int PrefetchLevels() {
+    int levels = 1;
+    while ((sizeof(Value) << (levels + 1)) <= 64) ++levels;
+    return levels;
+  }
+
+  // Support functions
+  static SizeType TrailingOnes(SizeType index);
+  ConstIterator At(SizeType index) const {
+    return ConstIterator(Data(), Size(), index);
+  }
+  const Value* Data() const { return Empty() ? nullptr : &data_[0]; }
+  void PrefetchDescendants(SizeType index) const;
+  SizeType LowerIndex(const Key& key) const;
+  template <class ForwardIt, class Emit>
+  void SearchBatch(ForwardIt keys, SizeType count, Emit emit) const;
+  void Fill(Vector<Value>& sorted, SizeType& next, SizeType index);
+};
+
+// FrozenTree Member functions
+template <class Key, class Value, class KeyOf, class Compare>
+FrozenTree<Key, Value, KeyOf, Compare>::FrozenTree(Vector<Value>&& sorted,
+                                                   const Compare& comp)
+    : comp_(comp) {
+  if (sorted.Empty()) return;
+  data_ = Vector<Value>(sorted.Size() + 1);
+  SizeType next = 0;
+  Fill(sorted, next, 1);
+}
+
+// FrozenTree Lookup
+template <class Key, class Value, class KeyOf, class Compare>
+const Value* FrozenTree<Key, Value, KeyOf, Compare>::Find(
+    const Key& key) const {
+  SizeType index = LowerIndex(key);
+  if (!index || comp_(key, KeyOf()(data_[index]))) return nullptr;
+  return &data_[index];
+}
+
+template <class Key, class Value, class KeyOf, class Compare>
+typename FrozenTree<Key, Value, KeyOf, Compare>::ConstIterator
+FrozenTree<Key, Value, KeyOf, Compare>::FindIterator(const Key& key) const {
+  const Value* value = Find(key);
+  return value ? At(value - Data()) : End();
+}
+
+template <class Key, class Value, class KeyOf, class Compare>
+template <class ForwardIt, class OutputIt>
+void FrozenTree<Key, Value, KeyOf, Compare>::FindBatch(ForwardIt keys,
+                                                       SizeType count,
+                                                       OutputIt out) const {
+  SearchBatch(keys, count, [this, &out](SizeType index) {
+    *out = At(index);
+    ++out;
+  });
+}
+
+template <class Key, class Value, class KeyOf, class Compare>
+template <class ForwardIt, class OutputIt>
+void FrozenTree<Key, Value, KeyOf, Compare>::ContainsBatch(
+    ForwardIt keys, SizeType count, OutputIt out) const {
+  SearchBatch(keys, count, [&out](SizeType index) {
+    *out = index != 0;
+    ++out;
+  });
+}
+
+// FrozenTree Iterators
+template <class Key, class Value, class KeyOf, class Compare>
+typename FrozenTree<Key, Value, KeyOf, Compare>::ConstIterator
+FrozenTree<Key, Value, KeyOf, Compare>::Begin() const {
+  SizeType size = Size();
+  SizeType index = size ? 1 : 0;
+  while (index && 2 * index <= size) index *= 2;
+  return At(index);
+}
+
+// Support functions
+template <class Key, class Value, class KeyOf, class Compare>
+typename FrozenTree<Key, Value, KeyOf, Compare>::SizeType
+FrozenTree<Key, Value, KeyOf, Compare>::TrailingOnes(SizeType index) {
+#if defined(__GNUC__)
+  return __builtin_ctzll(~static_cast<unsigned long long>(index));
+#else
+  SizeType count = 0;
+  for (; index & 1; index >>= 1) ++count;
+  return count;
+#endif
+}
+
+// The descendants may lie past the end of the array; a prefetch never
+// faults, and the address is formed as an integer so no pointer leaves it
+template <class Key, class Value, class KeyOf, class Compare>
+void FrozenTree<Key, Value, KeyOf, Compare>::PrefetchDescendants(
+    SizeType index) const {
+  constexpr int kLevels = PrefetchLevels();
+  std::uintptr_t base = reinterpret_cast<std::uintptr_t>(Data());
+  constexpr SizeType kSpan = ((SizeType(1) << kLevels) - 1) * sizeof(Value);
+  std::uintptr_t first = base + (index << kLevels) * sizeof(Value);
+  std::uintptr_t last = first + kSpan;
+  s21::Prefetch(reinterpret_cast<const void*>(first));
+  s21::Prefetch(reinterpret_cast<const void*>(last));
+}
+
+// Every step right appends a 1 to the index and every step left a 0. The
+// lower bound is the last node the search left from, found by dropping the
+// trailing right steps and the left step before them; 0 if it never went
+// left.
+template <class Key, class Value, class KeyOf, class Compare>
+typename FrozenTree<Key, Value, KeyOf, Compare>::SizeType
+FrozenTree<Key, Value, KeyOf, Compare>::LowerIndex(const Key& key) const {
+  const Value* data = Data();
+  SizeType size = Size();
+  SizeType index = 1;
+  while (index <= size) {
+    PrefetchDescendants(index);
+    index = 2 * index + comp_(KeyOf()(data[index]), key);
+  }
+  return index >> (TrailingOnes(index) + 1);
+}
+
+// LowerIndex for kPrefetchGroup keys at a time, one level of each per
+// round. All searches take the same number of levels, give or take one.
+// Each search prefetches just the node it visits next round: the group
+// already keeps enough misses in flight, and prefetching the descendants
+// of every search as well would ask for more lines than the core can
+// track. emit gets the index of each key, 0 if it is absent.
+template <class Key, class Value, class KeyOf, class Compare>
+template <class ForwardIt, class Emit>
+void FrozenTree<Key, Value, KeyOf, Compare>::SearchBatch(ForwardIt keys,
+                                                         SizeType count,
+                                                         Emit emit) const {
+  const Value* data = Data();
+  SizeType size = Size();
+  const Key* key[kPrefetchGroup];
+  SizeType index[kPrefetchGroup];
+  while (count) {
+    SizeType group = count < kPrefetchGroup ? count : kPrefetchGroup;
+    for (SizeType i = 0; i < group; ++i, ++keys) {
+      key[i] = &*keys;
+      index[i] = 1;
+    }
+    for (bool pending = size > 0; pending;) {
+      pending = false;
+      for (SizeType i = 0; i < group; ++i) {
+        if (index[i] > size) continue;
+        index[i] = 2 * index[i] + comp_(KeyOf()(data[index[i]]), *key[i]);
+        s21::Prefetch(data + (index[i] <= size ? index[i] : 0));
+        pending |= index[i] <= size;
+      }
+    }
+    for (SizeType i = 0; i < group; ++i) {
+      SizeType found = index[i] >> (TrailingOnes(index[i]) + 1);
+      emit(found && !comp_(*key[i], KeyOf()(data[found])) ? found : 0);
+    }
+    count -= group;
+  }
+}
+
+// An in-order walk of the implicit tree meets its nodes in sorted order
+template <class Key, class Value, class KeyOf, class Compare>
+void FrozenTree<Key, Value, KeyOf, Compare>::Fill(Vector<Value>& sorted,
+                                                  SizeType& next,
+                                                  SizeType index) {
+  if (index > Size()) return;
+  Fill(sorted, next, 2 * index);
+  data_[index] = std::move(sorted[next++]);
+  Fill(sorted, next, 2 * index + 1);
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_FROZEN_TREE_H_
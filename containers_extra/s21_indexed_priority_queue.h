@@ -0,0 +1,288 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_INDEXED_PRIORITY_QUEUE_H_
+#define SRC_CONTAINERS_EXTRA_S21_INDEXED_PRIORITY_QUEUE_H_
+
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "../containers/s21_vector.h"
+
+namespace s21 {
+// Addressable d-ary heap. Push returns a handle that stays valid until the
+// element is popped or erased, and the queue keeps the heap position of
+// every handle up to date, so an element can be re-keyed or removed in
+// O(log n) without searching for it.
+//
+// Unlike PriorityQueue, Top() is the smallest element with respect to
+// Compare, so that DecreaseKey moves an element towards the top. Handles of
+// removed elements are reused by later pushes.
+template <class T, class Compare = std::less<T>, size_t Arity = 4>
+class IndexedPriorityQueue {
+  static_assert(Arity >= 2, "IndexedPriorityQueue arity must be at least 2");
+
+ public:
+  // IndexedPriorityQueue Member type
+  using ValueType = T;
+  using Reference = T&;
+  using ConstReference = const T&;
+  using SizeType = size_t;
+  using Handle = SizeType;
+
+  // IndexedPriorityQueue Member functions
+  IndexedPriorityQueue() = default;
+  explicit IndexedPriorityQueue(const Compare& compare) : compare_(compare) {}
+  IndexedPriorityQueue(const IndexedPriorityQueue& q) = default;
+  IndexedPriorityQueue(IndexedPriorityQueue&& q) noexcept;
+  ~IndexedPriorityQueue() = default;
+  IndexedPriorityQueue& operator=(IndexedPriorityQueue&& q) noexcept;
+
+  // IndexedPriorityQueue Element access
+  ConstReference Top() const;
+  Handle TopHandle() const;
+  ConstReference Get(Handle handle) const;
+
+  // IndexedPriorityQueue Capacity
+  bool Empty() const { return heap_.Empty(); }
+  SizeType Size() const { return heap_.Size(); }
+  // True while handle refers to an element in the queue
+  bool Contains(Handle handle) const;
+  void Reserve(SizeType n);
+
+  // IndexedPriorityQueue Modifiers
+  Handle Push(ConstReference value);
+  Handle Push(ValueType&& value);
+  void Pop();
+  // value must not compare greater than the current one
+  void DecreaseKey(Handle handle, ValueType value);
+  // value must not compare less than the current one
+  void IncreaseKey(Handle handle, ValueType value);
+  // Re-keys in either direction
+  void Update(Handle handle, ValueType value);
+  void Erase(Handle handle);
+  void Clear();
+  void Swap(IndexedPriorityQueue& other);
+
+ private:
+  struct Entry {
+    ValueType value;
+    Handle handle;
+  };
+
+  static constexpr SizeType kNoPosition = std::numeric_limits<SizeType>::max();
+
+  Vector<Entry> heap_;
+  Vector<SizeType> positions_;  // heap index per handle, or kNoPosition
+  Vector<Handle> free_handles_;
+  Compare compare_;
+
+  // Support functions
+  static SizeType Parent(SizeType i) { return (i - 1) / Arity; }
+  static SizeType FirstChild(SizeType i) { return i * Arity + 1; }
+  SizeType Position(Handle handle) const;
+  void Place(SizeType index, Entry&& entry);
+  void SiftUp(SizeType hole, Entry entry);
+  void SiftDown(SizeType hole, Entry entry);
+  void RemoveAt(SizeType index);
+};
+
+// IndexedPriorityQueue Member functions
+template <class T, class Compare, size_t Arity>
+IndexedPriorityQueue<T, Compare, Arity>::IndexedPriorityQueue(
+    IndexedPriorityQueue&& q) noexcept
+    : heap_(std::move(q.heap_)),
+      positions_(std::move(q.positions_)),
+      free_handles_(std::move(q.free_handles_)),
+      compare_(q.compare_) {}
+
+template <class T, class Compare, size_t Arity>
+IndexedPriorityQueue<T, Compare, Arity>&
+IndexedPriorityQueue<T, Compare, Arity>::operator=(
+    IndexedPriorityQueue&& q) noexcept {
+  heap_ = std::move(q.heap_);
+  positions_ = std::move(q.positions_);
+  free_handles_ = std::move(q.free_handles_);
+  compare_ = q.compare_;
+  return *this;
+}
+
+// IndexedPriorityQueue Element access
+template <class T, class Compare, size_t Arity>
+typename IndexedPriorityQueue<T, Compare, Arity>::ConstReference
+IndexedPriorityQueue<T, Compare, Arity>::Top() const {
+  if (Empty()) {
+    throw std::out_of_range("Container is empty");
+  }
+  return heap_.Front().value;
+}
+
+template <class T, class Compare, size_t Arity>
+typename IndexedPriorityQueue<T, Compare, Arity>::Handle
+IndexedPriorityQueue<T, Compare, Arity>::TopHandle() const {
+  if (Empty()) {
+    throw std::out_of_range("Container is empty");
+  }
+  return heap_.Front().handle;
+}
+
+template <class T, class Compare, size_t Arity>
+typename IndexedPriorityQueue<T, Compare, Arity>::ConstReference
+IndexedPriorityQueue<T, Compare, Arity>::Get(Handle handle) const {
+  return heap_[Position(handle)].value;
+}
+
+// IndexedPriorityQueue Capacity
+template <class T, class Compare, size_t Arity>
+bool IndexedPriorityQueue<T, Compare, Arity>::Contains(Handle handle) const {
+  return handle < positions_.Size() && positions_[handle] != kNoPosition;
+}
+
+template <class T, class Compare, size_t Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::Reserve(SizeType n) {
+  heap_.Reserve(n);
+  positions_.Reserve(n);
+}
+
+// IndexedPriorityQueue Modifiers
+template <class T, class Compare, size_t Arity>
+typename IndexedPriorityQueue<T, Compare, Arity>::Handle
+IndexedPriorityQueue<T, Compare, Arity>::Push(ConstReference value) {
+  return Push(ValueType(value));
+}
+
+template <class T, class Compare, size_t Arity>
+typename IndexedPriorityQueue<T, Compare, Arity>::Handle
+IndexedPriorityQueue<T, Compare, Arity>::Push(ValueType&& value) {
+  Handle handle;
+  if (free_handles_.Empty()) {
+    handle = positions_.Size();
+    positions_.PushBack(kNoPosition);
+  } else {
+    handle = free_handles_.Back();
+    free_handles_.PopBack();
+  }
+  heap_.PushBack(Entry{std::move(value), handle});
+  SiftUp(Size() - 1, std::move(heap_[Size() - 1]));
+  return handle;
+}
+
+template <class T, class Compare, size_t Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::Pop() {
+  if (Empty()) {
+    throw std::out_of_range("Container is empty");
+  }
+  RemoveAt(0);
+}
+
+template <class T, class Compare, size_t Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::DecreaseKey(Handle handle,
+                                                         ValueType value) {
+  SizeType index = Position(handle);
+  SiftUp(index, Entry{std::move(value), handle});
+}
+
+template <class T, class Compare, size_t Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::IncreaseKey(Handle handle,
+                                                         ValueType value) {
+  SizeType index = Position(handle);
+  SiftDown(index, Entry{std::move(value), handle});
+}
+
+template <class T, class Compare, size_t Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::Update(Handle handle,
+                                                    ValueType value) {
+  SizeType index = Position(handle);
+  if (compare_(value, heap_[index].value)) {
+    SiftUp(index, Entry{std::move(value), handle});
+  } else {
+    SiftDown(index, Entry{std::move(value), handle});
+  }
+}
+
+template <class T, class Compare, size_t Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::Erase(Handle handle) {
+  RemoveAt(Position(handle));
+}
+
+template <class T, class Compare, size_t Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::Clear() {
+  IndexedPriorityQueue empty(compare_);
+  Swap(empty);
+}
+
+template <class T, class Compare, size_t Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::Swap(
+    IndexedPriorityQueue& other) {
+  heap_.Swap(other.heap_);
+  positions_.Swap(other.positions_);
+  free_handles_.Swap(other.free_handles_);
+  std::swap(compare_, other.compare_);
+}
+
+// Support functions
+template <class T, class Compare, size_t Arity>
+typename IndexedPriorityQueue<T, Compare, Arity>::SizeType
+IndexedPriorityQueue<T, Compare, Arity>::Position(Handle handle) const {
+  if (!Contains(handle)) {
+    throw std::out_of_range("This index is out of range");
+  }
+  return positions_[handle];
+}
+
+template <class T, class Compare, size_t Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::Place(SizeType index,
+                                                   Entry&& entry) {
+  positions_[entry.handle] = index;
+  heap_[index] = std::move(entry);
+}
+
+template <class T, class Compare, size_t Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::SiftUp(SizeType hole,
+                                                    Entry entry) {
+  while (hole > 0) {
+    SizeType parent = Parent(hole);
+    if (!compare_(entry.value, heap_[parent].value)) break;
+    Place(hole, std::move(heap_[parent]));
+    hole = parent;
+  }
+  Place(hole, std::move(entry));
+}
+
+template <class T, class Compare, size_t Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::SiftDown(SizeType hole,
+                                                      Entry entry) {
+  SizeType size = Size();
+  for (SizeType first = FirstChild(hole); first < size;
+       first = FirstChild(hole)) {
+    SizeType best = first;
+    SizeType end = first + Arity < size ? first + Arity : size;
+    for (SizeType child = first + 1; child < end; ++child) {
+      if (compare_(heap_[child].value, heap_[best].value)) best = child;
+    }
+    if (!compare_(heap_[best].value, entry.value)) break;
+    Place(hole, std::move(heap_[best]));
+    hole = best;
+  }
+  Place(hole, std::move(entry));
+}
+
+// The last entry fills the hole and is sifted in whichever direction it
+// belongs
+template <class T, class Compare, size_t Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::RemoveAt(SizeType index) {
+  Handle handle = heap_[index].handle;
+  positions_[handle] = kNoPosition;
+  free_handles_.PushBack(handle);
+  Entry last = std::move(heap_[Size() - 1]);
+  heap_.PopBack();
+  if (index == Size()) return;
+  if (index > 0 && compare_(last.value, heap_[Parent(index)].value)) {
+    SiftUp(index, std::move(last));
+  } else {
+    SiftDown(index, std::move(last));
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_INDEXED_PRIORITY_QUEUE_H_
@@ -0,0 +1,281 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_INTRUSIVE_LIST_H_
+#define SRC_CONTAINERS_EXTRA_S21_INTRUSIVE_LIST_H_
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+// Links embedded in a user type so that its objects can be put into an
+// IntrusiveList without any allocation. A type that has to be in several
+// lists at once carries one hook per list.
+struct IntrusiveListHook {
+  IntrusiveListHook* next_ = nullptr;
+  IntrusiveListHook* prev_ = nullptr;
+
+  IntrusiveListHook() = default;
+  // Copying an object must not copy its membership
+  IntrusiveListHook(const IntrusiveListHook&) {}
+  IntrusiveListHook& operator=(const IntrusiveListHook&) { return *this; }
+
+  bool Linked() const { return next_ != nullptr; }
+};
+
+// Doubly linked list of objects the list does not own, threaded through the
+// IntrusiveListHook member Hook of T. The list never copies, allocates or
+// destroys elements; an object must stay alive while it is linked and may be
+// linked into only one list per hook. Because the links are inside the
+// object, Erase(object) unlinks it in O(1) without searching.
+template <class T, IntrusiveListHook T::*Hook>
+class IntrusiveList {
+ public:
+  // IntrusiveList Member type
+  using ValueType = T;
+  using Reference = T&;
+  using ConstReference = const T&;
+  using SizeType = size_t;
+
+  // internal class IntrusiveListIterator
+  template <class Value>
+  class IteratorBase {
+    friend class IntrusiveList;
+
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value*;
+    using reference = Value&;
+
+    IteratorBase() = default;
+    explicit IteratorBase(IntrusiveListHook* hook) : hook_(hook) {}
+    // Iterator converts to ConstIterator
+    template <class Other>
+    IteratorBase(const IteratorBase<Other>& other) : hook_(other.hook_) {}
+
+    reference operator*() const noexcept { return *Owner(hook_); }
+    pointer operator->() const noexcept { return Owner(hook_); }
+
+    IteratorBase& operator++() noexcept {
+      hook_ = hook_->next_;
+      return *this;
+    }
+
+    IteratorBase operator++(int) noexcept {
+      IteratorBase tmp = *this;
+      hook_ = hook_->next_;
+      return tmp;
+    }
+
+    IteratorBase& operator--() noexcept {
+      hook_ = hook_->prev_;
+      return *this;
+    }
+
+    IteratorBase operator--(int) noexcept {
+      IteratorBase tmp = *this;
+      hook_ = hook_->prev_;
+      return tmp;
+    }
+
+    bool operator==(const IteratorBase& other) const noexcept {
+      return hook_ == other.hook_;
+    }
+
+    bool operator!=(const IteratorBase& other) const noexcept {
+      return hook_ != other.hook_;
+    }
+
+   private:
+    template <class>
+    friend class IteratorBase;
+    IntrusiveListHook* hook_ = nullptr;
+  };
+
+  using Iterator = IteratorBase<T>;
+  using ConstIterator = IteratorBase<const T>;
+
+  // IntrusiveList Member functions
+  IntrusiveList() { head_.next_ = head_.prev_ = &head_; }
+  IntrusiveList(const IntrusiveList& l) = delete;
+  IntrusiveList(IntrusiveList&& l) noexcept : IntrusiveList() { Swap(l); }
+  ~IntrusiveList() { Clear(); }
+  IntrusiveList& operator=(const IntrusiveList& l) = delete;
+  IntrusiveList& operator=(IntrusiveList&& l) noexcept;
+
+  // IntrusiveList Element access
+  Reference Front();
+  Reference Back();
+
+  // IntrusiveList Iterators
+  Iterator Begin() { return Iterator(head_.next_); }
+  Iterator End() { return Iterator(&head_); }
+  ConstIterator Cbegin() const { return ConstIterator(head_.next_); }
+  ConstIterator Cend() const {
+    return ConstIterator(const_cast<IntrusiveListHook*>(&head_));
+  }
+  // Iterator to an object that is linked into this list, in O(1)
+  static Iterator IteratorTo(Reference value) {
+    return Iterator(&(value.*Hook));
+  }
+
+  // IntrusiveList Capacity
+  bool Empty() const { return size_ == 0; }
+  SizeType Size() const { return size_; }
+
+  // IntrusiveList Modifiers
+  // Unlinks every element; the objects themselves are left alone
+  void Clear();
+  Iterator Insert(Iterator pos, Reference value);
+  Iterator Erase(Iterator pos);
+  // Unlinks value, which must be linked into this list
+  void Erase(Reference value) { Erase(IteratorTo(value)); }
+  void PushBack(Reference value) { Insert(End(), value); }
+  void PushFront(Reference value) { Insert(Begin(), value); }
+  void PopBack();
+  void PopFront();
+  void Swap(IntrusiveList& other);
+  // Moves all elements of other in front of pos by relinking
+  void Splice(Iterator pos, IntrusiveList& other);
+
+ private:
+  IntrusiveListHook head_;
+  SizeType size_ = 0;
+
+  // Support functions
+  static std::ptrdiff_t HookOffset();
+  static T* Owner(IntrusiveListHook* hook);
+  void CheckNotEmpty() const;
+};
+
+// IntrusiveList Member functions
+template <class T, IntrusiveListHook T::*Hook>
+IntrusiveList<T, Hook>& IntrusiveList<T, Hook>::operator=(
+    IntrusiveList&& l) noexcept {
+  Clear();
+  Swap(l);
+  return *this;
+}
+
+// IntrusiveList Element access
+template <class T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::Reference IntrusiveList<T, Hook>::Front() {
+  CheckNotEmpty();
+  return *Begin();
+}
+
+template <class T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::Reference IntrusiveList<T, Hook>::Back() {
+  CheckNotEmpty();
+  return *Iterator(head_.prev_);
+}
+
+// IntrusiveList Modifiers
+template <class T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::Clear() {
+  IntrusiveListHook* hook = head_.next_;
+  while (hook != &head_) {
+    IntrusiveListHook* next = hook->next_;
+    hook->next_ = hook->prev_ = nullptr;
+    hook = next;
+  }
+  head_.next_ = head_.prev_ = &head_;
+  size_ = 0;
+}
+
+template <class T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::Iterator IntrusiveList<T, Hook>::Insert(
+    Iterator pos, Reference value) {
+  IntrusiveListHook* hook = &(value.*Hook);
+  IntrusiveListHook* next = pos.hook_;
+  hook->next_ = next;
+  hook->prev_ = next->prev_;
+  next->prev_->next_ = hook;
+  next->prev_ = hook;
+  ++size_;
+  return Iterator(hook);
+}
+
+template <class T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::Iterator IntrusiveList<T, Hook>::Erase(
+    Iterator pos) {
+  IntrusiveListHook* hook = pos.hook_;
+  IntrusiveListHook* next = hook->next_;
+  hook->prev_->next_ = next;
+  next->prev_ = hook->prev_;
+  hook->next_ = hook->prev_ = nullptr;
+  --size_;
+  return Iterator(next);
+}
+
+template <class T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::PopBack() {
+  CheckNotEmpty();
+  Erase(Iterator(head_.prev_));
+}
+
+template <class T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::PopFront() {
+  CheckNotEmpty();
+  Erase(Begin());
+}
+
+// The sentinels stay where they are, so the neighbours of each one are
+// repointed after the exchange
+template <class T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::Swap(IntrusiveList& other) {
+  std::swap(head_.next_, other.head_.next_);
+  std::swap(head_.prev_, other.head_.prev_);
+  std::swap(size_, other.size_);
+  for (IntrusiveList* list : {this, &other}) {
+    if (list->size_ == 0) {
+      list->head_.next_ = list->head_.prev_ = &list->head_;
+    } else {
+      list->head_.next_->prev_ = &list->head_;
+      list->head_.prev_->next_ = &list->head_;
+    }
+  }
+}
+
+template <class T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::Splice(Iterator pos, IntrusiveList& other) {
+  if (&other == this || other.Empty()) return;
+  IntrusiveListHook* first = other.head_.next_;
+  IntrusiveListHook* last = other.head_.prev_;
+  IntrusiveListHook* next = pos.hook_;
+  first->prev_ = next->prev_;
+  next->prev_->next_ = first;
+  last->next_ = next;
+  next->prev_ = last;
+  size_ += other.size_;
+  other.head_.next_ = other.head_.prev_ = &other.head_;
+  other.size_ = 0;
+}
+
+// Support functions
+// Offset of the hook inside T, computed from the member pointer on an
+// unconstructed buffer; only the address of the member is taken
+template <class T, IntrusiveListHook T::*Hook>
+std::ptrdiff_t IntrusiveList<T, Hook>::HookOffset() {
+  alignas(T) static char probe[sizeof(T)];
+  T* object = reinterpret_cast<T*>(probe);
+  return reinterpret_cast<char*>(&(object->*Hook)) - probe;
+}
+
+template <class T, IntrusiveListHook T::*Hook>
+T* IntrusiveList<T, Hook>::Owner(IntrusiveListHook* hook) {
+  return reinterpret_cast<T*>(reinterpret_cast<char*>(hook) - HookOffset());
+}
+
+template <class T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::CheckNotEmpty() const {
+  if (Empty()) {
+    throw std::out_of_range("Container is empty");
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_INTRUSIVE_LIST_H_
@@ -0,0 +1,576 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_INTRUSIVE_SET_H_
+#define SRC_CONTAINERS_EXTRA_S21_INTRUSIVE_SET_H_
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+namespace s21 {
+// Red-black tree links embedded in a user type so that its objects can be
+// put into an IntrusiveSet without any allocation. A type that has to be in
+// several sets at once carries one hook per set.
+struct IntrusiveSetHook {
+  IntrusiveSetHook* parent_ = nullptr;
+  IntrusiveSetHook* left_ = nullptr;
+  IntrusiveSetHook* right_ = nullptr;
+  bool red_ = false;
+
+  IntrusiveSetHook() = default;
+  // Copying an object must not copy its membership
+  IntrusiveSetHook(const IntrusiveSetHook&) {}
+  IntrusiveSetHook& operator=(const IntrusiveSetHook&) { return *this; }
+
+  bool Linked() const { return parent_ != nullptr; }
+};
+
+// Ordered set of objects the set does not own, threaded through the
+// IntrusiveSetHook member Hook of T and kept balanced as a red-black tree.
+// Like IntrusiveList it never copies, allocates or destroys elements, and an
+// object must not change its key while it is linked.
+//
+// The header hook doubles as End(): its parent_ is the root (whose parent_
+// points back to the header), and its left_/right_ cache the smallest and
+// largest element, so Begin() and --End() are O(1). Lookups accept any key
+// the comparator can compare with T, e.g. with Compare = std::less<>.
+template <class T, IntrusiveSetHook T::*Hook, class Compare = std::less<T>>
+class IntrusiveSet {
+ public:
+  // IntrusiveSet Member type
+  using KeyType = T;
+  using ValueType = T;
+  using Reference = T&;
+  using ConstReference = const T&;
+  using SizeType = size_t;
+
+  // internal class IntrusiveSetIterator
+  template <class Value>
+  class IteratorBase {
+    friend class IntrusiveSet;
+
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value*;
+    using reference = Value&;
+
+    IteratorBase() = default;
+    IteratorBase(IntrusiveSetHook* hook, const IntrusiveSetHook* header)
+        : hook_(hook), header_(header) {}
+    // Iterator converts to ConstIterator
+    template <class Other>
+    IteratorBase(const IteratorBase<Other>& other)
+        : hook_(other.hook_), header_(other.header_) {}
+
+    reference operator*() const noexcept { return *Owner(hook_); }
+    pointer operator->() const noexcept { return Owner(hook_); }
+
+    IteratorBase& operator++() noexcept {
+      hook_ = Next(hook_, header_);
+      return *this;
+    }
+
+    IteratorBase operator++(int) noexcept {
+      IteratorBase tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    IteratorBase& operator--() noexcept {
+      hook_ = Prev(hook_, header_);
+      return *this;
+    }
+
+    IteratorBase operator--(int) noexcept {
+      IteratorBase tmp = *this;
+      --*this;
+      return tmp;
+    }
+
+    bool operator==(const IteratorBase& other) const noexcept {
+      return hook_ == other.hook_;
+    }
+
+    bool operator!=(const IteratorBase& other) const noexcept {
+      return hook_ != other.hook_;
+    }
+
+   private:
+    template <class>
+    friend class IteratorBase;
+    IntrusiveSetHook* hook_ = nullptr;
+    const IntrusiveSetHook* header_ = nullptr;
+  };
+
+  using Iterator = IteratorBase<T>;
+  using ConstIterator = IteratorBase<const T>;
+
+  // IntrusiveSet Member functions
+  IntrusiveSet() { ResetHeader(); }
+  explicit IntrusiveSet(const Compare& compare) : compare_(compare) {
+    ResetHeader();
+  }
+  IntrusiveSet(const IntrusiveSet& s) = delete;
+  IntrusiveSet(IntrusiveSet&& s) noexcept : IntrusiveSet() { Swap(s); }
+  ~IntrusiveSet() { Clear(); }
+  IntrusiveSet& operator=(const IntrusiveSet& s) = delete;
+  IntrusiveSet& operator=(IntrusiveSet&& s) noexcept;
+
+  // IntrusiveSet Iterators
+  Iterator Begin() { return Iterator(header_.left_, &header_); }
+  Iterator End() { return Iterator(&header_, &header_); }
+  ConstIterator Cbegin() const;
+  ConstIterator Cend() const;
+  // Iterator to an object that is linked into this set, in O(1)
+  Iterator IteratorTo(Reference value) {
+    return Iterator(&(value.*Hook), &header_);
+  }
+
+  // IntrusiveSet Capacity
+  bool Empty() const { return size_ == 0; }
+  SizeType Size() const { return size_; }
+
+  // IntrusiveSet Modifiers
+  // Unlinks every element; the objects themselves are left alone
+  void Clear();
+  // Links value unless an equivalent element is already in the set
+  std::pair<Iterator, bool> Insert(Reference value);
+  Iterator Erase(Iterator pos);
+  // Unlinks value, which must be linked into this set, without a lookup
+  void Erase(Reference value) { Erase(IteratorTo(value)); }
+  void Swap(IntrusiveSet& other);
+
+  // IntrusiveSet Lookup
+  template <class Key>
+  Iterator Find(const Key& key);
+  template <class Key>
+  bool Contains(const Key& key);
+  template <class Key>
+  Iterator LowerBound(const Key& key);
+  template <class Key>
+  Iterator UpperBound(const Key& key);
+
+ private:
+  IntrusiveSetHook header_;
+  SizeType size_ = 0;
+  Compare compare_;
+
+  // Support functions
+  IntrusiveSetHook* Root() const { return header_.parent_; }
+  void ResetHeader();
+  void RotateLeft(IntrusiveSetHook* x);
+  void RotateRight(IntrusiveSetHook* x);
+  void Transplant(IntrusiveSetHook* u, IntrusiveSetHook* v);
+  void InsertFixup(IntrusiveSetHook* z);
+  void EraseFixup(IntrusiveSetHook* x, IntrusiveSetHook* parent);
+  static IntrusiveSetHook* Leftmost(IntrusiveSetHook* x);
+  static IntrusiveSetHook* Rightmost(IntrusiveSetHook* x);
+  static IntrusiveSetHook* Next(IntrusiveSetHook* x,
+                                const IntrusiveSetHook* header);
+  static IntrusiveSetHook* Prev(IntrusiveSetHook* x,
+                                const IntrusiveSetHook* header);
+  static std::ptrdiff_t HookOffset();
+  static T* Owner(IntrusiveSetHook* hook);
+  static bool IsRed(const IntrusiveSetHook* x) { return x && x->red_; }
+};
+
+// IntrusiveSet Member functions
+template <class T, IntrusiveSetHook T::*Hook, class Compare>
+IntrusiveSet<T, Hook, Compare>& IntrusiveSet<T, Hook, Compare>::operator=(
+    IntrusiveSet&& s) noexcept {
+  Clear();
+  Swap(s);
+  return *this;
+}
+
+// IntrusiveSet Iterators
+template <class T, IntrusiveSetHook T::*Hook, class Compare>
+typename IntrusiveSet<T, Hook, Compare>::ConstIterator
+IntrusiveSet<T, Hook, Compare>::Cbegin() const {
+  return ConstIterator(header_.left_, &header_);
+}
+
+template <class T, IntrusiveSetHook T::*Hook, class Compare>
+typename IntrusiveSet<T, Hook, Compare>::ConstIterator
+IntrusiveSet<T, Hook, Compare>::Cend() const {
+  return ConstIterator(const_cast<IntrusiveSetHook*>(&header_), &header_);
+}
+
+// IntrusiveSet Modifiers
+// Post-order walk along the parent links, so no stack is needed
+template <class T, IntrusiveSetHook T::*Hook, class Compare>
+void IntrusiveSet<T, Hook, Compare>::Clear() {
+  IntrusiveSetHook* node = Root();
+  while (node) {
+    if (node->left_) {
+      node = node->left_;
+    } else if (node->right_) {
+      node = node->right_;
+    } else {
+      IntrusiveSetHook* parent = node->parent_;
+      if (parent == &header_) {
+        parent = nullptr;
+      } else if (parent->left_ == node) {
+        parent->left_ = nullptr;
+      } else {
+        parent->right_ = nullptr;
+      }
+      node->parent_ = nullptr;
+      node->red_ = false;
+      node = parent;
+    }
+  }
+  ResetHeader();
+  size_ = 0;
+}
+
+template <class T, IntrusiveSetHook T::*Hook, class Compare>
+std::pair<typename IntrusiveSet<T, Hook, Compare>::Iterator, bool>
+IntrusiveSet<T, Hook, Compare>::Insert(Reference value) {
+  IntrusiveSetHook* parent = &header_;
+  IntrusiveSetHook* node = Root();
+  bool left = true;
+  while (node) {
+    parent = node;
+    left = compare_(value, *Owner(node));
+    node = left ? node->left_ : node->right_;
+  }
+  // The candidate equal element is the predecessor of the insertion point
+  IntrusiveSetHook* previous = parent;
+  if (left) {
+    previous = parent == header_.left_ ? nullptr : Prev(parent, &header_);
+  }
+  if (previous && previous != &header_ &&
+      !compare_(*Owner(previous), value)) {
+    return {Iterator(previous, &header_), false};
+  }
+
+  IntrusiveSetHook* hook = &(value.*Hook);
+  hook->parent_ = parent;
+  hook->left_ = hook->right_ = nullptr;
+  hook->red_ = true;
+  if (parent == &header_) {
+    header_.parent_ = header_.left_ = header_.right_ = hook;
+  } else if (left) {
+    parent->left_ = hook;
+    if (parent == header_.left_) header_.left_ = hook;
+  } else {
+    parent->right_ = hook;
+    if (parent == header_.right_) header_.right_ = hook;
+  }
+  InsertFixup(hook);
+  ++size_;
+  return {Iterator(hook, &header_), true};
+}
+
+template <class T, IntrusiveSetHook T::*Hook, class Compare>
+typename IntrusiveSet<T, Hook, Compare>::Iterator
+IntrusiveSet<T, Hook, Compare>::Erase(Iterator pos) {
+  IntrusiveSetHook* z = pos.hook_;
+  IntrusiveSetHook* next = Next(z, &header_);
+  if (z == header_.left_) header_.left_ = next;
+  if (z == header_.right_) header_.right_ = Prev(z, &header_);
+
+  IntrusiveSetHook* y = z;
+  IntrusiveSetHook* x;
+  IntrusiveSetHook* x_parent;
+  bool removed_red = y->red_;
+  if (!z->left_) {
+    x = z->right_;
+    x_parent = z->parent_;
+    Transplant(z, z->right_);
+  } else if (!z->right_) {
+    x = z->left_;
+    x_parent = z->parent_;
+    Transplant(z, z->left_);
+  } else {
+    y = Leftmost(z->right_);
+    removed_red = y->red_;
+    x = y->right_;
+    if (y->parent_ == z) {
+      x_parent = y;
+    } else {
+      x_parent = y->parent_;
+      Transplant(y, y->right_);
+      y->right_ = z->right_;
+      y->right_->parent_ = y;
+    }
+    Transplant(z, y);
+    y->left_ = z->left_;
+    y->left_->parent_ = y;
+    y->red_ = z->red_;
+  }
+  if (!removed_red) EraseFixup(x, x_parent);
+
+  z->parent_ = z->left_ = z->right_ = nullptr;
+  z->red_ = false;
+  if (--size_ == 0) ResetHeader();
+  return Iterator(next, &header_);
+}
+
+// The headers stay where they are, so the roots are repointed after the
+// exchange
+template <class T, IntrusiveSetHook T::*Hook, class Compare>
+void IntrusiveSet<T, Hook, Compare>::Swap(IntrusiveSet& other) {
+  std::swap(header_.parent_, other.header_.parent_);
+  std::swap(header_.left_, other.header_.left_);
+  std::swap(header_.right_, other.header_.right_);
+  std::swap(size_, other.size_);
+  std::swap(compare_, other.compare_);
+  for (IntrusiveSet* set : {this, &other}) {
+    if (set->size_ == 0) {
+      set->ResetHeader();
+    } else {
+      set->header_.parent_->parent_ = &set->header_;
+    }
+  }
+}
+
+// IntrusiveSet Lookup
+template <class T, IntrusiveSetHook T::*Hook, class Compare>
+template <class Key>
+typename IntrusiveSet<T, Hook, Compare>::Iterator
+IntrusiveSet<T, Hook, Compare>::Find(const Key& key) {
+  Iterator it = LowerBound(key);
+  if (it != End() && compare_(key, *it)) return End();
+  return it;
+}
+
+template <class T, IntrusiveSetHook T::*Hook, class Compare>
+template <class Key>
+bool IntrusiveSet<T, Hook, Compare>::Contains(const Key& key) {
+  return Find(key) != End();
+}
+
+template <class T, IntrusiveSetHook T::*Hook, class Compare>
+template <class Key>
+typename IntrusiveSet<T, Hook, Compare>::Iterator
+IntrusiveSet<T, Hook, Compare>::LowerBound(const Key& key) {
+  IntrusiveSetHook* result = &header_;
+  for (IntrusiveSetHook* node = Root(); node;) {
+    if (compare_(*Owner(node), key)) {
+      node = node->right_;
+    } else {
+      result = node;
+      node = node->left_;
+    }
+  }
+  return Iterator(result, &header_);
+}
+
+template <class T, IntrusiveSetHook T::*Hook, class Compare>
+template <class Key>
+typename IntrusiveSet<T, Hook, Compare>::Iterator
+IntrusiveSet<T, Hook, Compare>::UpperBound(const Key& key) {
+  IntrusiveSetHook* result = &header_;
+  for (IntrusiveSetHook* node = Root(); node;) {
+    if (compare_(key, *Owner(node))) {
+      result = node;
+      node = node->left_;
+    } else {
+      node = node->right_;
+    }
+  }
+  return Iterator(result, &header_);
+}
+
+// Support functions
+template <class T, IntrusiveSetHook T::*Hook, class Compare>
+void IntrusiveSet<T, Hook, Compare>::ResetHeader() {
+  header_.parent_ = nullptr;
+  header_.left_ = header_.right_ = &header_;
+}
+
+template <class T, IntrusiveSetHook T::*Hook, class Compare>
+void IntrusiveSet<T, Hook, Compare>::RotateLeft(IntrusiveSetHook* x) {
+  IntrusiveSetHook* y = x->right_;
+  x->right_ = y->left_;
+  if (y->left_) y->left_->parent_ = x;
+  Transplant(x, y);
+  y->left_ = x;
+  x->parent_ = y;
+}
+
+template <class T, IntrusiveSetHook T::*Hook, class Compare>
+void IntrusiveSet<T, Hook, Compare>::RotateRight(IntrusiveSetHook* x) {
+  IntrusiveSetHook* y = x->left_;
+  x->left_ = y->right_;
+  if (y->right_) y->right_->parent_ = x;
+  Transplant(x, y);
+  y->right_ = x;
+  x->parent_ = y;
+}
+
+// Puts v (possibly null) where u hangs from its parent
+template <class T, IntrusiveSetHook T::*Hook, class Compare>
+void IntrusiveSet<T, Hook, Compare>::Transplant(IntrusiveSetHook* u,
+                                                IntrusiveSetHook* v) {
+  if (u == Root()) {
+    header_.parent_ = v;
+  } else if (u == u->parent_->left_) {
+    u->parent_->left_ = v;
+  } else {
+    u->parent_->right_ = v;
+  }
+  if (v) v->parent_ = u->parent_;
+}
+
+template <class T, IntrusiveSetHook T::*Hook, class Compare>
+void IntrusiveSet<T, Hook, Compare>::InsertFixup(IntrusiveSetHook* z) {
+  while (z != Root() && z->parent_->red_) {
+    IntrusiveSetHook* parent = z->parent_;
+    IntrusiveSetHook* grandparent = parent->parent_;
+    if (parent == grandparent->left_) {
+      IntrusiveSetHook* uncle = grandparent->right_;
+      if (IsRed(uncle)) {
+        parent->red_ = uncle->red_ = false;
+        grandparent->red_ = true;
+        z = grandparent;
+        continue;
+      }
+      if (z == parent->right_) {
+        z = parent;
+        RotateLeft(z);
+        parent = z->parent_;
+      }
+      parent->red_ = false;
+      grandparent->red_ = true;
+      RotateRight(grandparent);
+    } else {
+      IntrusiveSetHook* uncle = grandparent->left_;
+      if (IsRed(uncle)) {
+        parent->red_ = uncle->red_ = false;
+        grandparent->red_ = true;
+        z = grandparent;
+        continue;
+      }
+      if (z == parent->left_) {
+        z = parent;
+        RotateRight(z);
+        parent = z->parent_;
+      }
+      parent->red_ = false;
+      grandparent->red_ = true;
+      RotateLeft(grandparent);
+    }
+  }
+  Root()->red_ = false;
+}
+
+// x may be null (an empty leaf), which is why its parent is passed along
+template <class T, IntrusiveSetHook T::*Hook, class Compare>
+void IntrusiveSet<T, Hook, Compare>::EraseFixup(IntrusiveSetHook* x,
+                                                IntrusiveSetHook* parent) {
+  while (x != Root() && !IsRed(x)) {
+    if (x == parent->left_) {
+      IntrusiveSetHook* sibling = parent->right_;
+      if (sibling->red_) {
+        sibling->red_ = false;
+        parent->red_ = true;
+        RotateLeft(parent);
+        sibling = parent->right_;
+      }
+      if (!IsRed(sibling->left_) && !IsRed(sibling->right_)) {
+        sibling->red_ = true;
+        x = parent;
+        parent = x->parent_;
+        continue;
+      }
+      if (!IsRed(sibling->right_)) {
+        sibling->left_->red_ = false;
+        sibling->red_ = true;
+        RotateRight(sibling);
+        sibling = parent->right_;
+      }
+      sibling->red_ = parent->red_;
+      parent->red_ = false;
+      sibling->right_->red_ = false;
+      RotateLeft(parent);
+    } else {
+      IntrusiveSetHook* sibling = parent->left_;
+      if (sibling->red_) {
+        sibling->red_ = false;
+        parent->red_ = true;
+        RotateRight(parent);
+        sibling = parent->left_;
+      }
+      if (!IsRed(sibling->left_) && !IsRed(sibling->right_)) {
+        sibling->red_ = true;
+        x = parent;
+        parent = x->parent_;
+        continue;
+      }
+      if (!IsRed(sibling->left_)) {
+        sibling->right_->red_ = false;
+        sibling->red_ = true;
+        RotateLeft(sibling);
+        sibling = parent->left_;
+      }
+      sibling->red_ = parent->red_;
+      parent->red_ = false;
+      sibling->left_->red_ = false;
+      RotateRight(parent);
+    }
+    x = Root();
+  }
+  if (x) x->red_ = false;
+}
+
+template <class T, IntrusiveSetHook T::*Hook, class Compare>
+IntrusiveSetHook* IntrusiveSet<T, Hook, Compare>::Leftmost(
+    IntrusiveSetHook* x) {
+  while (x->left_) x = x->left_;
+  return x;
+}
+
+template <class T, IntrusiveSetHook T::*Hook, class Compare>
+IntrusiveSetHook* IntrusiveSet<T, Hook, Compare>::Rightmost(
+    IntrusiveSetHook* x) {
+  while (x->right_) x = x->right_;
+  return x;
+}
+
+template <class T, IntrusiveSetHook T::*Hook, class Compare>
+IntrusiveSetHook* IntrusiveSet<T, Hook, Compare>::Next(
+    IntrusiveSetHook* x, const IntrusiveSetHook* header) {
+  if (x->right_) return Leftmost(x->right_);
+  IntrusiveSetHook* parent = x->parent_;
+  while (parent != header && x == parent->right_) {
+    x = parent;
+    parent = parent->parent_;
+  }
+  return parent;
+}
+
+// Stepping back from End() lands on the largest element
+template <class T, IntrusiveSetHook T::*Hook, class Compare>
+IntrusiveSetHook* IntrusiveSet<T, Hook, Compare>::Prev(
+    IntrusiveSetHook* x, const IntrusiveSetHook* header) {
+  if (x == header) return x->right_;
+  if (x->left_) return Rightmost(x->left_);
+  IntrusiveSetHook* parent = x->parent_;
+  while (parent != header && x == parent->left_) {
+    x = parent;
+    parent = parent->parent_;
+  }
+  return parent;
+}
+
+// Offset of the hook inside T, computed from the member pointer on an
+// unconstructed buffer; only the address of the member is taken
+template <class T, IntrusiveSetHook T::*Hook, class Compare>
+std::ptrdiff_t IntrusiveSet<T, Hook, Compare>::HookOffset() {
+  alignas(T) static char probe[sizeof(T)];
+  T* object = reinterpret_cast<T*>(probe);
+  return reinterpret_cast<char*>(&(object->*Hook)) - probe;
+}
+
+template <class T, IntrusiveSetHook T::*Hook, class Compare>
+T* IntrusiveSet<T, Hook, Compare>::Owner(IntrusiveSetHook* hook) {
+  return reinterpret_cast<T*>(reinterpret_cast<char*>(hook) - HookOffset());
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_INTRUSIVE_SET_H_
@@ -0,0 +1,258 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_LOCK_FREE_STACK_H_
+#define SRC_CONTAINERS_EXTRA_S21_LOCK_FREE_STACK_H_
+
+#include <atomic>
+#include <cstdint>
+#include <initializer_list>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// Treiber stack that may be pushed and popped from any number of threads.
+//
+// The head is a tagged pointer: the low 48 bits hold the node address and
+// the high 16 bits a counter bumped by every successful update, so a
+// compare-and-swap against a head that was popped and pushed back in the
+// meantime (ABA) fails. Popped nodes are not freed but recycled through an
+// internal free list (itself a tagged Treiber stack), which keeps every node
+// a racing Pop may still be looking at valid until the stack is destroyed.
+template <class T>
+class LockFreeStack {
+ public:
+  // LockFreeStack Member type
+  using ValueType = T;
+  using Reference = T&;
+  using ConstReference = const T&;
+  using SizeType = size_t;
+
+  // LockFreeStack Member functions
+  LockFreeStack() = default;
+  LockFreeStack(std::initializer_list<ValueType> const& items);
+  LockFreeStack(const LockFreeStack& s) = delete;
+  LockFreeStack& operator=(const LockFreeStack& s) = delete;
+  ~LockFreeStack();
+
+  // LockFreeStack Element access
+  // Returns a copy of the top element; only safe while no other thread pops
+  ValueType Top() const;
+
+  // LockFreeStack Capacity
+  bool Empty() const;
+  SizeType Size() const;
+
+  // LockFreeStack Modifiers
+  void Push(ConstReference value);
+  void Push(ValueType&& value);
+  template <typename... Args>
+  void Emplace(Args&&... args);
+  bool TryPop(Reference out);
+  void Pop();
+  // Detaches the whole stack with one compare-and-swap and appends the
+  // elements to out with PushBack, top first
+  template <class Container>
+  SizeType PopAll(Container& out);
+
+ private:
+  struct Node {
+    std::atomic<Node*> next{nullptr};
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+
+    T* Value() { return std::launder(reinterpret_cast<T*>(&storage)); }
+  };
+
+  using Tagged = std::uintptr_t;
+
+  static constexpr int kPointerBits = 48;
+  static constexpr Tagged kPointerMask = (Tagged(1) << kPointerBits) - 1;
+  static_assert(sizeof(Tagged) == 8, "tagged pointers need a 64-bit target");
+
+  std::atomic<Tagged> head_{0};
+  std::atomic<Tagged> free_{0};
+  std::atomic<SizeType> size_{0};
+
+  // Support functions
+  static Node* Address(Tagged tagged);
+  static Tagged Retag(Tagged old, Node* node);
+  static void PushChain(std::atomic<Tagged>& top, Node* first, Node* last);
+  static Node* PopNode(std::atomic<Tagged>& top);
+  Node* AcquireNode();
+  static void DeleteChain(Node* node);
+};
+
+// LockFreeStack Member functions
+template <class T>
+LockFreeStack<T>::LockFreeStack(std::initializer_list<ValueType> const& items) {
+  for (auto it = items.begin(); it != items.end(); ++it) {
+    Push(*it);
+  }
+}
+
+template <class T>
+LockFreeStack<T>::~LockFreeStack() {
+  for (Node* node = Address(head_.load()); node;
+       node = node->next.load(std::memory_order_relaxed)) {
+    node->Value()->~ValueType();
+  }
+  DeleteChain(Address(head_.load()));
+  DeleteChain(Address(free_.load()));
+}
+
+// LockFreeStack Element access
+template <class T>
+typename LockFreeStack<T>::ValueType LockFreeStack<T>::Top() const {
+  Node* node = Address(head_.load(std::memory_order_acquire));
+  if (!node) {
+    throw std::out_of_range("Container is empty");
+  }
+  return *node->Value();
+}
+
+// LockFreeStack Capacity
+template <class T>
+bool LockFreeStack<T>::Empty() const {
+  return Address(head_.load(std::memory_order_acquire)) == nullptr;
+}
+
+// Maintained next to the head, so it may count pushes that are still in
+// flight. A push counts its element before publishing it and a pop uncounts
+// it only after taking it, so the count never drops below zero.
+template <class T>
+typename LockFreeStack<T>::SizeType LockFreeStack<T>::Size() const {
+  return size_.load(std::memory_order_relaxed);
+}
+
+// LockFreeStack Modifiers
+template <class T>
+void LockFreeStack<T>::Push(ConstReference value) {
+  Emplace(value);
+}
+
+template <class T>
+void LockFreeStack<T>::Push(ValueType&& value) {
+  Emplace(std::move(value));
+}
+
+template <class T>
+template <typename... Args>
+void LockFreeStack<T>::Emplace(Args&&... args) {
+  Node* node = AcquireNode();
+  try {
+    new (&node->storage) ValueType(std::forward<Args>(args)...);
+  } catch (...) {
+    PushChain(free_, node, node);
+    throw;
+  }
+  // Before the release in PushChain, so the pop that takes node sees it
+  size_.fetch_add(1, std::memory_order_relaxed);
+  PushChain(head_, node, node);
+}
+
+template <class T>
+bool LockFreeStack<T>::TryPop(Reference out) {
+  Node* node = PopNode(head_);
+  if (!node) return false;
+  size_.fetch_sub(1, std::memory_order_relaxed);
+  out = std::move(*node->Value());
+  node->Value()->~ValueType();
+  PushChain(free_, node, node);
+  return true;
+}
+
+template <class T>
+void LockFreeStack<T>::Pop() {
+  Node* node = PopNode(head_);
+  if (node) {
+    size_.fetch_sub(1, std::memory_order_relaxed);
+    node->Value()->~ValueType();
+    PushChain(free_, node, node);
+  }
+}
+
+template <class T>
+template <class Container>
+typename LockFreeStack<T>::SizeType LockFreeStack<T>::PopAll(Container& out) {
+  Tagged old = head_.load(std::memory_order_acquire);
+  while (Address(old) && !head_.compare_exchange_weak(
+                             old, Retag(old, nullptr),
+                             std::memory_order_acq_rel,
+                             std::memory_order_acquire)) {
+  }
+  Node* first = Address(old);
+  Node* last = nullptr;
+  SizeType count = 0;
+  for (Node* node = first; node;
+       node = node->next.load(std::memory_order_relaxed)) {
+    out.PushBack(std::move(*node->Value()));
+    node->Value()->~ValueType();
+    last = node;
+    ++count;
+  }
+  if (count) {
+    size_.fetch_sub(count, std::memory_order_relaxed);
+    PushChain(free_, first, last);
+  }
+  return count;
+}
+
+// Support functions
+template <class T>
+typename LockFreeStack<T>::Node* LockFreeStack<T>::Address(Tagged tagged) {
+  return reinterpret_cast<Node*>(tagged & kPointerMask);
+}
+
+template <class T>
+typename LockFreeStack<T>::Tagged LockFreeStack<T>::Retag(Tagged old,
+                                                          Node* node) {
+  Tagged tag = (old >> kPointerBits) + 1;
+  return (tag << kPointerBits) | reinterpret_cast<Tagged>(node);
+}
+
+template <class T>
+void LockFreeStack<T>::PushChain(std::atomic<Tagged>& top, Node* first,
+                                 Node* last) {
+  Tagged old = top.load(std::memory_order_relaxed);
+  do {
+    last->next.store(Address(old), std::memory_order_relaxed);
+  } while (!top.compare_exchange_weak(old, Retag(old, first),
+                                      std::memory_order_acq_rel,
+                                      std::memory_order_relaxed));
+}
+
+// A node read here may be popped and even reused by another thread before
+// the compare-and-swap; its next is then stale, but the tag has changed as
+// well and the compare-and-swap fails
+template <class T>
+typename LockFreeStack<T>::Node* LockFreeStack<T>::PopNode(
+    std::atomic<Tagged>& top) {
+  Tagged old = top.load(std::memory_order_acquire);
+  while (Address(old)) {
+    Node* next = Address(old)->next.load(std::memory_order_relaxed);
+    if (top.compare_exchange_weak(old, Retag(old, next),
+                                  std::memory_order_acq_rel,
+                                  std::memory_order_acquire)) {
+      break;
+    }
+  }
+  return Address(old);
+}
+
+template <class T>
+typename LockFreeStack<T>::Node* LockFreeStack<T>::AcquireNode() {
+  Node* node = PopNode(free_);
+  return node ? node : new Node;
+}
+
+template <class T>
+void LockFreeStack<T>::DeleteChain(Node* node) {
+  while (node) {
+    Node* next = node->next.load(std::memory_order_relaxed);
+    delete node;
+    node = next;
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_LOCK_FREE_STACK_H_
@@ -0,0 +1,258 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_MPMC_QUEUE_H_
+#define SRC_CONTAINERS_EXTRA_S21_MPMC_QUEUE_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// Bounded lock-free queue for any number of producer and consumer threads
+// (Vyukov's array queue). Every cell carries a sequence number that tells
+// whether it is ready to be written for lap `pos` (sequence == pos) or ready
+// to be read (sequence == pos + 1), so producers and consumers only contend
+// on their own position counter.
+template <class T>
+class MpmcQueue {
+ public:
+  // MpmcQueue Member type
+  using ValueType = T;
+  using Pointer = T*;
+  using Reference = T&;
+  using ConstReference = const T&;
+  using SizeType = size_t;
+
+  static constexpr SizeType kCacheLine = 64;
+  static constexpr SizeType kDefaultSpinCount = 64;
+
+  // MpmcQueue Member functions
+  // Blocking Push/Pop retry spin_count times and then, if park is set, sleep
+  // until the other side makes progress; otherwise they keep spinning.
+  explicit MpmcQueue(SizeType capacity,
+                     SizeType spin_count = kDefaultSpinCount,
+                     bool park = true);
+  MpmcQueue(const MpmcQueue& q) = delete;
+  MpmcQueue& operator=(const MpmcQueue& q) = delete;
+  ~MpmcQueue();
+
+  // MpmcQueue Capacity
+  bool Empty() const;
+  SizeType Size() const;
+  SizeType Capacity() const;
+
+  // MpmcQueue Modifiers
+  bool TryPush(ConstReference value);
+  bool TryPush(ValueType&& value);
+  template <typename... Args>
+  bool TryEmplace(Args&&... args);
+  void Push(ConstReference value);
+  void Push(ValueType&& value);
+  bool TryPop(Reference out);
+  void Pop(Reference out);
+
+ private:
+  struct Cell {
+    std::atomic<SizeType> sequence;
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+  };
+
+  alignas(kCacheLine) std::atomic<SizeType> enqueue_pos_{0};
+  alignas(kCacheLine) std::atomic<SizeType> dequeue_pos_{0};
+  alignas(kCacheLine) Cell* buffer_;
+  SizeType mask_;
+  SizeType spin_count_;
+  bool park_;
+
+  // Parked threads sleep on park_mutex_; the counters let the other side
+  // skip the mutex entirely while nobody is parked
+  std::mutex park_mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  std::atomic<SizeType> waiting_consumers_{0};
+  std::atomic<SizeType> waiting_producers_{0};
+
+  // Support functions
+  template <typename... Args>
+  bool Enqueue(Args&&... args);
+  bool Dequeue(Reference out);
+  void Wake(std::atomic<SizeType>& waiting, std::condition_variable& cv);
+  template <class Op>
+  void Wait(Op op, std::atomic<SizeType>& waiting,
+            std::condition_variable& cv);
+};
+
+// MpmcQueue Member functions
+template <class T>
+MpmcQueue<T>::MpmcQueue(SizeType capacity, SizeType spin_count, bool park)
+    : spin_count_(spin_count), park_(park) {
+  SizeType size = 2;
+  while (size < capacity) size <<= 1;
+  mask_ = size - 1;
+  buffer_ = new Cell[size];
+  for (SizeType i = 0; i < size; ++i) {
+    buffer_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+template <class T>
+MpmcQueue<T>::~MpmcQueue() {
+  SizeType tail = enqueue_pos_.load(std::memory_order_relaxed);
+  for (SizeType pos = dequeue_pos_.load(std::memory_order_relaxed);
+       pos != tail; ++pos) {
+    std::launder(reinterpret_cast<Pointer>(&buffer_[pos & mask_].storage))
+        ->~ValueType();
+  }
+  delete[] buffer_;
+}
+
+// MpmcQueue Capacity
+template <class T>
+bool MpmcQueue<T>::Empty() const {
+  return Size() == 0;
+}
+
+// The result is only a snapshot while other threads are pushing or popping
+template <class T>
+typename MpmcQueue<T>::SizeType MpmcQueue<T>::Size() const {
+  SizeType head = dequeue_pos_.load(std::memory_order_acquire);
+  SizeType tail = enqueue_pos_.load(std::memory_order_acquire);
+  return tail > head ? tail - head : 0;
+}
+
+template <class T>
+typename MpmcQueue<T>::SizeType MpmcQueue<T>::Capacity() const {
+  return mask_ + 1;
+}
+
+// MpmcQueue Modifiers
+template <class T>
+bool MpmcQueue<T>::TryPush(ConstReference value) {
+  return TryEmplace(value);
+}
+
+template <class T>
+bool MpmcQueue<T>::TryPush(ValueType&& value) {
+  return TryEmplace(std::move(value));
+}
+
+template <class T>
+template <typename... Args>
+bool MpmcQueue<T>::TryEmplace(Args&&... args) {
+  if (!Enqueue(std::forward<Args>(args)...)) return false;
+  Wake(waiting_consumers_, not_empty_);
+  return true;
+}
+
+template <class T>
+void MpmcQueue<T>::Push(ConstReference value) {
+  Wait([this, &value] { return Enqueue(value); }, waiting_producers_,
+       not_full_);
+  Wake(waiting_consumers_, not_empty_);
+}
+
+template <class T>
+void MpmcQueue<T>::Push(ValueType&& value) {
+  Wait([this, &value] { return Enqueue(std::move(value)); },
+       waiting_producers_, not_full_);
+  Wake(waiting_consumers_, not_empty_);
+}
+
+template <class T>
+bool MpmcQueue<T>::TryPop(Reference out) {
+  if (!Dequeue(out)) return false;
+  Wake(waiting_producers_, not_full_);
+  return true;
+}
+
+template <class T>
+void MpmcQueue<T>::Pop(Reference out) {
+  Wait([this, &out] { return Dequeue(out); }, waiting_consumers_, not_empty_);
+  Wake(waiting_producers_, not_full_);
+}
+
+// Support functions
+template <class T>
+template <typename... Args>
+bool MpmcQueue<T>::Enqueue(Args&&... args) {
+  SizeType pos = enqueue_pos_.load(std::memory_order_relaxed);
+  Cell* cell;
+  for (;;) {
+    cell = &buffer_[pos & mask_];
+    SizeType sequence = cell->sequence.load(std::memory_order_seq_cst);
+    auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+    if (diff == 0) {
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      return false;  // the cell still holds the value from the previous lap
+    } else {
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+  new (&cell->storage) ValueType(std::forward<Args>(args)...);
+  cell->sequence.store(pos + 1, std::memory_order_seq_cst);
+  return true;
+}
+
+template <class T>
+bool MpmcQueue<T>::Dequeue(Reference out) {
+  SizeType pos = dequeue_pos_.load(std::memory_order_relaxed);
+  Cell* cell;
+  for (;;) {
+    cell = &buffer_[pos & mask_];
+    SizeType sequence = cell->sequence.load(std::memory_order_seq_cst);
+    auto diff = static_cast<std::ptrdiff_t>(sequence - (pos + 1));
+    if (diff == 0) {
+      if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      return false;  // nothing has been written to the cell for this lap
+    } else {
+      pos = dequeue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+  Pointer value = std::launder(reinterpret_cast<Pointer>(&cell->storage));
+  out = std::move(*value);
+  value->~ValueType();
+  cell->sequence.store(pos + mask_ + 1, std::memory_order_seq_cst);
+  return true;
+}
+
+// Cell sequences and the waiting counters are all accessed with seq_cst, so
+// either the parked thread sees the new cell state when it retries, or this
+// thread sees its waiting counter
+template <class T>
+void MpmcQueue<T>::Wake(std::atomic<SizeType>& waiting,
+                        std::condition_variable& cv) {
+  if (waiting.load(std::memory_order_seq_cst)) {
+    std::lock_guard<std::mutex> lock(park_mutex_);
+    cv.notify_one();
+  }
+}
+
+template <class T>
+template <class Op>
+void MpmcQueue<T>::Wait(Op op, std::atomic<SizeType>& waiting,
+                        std::condition_variable& cv) {
+  for (SizeType i = 0; i < spin_count_ || !park_; ++i) {
+    if (op()) return;
+    std::this_thread::yield();
+  }
+  std::unique_lock<std::mutex> lock(park_mutex_);
+  waiting.fetch_add(1, std::memory_order_seq_cst);
+  while (!op()) {
+    cv.wait(lock);
+  }
+  waiting.fetch_sub(1, std::memory_order_relaxed);
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_MPMC_QUEUE_H_
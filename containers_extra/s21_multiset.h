@@ -1,6 +1,7 @@
 #ifndef SRC_CONTAINERS_EXTRA_S21_MULTISET_H_
 #define SRC_CONTAINERS_EXTRA_S21_MULTISET_H_
 
+#include <functional>
 #include <initializer_list>
 #include <iterator>
 #include <limits>
@@ -20,7 +21,9 @@ struct MSetNode {
   explicit MSetNode(const T& v) { value.PushBack(v); }
 };
 
-template <class T>
+// Ordered by Compare, a strict weak ordering on T; see Set. Equivalent
+// elements share a node.
+template <class T, class Compare = std::less<T>>
 class Multiset {
  public:
   class MultisetIterator;
@@ -36,6 +39,7 @@ class Multiset {
   using Iterator = MultisetIterator;
   using ConstIterator = MultisetConstIterator;
   using Pair = std::pair<Iterator, bool>;
+  using KeyCompare = Compare;
 
   // internal class MultisetIterator
   class MultisetIterator {
@@ -64,7 +68,7 @@ class Multiset {
           }
         } else {
           Pointer tmp = current_->parent;
-          while (tmp && tmp->value[0] > current_->value[0]) {
+          while (tmp && current_ == tmp->left) {
             current_ = tmp;
             tmp = tmp->parent;
           }
@@ -86,7 +90,7 @@ class Multiset {
           }
         } else {
           Pointer tmp = current_->parent;
-          while (tmp && tmp->value[0] < current_->value[0]) {
+          while (tmp && current_ == tmp->right) {
             current_ = tmp;
             tmp = tmp->parent;
           }
@@ -138,7 +142,7 @@ class Multiset {
           }
         } else {
           Pointer tmp = current_->parent;
-          while (tmp && tmp->value[0] > current_->value[0]) {
+          while (tmp && current_ == tmp->left) {
             current_ = tmp;
             tmp = tmp->parent;
           }
@@ -160,7 +164,7 @@ class Multiset {
           }
         } else {
           Pointer tmp = current_->parent;
-          while (tmp && tmp->value[0] < current_->value[0]) {
+          while (tmp && current_ == tmp->right) {
             current_ = tmp;
             tmp = tmp->parent;
           }
@@ -186,6 +190,7 @@ class Multiset {
 
   // Multiset Member functions
   Multiset() = default;
+  explicit Multiset(const Compare& comp) : comp_(comp) {}
   Multiset(std::initializer_list<ValueType> const& items);
   explicit Multiset(const Multiset& s);
   Multiset(Multiset&& s) noexcept;
@@ -197,9 +202,9 @@ class Multiset {
   Iterator End();
 
   // Multiset Capacity
-  bool Empty();
-  SizeType Size();
-  SizeType MaxSize();
+  bool Empty() const;
+  SizeType Size() const;
+  SizeType MaxSize() const;
 
   // Multiset Modifiers
   void Clear();
@@ -209,12 +214,27 @@ class Multiset {
   void Merge(Multiset& other);
 
   // Multiset Lookup
-  SizeType Count(ConstReference v);
+  SizeType Count(ConstReference v) const;
   Iterator Find(ConstReference v);
-  bool Contains(ConstReference v);
+  bool Contains(ConstReference v) const;
   std::pair<Iterator, Iterator> EqualRange(ConstReference v);
   Iterator LowerBound(ConstReference v);
   Iterator UpperBound(ConstReference v);
+  // Lookups by any key Compare orders against T, without building a T. Only
+  // offered when Compare is transparent.
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  SizeType Count(const K& key) const {
+    return CountOf(FindNode(key));
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  Iterator Find(const K& key) {
+    return IteratorTo(FindNode(key));
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  bool Contains(const K& key) const {
+    return FindNode(key) != nullptr;
+  }
+  KeyCompare KeyComp() const { return comp_; }
 
   // Bonus Function
   template <typename... Args>
@@ -223,6 +243,7 @@ class Multiset {
  private:
   Pointer root_ = nullptr;
   SizeType size_{0};
+  Compare comp_;
 
   // Support functions
   void CopyTree(const Multiset& other);
@@ -230,42 +251,52 @@ class Multiset {
   void EraseLeftBranch(Pointer tmp);
   void EraseRightBranch(Pointer tmp);
   void EraseNode(Pointer tmp);
-  Pair Search(ConstReference v);
+  template <class K>
+  Pair Search(const K& key) const;
+  template <class K>
+  Pointer FindNode(const K& key) const;
+  static Pointer Successor(Pointer node);
+  static SizeType CountOf(Pointer node) {
+    return node ? node->value.Size() : 0;
+  }
+  static Iterator IteratorTo(Pointer node) {
+    return node ? Iterator(node, node->value.Size()) : Iterator();
+  }
 };
 
 // Multiset Member functions
-template <class T>
-Multiset<T>::Multiset(std::initializer_list<ValueType> const& items) {
+template <class T, class Compare>
+Multiset<T, Compare>::Multiset(std::initializer_list<ValueType> const& items) {
   for (auto it : items) {
     Insert(it);
   }
 }
 
-template <class T>
-Multiset<T>::Multiset(const Multiset& s) {
+template <class T, class Compare>
+Multiset<T, Compare>::Multiset(const Multiset& s) : comp_(s.comp_) {
   CopyTree(s);
 }
 
-template <class T>
-Multiset<T>::Multiset(Multiset&& s) noexcept {
+template <class T, class Compare>
+Multiset<T, Compare>::Multiset(Multiset&& s) noexcept {
   Swap(s);
 }
 
-template <class T>
-Multiset<T>::~Multiset() {
+template <class T, class Compare>
+Multiset<T, Compare>::~Multiset() {
   Clear();
 }
 
-template <class T>
-Multiset<T>& Multiset<T>::operator=(Multiset&& s) noexcept {
+template <class T, class Compare>
+Multiset<T, Compare>& Multiset<T, Compare>::operator=(Multiset&& s) noexcept {
   Clear();
   Swap(s);
   return *this;
 }
 
 // Multiset Iterators
-template <class T>
-typename Multiset<T>::Iterator Multiset<T>::Begin() {
+template <class T, class Compare>
+typename Multiset<T, Compare>::Iterator Multiset<T, Compare>::Begin() {
   if (!root_) {
     return Iterator();
   } else {
@@ -277,30 +308,30 @@ typename Multiset<T>::Iterator Multiset<T>::Begin() {
   }
 }
 
-template <class T>
-typename Multiset<T>::Iterator Multiset<T>::End() {
+template <class T, class Compare>
+typename Multiset<T, Compare>::Iterator Multiset<T, Compare>::End() {
   return Iterator();
 }
 
 // Multiset Capacity
-template <class T>
-bool Multiset<T>::Empty() {
+template <class T, class Compare>
+bool Multiset<T, Compare>::Empty() const {
   return root_ == nullptr;
 }
 
-template <class T>
-typename Multiset<T>::SizeType Multiset<T>::Size() {
+template <class T, class Compare>
+typename Multiset<T, Compare>::SizeType Multiset<T, Compare>::Size() const {
   return size_;
 }
 
-template <class T>
-typename Multiset<T>::SizeType Multiset<T>::MaxSize() {
+template <class T, class Compare>
+typename Multiset<T, Compare>::SizeType Multiset<T, Compare>::MaxSize() const {
   return std::numeric_limits<SizeType>::max() / sizeof(Node);
 }
 
 // Multiset Modifiers
-template <class T>
-void Multiset<T>::Clear() {
+template <class T, class Compare>
+void Multiset<T, Compare>::Clear() {
   for (Iterator i = Begin(); i != End();) {
     Iterator tmp = i;
     ++i;
@@ -308,8 +339,9 @@ void Multiset<T>::Clear() {
   }
 }
 
-template <class T>
-typename Multiset<T>::Iterator Multiset<T>::Insert(ConstReference value) {
+template <class T, class Compare>
+typename Multiset<T, Compare>::Iterator Multiset<T, Compare>::Insert(
+    ConstReference value) {
   Pointer tmp;
   if (!root_) {  // if set is empty
     tmp = new Node(value);
@@ -324,7 +356,7 @@ typename Multiset<T>::Iterator Multiset<T>::Insert(ConstReference value) {
     } else {
       tmp = new Node(value);
       tmp->parent = top.first.current_;
-      if (*(top.first) > value) {
+      if (comp_(value, *(top.first))) {
         top.first->left = tmp;
       } else {
         top.first->right = tmp;
@@ -335,8 +367,8 @@ typename Multiset<T>::Iterator Multiset<T>::Insert(ConstReference value) {
   return Iterator(tmp, tmp->value.Size());
 }
 
-template <class T>
-void Multiset<T>::Erase(Iterator pos) {
+template <class T, class Compare>
+void Multiset<T, Compare>::Erase(Iterator pos) {
   if (pos->value.Size() > 1) {
     pos->value.PopBack();
     --size_;
@@ -357,48 +389,49 @@ void Multiset<T>::Erase(Iterator pos) {
   }
 }
 
-template <class T>
-void Multiset<T>::Swap(Multiset& other) {
+template <class T, class Compare>
+void Multiset<T, Compare>::Swap(Multiset& other) {
   if (this != &other) {
     std::swap(size_, other.size_);
     std::swap(root_, other.root_);
+    std::swap(comp_, other.comp_);
   }
 }
 
-template <class T>
-void Multiset<T>::Merge(Multiset& other) {
+template <class T, class Compare>
+void Multiset<T, Compare>::Merge(Multiset& other) {
   for (Iterator i = other.Begin(); i != other.End(); ++i) {
     Insert(*i);
   }
 }
 
-template <class T>
-typename Multiset<T>::SizeType Multiset<T>::Count(ConstReference v) {
-  Pair res = Search(v);
-  return (res.second ? res.first->value.Size() : 0);
+template <class T, class Compare>
+typename Multiset<T, Compare>::SizeType Multiset<T, Compare>::Count(
+    ConstReference v) const {
+  return CountOf(FindNode(v));
 }
 
-template <class T>
-typename Multiset<T>::Iterator Multiset<T>::Find(ConstReference v) {
-  Pair res = Search(v);
-  if (res.second) return res.first;
-  return Iterator();
+template <class T, class Compare>
+typename Multiset<T, Compare>::Iterator Multiset<T, Compare>::Find(
+    ConstReference v) {
+  return IteratorTo(FindNode(v));
 }
 
-template <class T>
-bool Multiset<T>::Contains(ConstReference v) {
-  Pair res = Search(v);
-  return res.second;
+template <class T, class Compare>
+bool Multiset<T, Compare>::Contains(ConstReference v) const {
+  return FindNode(v) != nullptr;
 }
 
-template <class T>
-std::pair<typename Multiset<T>::Iterator, typename Multiset<T>::Iterator>
-Multiset<T>::EqualRange(ConstReference v) {
+template <class T, class Compare>
+std::pair<typename Multiset<T, Compare>::Iterator,
+          typename Multiset<T, Compare>::Iterator>
+Multiset<T, Compare>::EqualRange(ConstReference v) {
   return std::make_pair(LowerBound(v), UpperBound(v));
 }
 
-template <class T>
-typename Multiset<T>::Iterator Multiset<T>::LowerBound(ConstReference v) {
+template <class T, class Compare>
+typename Multiset<T, Compare>::Iterator Multiset<T, Compare>::LowerBound(
+    ConstReference v) {
   Pair res = Search(v);
   if (res.second)
     return res.first;
@@ -407,18 +440,20 @@ typename Multiset<T>::Iterator Multiset<T>::LowerBound(ConstReference v) {
   }
 }
 
-template <class T>
-typename Multiset<T>::Iterator Multiset<T>::UpperBound(ConstReference v) {
+template <class T, class Compare>
+typename Multiset<T, Compare>::Iterator Multiset<T, Compare>::UpperBound(
+    ConstReference v) {
   Iterator it;
-  for (it = Begin(); it != End() && *it <= v; ++it) {
+  for (it = Begin(); it != End() && !comp_(v, *it); ++it) {
   }
   return it;
 }
 
 // Bonus Function
-template <class T>
+template <class T, class Compare>
 template <typename... Args>
-Vector<typename Multiset<T>::Pair> Multiset<T>::Emplace(Args&&... args) {
+Vector<typename Multiset<T, Compare>::Pair> Multiset<T, Compare>::Emplace(
+    Args&&... args) {
   std::initializer_list<ValueType> items{args...};
   Vector<Pair> res;
   for (auto it = items.begin(); it != items.end(); ++it) {
@@ -428,8 +463,8 @@ Vector<typename Multiset<T>::Pair> Multiset<T>::Emplace(Args&&... args) {
 }
 
 // Support functions
-template <class T>
-void Multiset<T>::CopyTree(const Multiset& other) {
+template <class T, class Compare>
+void Multiset<T, Compare>::CopyTree(const Multiset& other) {
   if (other.root_) {
     s21::Queue<Pointer> tmp;
     tmp.Push(other.root_);
@@ -452,12 +487,12 @@ void Multiset<T>::CopyTree(const Multiset& other) {
   }
 }
 
-template <class T>
-void Multiset<T>::EraseList(Pointer tmp) {
+template <class T, class Compare>
+void Multiset<T, Compare>::EraseList(Pointer tmp) {
   if (size_ == 1)
     root_ = nullptr;
   else {
-    if (tmp->parent->value[0] > tmp->value[0])
+    if (tmp->parent->left == tmp)
       tmp->parent->left = nullptr;
     else
       tmp->parent->right = nullptr;
@@ -465,14 +500,14 @@ void Multiset<T>::EraseList(Pointer tmp) {
   delete tmp;
 }
 
-template <class T>
-void Multiset<T>::EraseLeftBranch(Pointer tmp) {
+template <class T, class Compare>
+void Multiset<T, Compare>::EraseLeftBranch(Pointer tmp) {
   if (tmp == root_) {
     root_ = tmp->left;
     root_->parent = nullptr;
   } else {
     tmp->left->parent = tmp->parent;
-    if (tmp->parent->value[0] > tmp->value[0])
+    if (tmp->parent->left == tmp)
       tmp->parent->left = tmp->left;
     else
       tmp->parent->right = tmp->left;
@@ -480,14 +515,14 @@ void Multiset<T>::EraseLeftBranch(Pointer tmp) {
   delete tmp;
 }
 
-template <class T>
-void Multiset<T>::EraseRightBranch(Pointer tmp) {
+template <class T, class Compare>
+void Multiset<T, Compare>::EraseRightBranch(Pointer tmp) {
   if (tmp == root_) {
     root_ = tmp->right;
     root_->parent = nullptr;
   } else {
     tmp->right->parent = tmp->parent;
-    if (tmp->parent->value[0] > tmp->value[0])
+    if (tmp->parent->left == tmp)
       tmp->parent->left = tmp->right;
     else
       tmp->parent->right = tmp->right;
@@ -495,21 +530,21 @@ void Multiset<T>::EraseRightBranch(Pointer tmp) {
   delete tmp;
 }
 
-template <class T>
-void Multiset<T>::EraseNode(Pointer tmp) {
+template <class T, class Compare>
+void Multiset<T, Compare>::EraseNode(Pointer tmp) {
   Iterator it(tmp, tmp->value.Size());
   --it;
   Iterator p(it->parent, it->parent->value.Size());
 
   if (it->left) {
-    if (*it > *p) {
+    if (p.current_->right == it.current_) {
       p->right = it->left;
     } else {
       p->left = it->left;
     }
     it->left->parent = p.current_;
   } else {
-    if (*it > *p)
+    if (p.current_->right == it.current_)
       p->right = nullptr;
     else
       p->left = nullptr;
@@ -524,7 +559,7 @@ void Multiset<T>::EraseNode(Pointer tmp) {
   if (tmp == root_)
     root_ = it.current_;
   else {
-    if (*it > tmp->parent->value[0]) {
+    if (tmp->parent->right == tmp) {
       tmp->parent->right = it.current_;
     } else {
       tmp->parent->left = it.current_;
@@ -533,21 +568,40 @@ void Multiset<T>::EraseNode(Pointer tmp) {
   delete tmp;
 }
 
-template <class T>
-typename Multiset<T>::Pair Multiset<T>::Search(ConstReference v) {
+// The node after node in order, for a node without a right child: the
+// first ancestor it lies to the left of
+template <class T, class Compare>
+typename Multiset<T, Compare>::Pointer Multiset<T, Compare>::Successor(
+    Pointer node) {
+  while (node->parent && node == node->parent->right) node = node->parent;
+  return node->parent;
+}
+
+// One comparison per level, as in Set::Search
+template <class T, class Compare>
+template <class K>
+typename Multiset<T, Compare>::Pair Multiset<T, Compare>::Search(
+    const K& key) const {
   Pointer it = root_, top = it;
+  bool less = false;
   while (it) {
     top = it;
-    if (it->value[0] == v) {
-      return std::make_pair(Iterator(top, top->value.Size()), true);
-    } else if (it->value[0] > v) {
-      it = it->left;
-    } else {
-      it = it->right;
-    }
+    less = comp_(it->value[0], key);
+    it = less ? it->right : it->left;
+  }
+  Pointer candidate = less ? Successor(top) : top;
+  if (candidate && !comp_(key, candidate->value[0])) {
+    return std::make_pair(IteratorTo(candidate), true);
   }
-  return std::make_pair(top ? Iterator(top, top->value.Size()) : Iterator(),
-                        false);
+  return std::make_pair(IteratorTo(top), false);
+}
+
+template <class T, class Compare>
+template <class K>
+typename Multiset<T, Compare>::Pointer Multiset<T, Compare>::FindNode(
+    const K& key) const {
+  Pair res = Search(key);
+  return res.second ? res.first.current_ : nullptr;
 }
 
 }  // namespace s21
@@ -0,0 +1,298 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_PAIRING_HEAP_H_
+#define SRC_CONTAINERS_EXTRA_S21_PAIRING_HEAP_H_
+
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+#include "../containers/s21_vector.h"
+
+namespace s21 {
+// Pairing heap: a heap-ordered multiway tree where Push and Merge just link
+// two roots, DecreaseKey cuts the node's subtree and links it back to the
+// root, and Pop does all the restructuring by pairing up the children of
+// the old root. Each node sits in a doubly linked sibling list whose first
+// node points back to the parent, so a node can be cut out in O(1).
+//
+// Like IndexedPriorityQueue, Top() is the smallest element with respect to
+// Compare. Handles stay valid until their element is popped or erased.
+template <class T, class Compare = std::less<T>>
+class PairingHeap {
+  struct Node {
+    T value;
+    Node* child = nullptr;
+    Node* next = nullptr;
+    Node* prev = nullptr;  // previous sibling, or the parent for a first child
+
+    explicit Node(T&& v) : value(std::move(v)) {}
+  };
+
+ public:
+  // PairingHeap Member type
+  using ValueType = T;
+  using Reference = T&;
+  using ConstReference = const T&;
+  using SizeType = size_t;
+
+  class Handle {
+    friend class PairingHeap;
+
+   public:
+    Handle() = default;
+    bool operator==(const Handle& other) const { return node_ == other.node_; }
+    bool operator!=(const Handle& other) const { return node_ != other.node_; }
+
+   private:
+    explicit Handle(Node* node) : node_(node) {}
+    Node* node_ = nullptr;
+  };
+
+  // PairingHeap Member functions
+  PairingHeap() = default;
+  explicit PairingHeap(const Compare& compare) : compare_(compare) {}
+  PairingHeap(const PairingHeap& h) = delete;
+  PairingHeap(PairingHeap&& h) noexcept;
+  ~PairingHeap();
+  PairingHeap& operator=(const PairingHeap& h) = delete;
+  PairingHeap& operator=(PairingHeap&& h) noexcept;
+
+  // PairingHeap Element access
+  ConstReference Top() const;
+  Handle TopHandle() const;
+  static ConstReference Get(Handle handle) { return handle.node_->value; }
+
+  // PairingHeap Capacity
+  bool Empty() const { return root_ == nullptr; }
+  SizeType Size() const { return size_; }
+
+  // PairingHeap Modifiers
+  Handle Push(ConstReference value);
+  Handle Push(ValueType&& value);
+  void Pop();
+  // value must not compare greater than the current one
+  void DecreaseKey(Handle handle, ValueType value);
+  // Re-keys in either direction; increasing a key costs as much as an Erase
+  // followed by a Push
+  void Update(Handle handle, ValueType value);
+  void Erase(Handle handle);
+  // Moves every element of other into this heap; handles stay valid
+  void Merge(PairingHeap& other);
+  void Clear();
+  void Swap(PairingHeap& other);
+
+ private:
+  Node* root_ = nullptr;
+  SizeType size_ = 0;
+  Compare compare_;
+
+  // Support functions
+  Node* Link(Node* first, Node* second);
+  Node* MergePairs(Node* first);
+  static void Cut(Node* node);
+};
+
+// PairingHeap Member functions
+template <class T, class Compare>
+PairingHeap<T, Compare>::PairingHeap(PairingHeap&& h) noexcept
+    : compare_(h.compare_) {
+  Swap(h);
+}
+
+template <class T, class Compare>
+PairingHeap<T, Compare>::~PairingHeap() {
+  Clear();
+}
+
+template <class T, class Compare>
+PairingHeap<T, Compare>& PairingHeap<T, Compare>::operator=(
+    PairingHeap&& h) noexcept {
+  Clear();
+  Swap(h);
+  return *this;
+}
+
+// PairingHeap Element access
+template <class T, class Compare>
+typename PairingHeap<T, Compare>::ConstReference PairingHeap<T, Compare>::Top()
+    const {
+  if (Empty()) {
+    throw std::out_of_range("Container is empty");
+  }
+  return root_->value;
+}
+
+template <class T, class Compare>
+typename PairingHeap<T, Compare>::Handle PairingHeap<T, Compare>::TopHandle()
+    const {
+  if (Empty()) {
+    throw std::out_of_range("Container is empty");
+  }
+  return Handle(root_);
+}
+
+// PairingHeap Modifiers
+template <class T, class Compare>
+typename PairingHeap<T, Compare>::Handle PairingHeap<T, Compare>::Push(
+    ConstReference value) {
+  return Push(ValueType(value));
+}
+
+template <class T, class Compare>
+typename PairingHeap<T, Compare>::Handle PairingHeap<T, Compare>::Push(
+    ValueType&& value) {
+  Node* node = new Node(std::move(value));
+  root_ = root_ ? Link(root_, node) : node;
+  ++size_;
+  return Handle(node);
+}
+
+template <class T, class Compare>
+void PairingHeap<T, Compare>::Pop() {
+  if (Empty()) {
+    throw std::out_of_range("Container is empty");
+  }
+  Node* old = root_;
+  root_ = MergePairs(old->child);
+  delete old;
+  --size_;
+}
+
+template <class T, class Compare>
+void PairingHeap<T, Compare>::DecreaseKey(Handle handle, ValueType value) {
+  Node* node = handle.node_;
+  node->value = std::move(value);
+  if (node == root_) return;
+  Cut(node);
+  root_ = Link(root_, node);
+}
+
+template <class T, class Compare>
+void PairingHeap<T, Compare>::Update(Handle handle, ValueType value) {
+  Node* node = handle.node_;
+  if (!compare_(node->value, value)) {
+    DecreaseKey(handle, std::move(value));
+    return;
+  }
+  // Detach the node alone, hand its children back to the heap and link it
+  // in again as a leaf
+  Node* children = MergePairs(node->child);
+  node->child = nullptr;
+  if (node == root_) {
+    root_ = children;
+  } else {
+    Cut(node);
+    if (children) root_ = Link(root_, children);
+  }
+  node->value = std::move(value);
+  root_ = root_ ? Link(root_, node) : node;
+}
+
+template <class T, class Compare>
+void PairingHeap<T, Compare>::Erase(Handle handle) {
+  Node* node = handle.node_;
+  if (node == root_) {
+    Pop();
+    return;
+  }
+  Cut(node);
+  Node* children = MergePairs(node->child);
+  if (children) root_ = Link(root_, children);
+  delete node;
+  --size_;
+}
+
+template <class T, class Compare>
+void PairingHeap<T, Compare>::Merge(PairingHeap& other) {
+  if (this == &other || !other.root_) return;
+  root_ = root_ ? Link(root_, other.root_) : other.root_;
+  size_ += other.size_;
+  other.root_ = nullptr;
+  other.size_ = 0;
+}
+
+// Walks the tree with an explicit stack, a degenerate heap can be as deep as
+// it is large
+template <class T, class Compare>
+void PairingHeap<T, Compare>::Clear() {
+  Vector<Node*> pending;
+  if (root_) pending.PushBack(root_);
+  while (!pending.Empty()) {
+    Node* node = pending.Back();
+    pending.PopBack();
+    if (node->child) pending.PushBack(node->child);
+    if (node->next) pending.PushBack(node->next);
+    delete node;
+  }
+  root_ = nullptr;
+  size_ = 0;
+}
+
+template <class T, class Compare>
+void PairingHeap<T, Compare>::Swap(PairingHeap& other) {
+  std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
+  std::swap(compare_, other.compare_);
+}
+
+// Support functions
+// Both arguments are roots without siblings; the one that compares greater
+// becomes the first child of the other
+template <class T, class Compare>
+typename PairingHeap<T, Compare>::Node* PairingHeap<T, Compare>::Link(
+    Node* first, Node* second) {
+  if (compare_(second->value, first->value)) std::swap(first, second);
+  second->prev = first;
+  second->next = first->child;
+  if (first->child) first->child->prev = second;
+  first->child = second;
+  return first;
+}
+
+// Standard two-pass pairing: link the siblings in pairs from left to right,
+// then fold the pairs into one tree from right to left. The first pass
+// threads the pairs through next in reverse, so the second pass can walk
+// them forward.
+template <class T, class Compare>
+typename PairingHeap<T, Compare>::Node* PairingHeap<T, Compare>::MergePairs(
+    Node* first) {
+  Node* pairs = nullptr;
+  while (first) {
+    Node* a = first;
+    Node* b = a->next;
+    first = b ? b->next : nullptr;
+    a->next = a->prev = nullptr;
+    if (b) {
+      b->next = b->prev = nullptr;
+      a = Link(a, b);
+    }
+    a->next = pairs;
+    pairs = a;
+  }
+  Node* result = pairs;
+  if (result) {
+    pairs = result->next;
+    result->next = nullptr;
+  }
+  while (pairs) {
+    Node* rest = pairs->next;
+    pairs->next = nullptr;
+    result = Link(result, pairs);
+    pairs = rest;
+  }
+  return result;
+}
+
+template <class T, class Compare>
+void PairingHeap<T, Compare>::Cut(Node* node) {
+  if (node->prev->child == node) {
+    node->prev->child = node->next;
+  } else {
+    node->prev->next = node->next;
+  }
+  if (node->next) node->next->prev = node->prev;
+  node->next = node->prev = nullptr;
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_PAIRING_HEAP_H_
@@ -0,0 +1,129 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_PERSISTENT_MAP_H_
+#define SRC_CONTAINERS_EXTRA_S21_PERSISTENT_MAP_H_
+
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_persistent_tree.h"
+
+namespace s21 {
+// Immutable ordered map. Insert, InsertOrAssign and Erase leave the map
+// alone and return the updated version, which shares all nodes off the
+// changed path with it; an update allocates O(log n) nodes and a copy is a
+// snapshot taken in O(1). Versions are independent values: any number of
+// threads may read and copy them, as long as no thread assigns to the very
+// object another one is reading.
+template <class K, class V>
+class PersistentMap {
+  struct KeyOfPair {
+    const K& operator()(const std::pair<const K, V>& value) const {
+      return value.first;
+    }
+  };
+
+  using Tree = PersistentTree<K, std::pair<const K, V>, KeyOfPair>;
+
+ public:
+  // PersistentMap Member type
+  using KeyType = K;
+  using MappedType = V;
+  using ValueType = std::pair<const K, V>;
+  using ConstReference = const ValueType&;
+  using SizeType = size_t;
+  using ConstIterator = typename Tree::ConstIterator;
+  using Iterator = ConstIterator;
+
+  // PersistentMap Member functions
+  PersistentMap() = default;
+  PersistentMap(std::initializer_list<ValueType> const& items);
+
+  // PersistentMap Element access
+  // Throws std::out_of_range if the key is absent
+  const V& At(const K& key) const;
+
+  // PersistentMap Lookup
+  ConstIterator Find(const K& key) const { return tree_.FindIterator(key); }
+  bool Contains(const K& key) const { return tree_.Find(key) != nullptr; }
+  // First element whose key is not less than key
+  ConstIterator LowerBound(const K& key) const {
+    return tree_.LowerBound(key);
+  }
+
+  // PersistentMap Iterators
+  ConstIterator Begin() const { return tree_.Begin(); }
+  ConstIterator End() const { return tree_.End(); }
+  ConstIterator Cbegin() const { return tree_.Begin(); }
+  ConstIterator Cend() const { return tree_.End(); }
+
+  // PersistentMap Capacity
+  bool Empty() const { return tree_.Empty(); }
+  SizeType Size() const { return tree_.Size(); }
+  SizeType MaxSize() const;
+
+  // PersistentMap Modifiers
+  // Each returns the new version; an existing value is kept by Insert
+  PersistentMap Insert(const K& key, const V& value) const;
+  PersistentMap Insert(const ValueType& value) const;
+  PersistentMap InsertOrAssign(const K& key, const V& value) const;
+  PersistentMap Erase(const K& key) const;
+  void Swap(PersistentMap& other) { std::swap(tree_, other.tree_); }
+
+ private:
+  Tree tree_;
+
+  explicit PersistentMap(Tree tree) : tree_(std::move(tree)) {}
+};
+
+// PersistentMap Member functions
+template <class K, class V>
+PersistentMap<K, V>::PersistentMap(
+    std::initializer_list<ValueType> const& items) {
+  for (auto it = items.begin(); it != items.end(); ++it) {
+    tree_ = tree_.Insert(*it, false);
+  }
+}
+
+// PersistentMap Element access
+template <class K, class V>
+const V& PersistentMap<K, V>::At(const K& key) const {
+  const ValueType* value = tree_.Find(key);
+  if (!value) {
+    throw std::out_of_range("This element is not exists");
+  }
+  return value->second;
+}
+
+// PersistentMap Capacity
+template <class K, class V>
+typename PersistentMap<K, V>::SizeType PersistentMap<K, V>::MaxSize() const {
+  return std::numeric_limits<SizeType>::max() / (sizeof(ValueType) + 32);
+}
+
+// PersistentMap Modifiers
+template <class K, class V>
+PersistentMap<K, V> PersistentMap<K, V>::Insert(const K& key,
+                                                const V& value) const {
+  return PersistentMap(tree_.Insert(ValueType(key, value), false));
+}
+
+template <class K, class V>
+PersistentMap<K, V> PersistentMap<K, V>::Insert(const ValueType& value) const {
+  return PersistentMap(tree_.Insert(value, false));
+}
+
+template <class K, class V>
+PersistentMap<K, V> PersistentMap<K, V>::InsertOrAssign(const K& key,
+                                                        const V& value) const {
+  return PersistentMap(tree_.Insert(ValueType(key, value), true));
+}
+
+template <class K, class V>
+PersistentMap<K, V> PersistentMap<K, V>::Erase(const K& key) const {
+  return PersistentMap(tree_.Erase(key));
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_PERSISTENT_MAP_H_
@@ -0,0 +1,97 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_PERSISTENT_SET_H_
+#define SRC_CONTAINERS_EXTRA_S21_PERSISTENT_SET_H_
+
+#include <initializer_list>
+#include <limits>
+#include <utility>
+
+#include "s21_persistent_tree.h"
+
+namespace s21 {
+// Immutable ordered set; the counterpart of PersistentMap. Insert and Erase
+// return the updated version, sharing every node off the changed path, and
+// a copy is an O(1) snapshot.
+template <class T>
+class PersistentSet {
+  struct KeyOfValue {
+    const T& operator()(const T& value) const { return value; }
+  };
+
+  using Tree = PersistentTree<T, T, KeyOfValue>;
+
+ public:
+  // PersistentSet Member type
+  using KeyType = T;
+  using ValueType = T;
+  using ConstReference = const T&;
+  using SizeType = size_t;
+  using ConstIterator = typename Tree::ConstIterator;
+  using Iterator = ConstIterator;
+
+  // PersistentSet Member functions
+  PersistentSet() = default;
+  PersistentSet(std::initializer_list<ValueType> const& items);
+
+  // PersistentSet Lookup
+  ConstIterator Find(ConstReference value) const {
+    return tree_.FindIterator(value);
+  }
+  bool Contains(ConstReference value) const {
+    return tree_.Find(value) != nullptr;
+  }
+  // First element not less than value
+  ConstIterator LowerBound(ConstReference value) const {
+    return tree_.LowerBound(value);
+  }
+
+  // PersistentSet Iterators
+  ConstIterator Begin() const { return tree_.Begin(); }
+  ConstIterator End() const { return tree_.End(); }
+  ConstIterator Cbegin() const { return tree_.Begin(); }
+  ConstIterator Cend() const { return tree_.End(); }
+
+  // PersistentSet Capacity
+  bool Empty() const { return tree_.Empty(); }
+  SizeType Size() const { return tree_.Size(); }
+  SizeType MaxSize() const;
+
+  // PersistentSet Modifiers
+  // Each returns the new version
+  PersistentSet Insert(ConstReference value) const;
+  PersistentSet Erase(ConstReference value) const;
+  void Swap(PersistentSet& other) { std::swap(tree_, other.tree_); }
+
+ private:
+  Tree tree_;
+
+  explicit PersistentSet(Tree tree) : tree_(std::move(tree)) {}
+};
+
+// PersistentSet Member functions
+template <class T>
+PersistentSet<T>::PersistentSet(std::initializer_list<ValueType> const& items) {
+  for (auto it = items.begin(); it != items.end(); ++it) {
+    tree_ = tree_.Insert(*it, false);
+  }
+}
+
+// PersistentSet Capacity
+template <class T>
+typename PersistentSet<T>::SizeType PersistentSet<T>::MaxSize() const {
+  return std::numeric_limits<SizeType>::max() / (sizeof(ValueType) + 32);
+}
+
+// PersistentSet Modifiers
+template <class T>
+PersistentSet<T> PersistentSet<T>::Insert(ConstReference value) const {
+  return PersistentSet(tree_.Insert(value, false));
+}
+
+template <class T>
+PersistentSet<T> PersistentSet<T>::Erase(ConstReference value) const {
+  return PersistentSet(tree_.Erase(value));
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_PERSISTENT_SET_H_
@@ -0,0 +1,335 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_PERSISTENT_TREE_H_
+#define SRC_CONTAINERS_EXTRA_S21_PERSISTENT_TREE_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace s21 {
+// Immutable AVL tree behind PersistentMap and PersistentSet. Nodes are never
+// changed after construction: an update copies the nodes on the path from
+// the root to the changed position and shares every other subtree with the
+// version it started from. Nodes are reference counted, atomically, so
+// versions may be copied and dropped from any thread.
+//
+// KeyOf maps a stored Value to its Key.
+template <class Key, class Value, class KeyOf>
+class PersistentTree {
+  struct Node;
+
+  // Owning handle to a node; copies share it
+  class NodeRef {
+   public:
+    NodeRef() = default;
+    explicit NodeRef(Node* node) : node_(node) {}
+    NodeRef(const NodeRef& other) : node_(other.node_) {
+      if (node_) node_->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+    NodeRef(NodeRef&& other) noexcept : node_(other.node_) {
+      other.node_ = nullptr;
+    }
+    NodeRef& operator=(NodeRef other) noexcept {
+      std::swap(node_, other.node_);
+      return *this;
+    }
+    ~NodeRef() {
+      if (node_ && node_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        delete node_;
+      }
+    }
+
+    const Node* operator->() const noexcept { return node_; }
+    const Node* Get() const noexcept { return node_; }
+    explicit operator bool() const noexcept { return node_ != nullptr; }
+    bool operator==(const NodeRef& other) const noexcept {
+      return node_ == other.node_;
+    }
+
+   private:
+    Node* node_ = nullptr;
+  };
+
+  struct Node {
+    std::atomic<size_t> refs{1};
+    NodeRef left;
+    NodeRef right;
+    int height;
+    Value value;
+
+    Node(NodeRef l, const Value& v, NodeRef r)
+        : left(std::move(l)),
+          right(std::move(r)),
+          height(1 + std::max(Height(left), Height(right))),
+          value(v) {}
+  };
+
+ public:
+  // PersistentTree Member type
+  using SizeType = size_t;
+
+  // An AVL tree of n nodes is at most 1.44 log2(n + 2) high, under 72 for
+  // any n that fits in memory
+  static constexpr int kMaxDepth = 72;
+
+  // internal class PersistentTreeConstIterator. Keeps the pending ancestors
+  // on a stack, since shared nodes cannot point to their parents; valid as
+  // long as some version holding its nodes is alive.
+  class ConstIterator {
+    friend class PersistentTree;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Value*;
+    using reference = const Value&;
+
+    ConstIterator() = default;
+
+    reference operator*() const noexcept { return path_[depth_ - 1]->value; }
+    pointer operator->() const noexcept { return &**this; }
+
+    ConstIterator& operator++() noexcept {
+      const Node* node = path_[--depth_];
+      PushLeft(node->right.Get());
+      return *this;
+    }
+
+    ConstIterator operator++(int) noexcept {
+      ConstIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    bool operator==(const ConstIterator& other) const noexcept {
+      return Top() == other.Top();
+    }
+
+    bool operator!=(const ConstIterator& other) const noexcept {
+      return Top() != other.Top();
+    }
+
+   private:
+    const Node* Top() const { return depth_ ? path_[depth_ - 1] : nullptr; }
+    void PushLeft(const Node* node) {
+      for (; node; node = node->left.Get()) path_[depth_++] = node;
+    }
+
+    const Node* path_[kMaxDepth];
+    int depth_ = 0;
+  };
+
+  // PersistentTree Member functions
+  PersistentTree() = default;
+
+  // PersistentTree Lookup
+  const Value* Find(const Key& key) const;
+  ConstIterator FindIterator(const Key& key) const;
+  ConstIterator LowerBound(const Key& key) const;
+
+  // PersistentTree Iterators
+  ConstIterator Begin() const;
+  ConstIterator End() const { return ConstIterator(); }
+
+  // PersistentTree Capacity
+  bool Empty() const { return size_ == 0; }
+  SizeType Size() const { return size_; }
+
+  // PersistentTree Modifiers
+  // Both return the new version; an existing key is replaced only when
+  // assign is set, and a call that changes nothing returns this version
+  PersistentTree Insert(const Value& value, bool assign) const;
+  PersistentTree Erase(const Key& key) const;
+
+ private:
+  NodeRef root_;
+  SizeType size_ = 0;
+
+  PersistentTree(NodeRef root, SizeType size)
+      : root_(std::move(root)), size_(size) {}
+
+  // Support functions
+  static int Height(const NodeRef& node) { return node ? node->height : 0; }
+  static const Key& KeyOfNode(const NodeRef& node) {
+    return KeyOf()(node->value);
+  }
+  static NodeRef Make(NodeRef left, const Value& value, NodeRef right);
+  static NodeRef Balance(NodeRef left, const Value& value, NodeRef right);
+  static NodeRef InsertInto(const NodeRef& node, const Value& value,
+                            bool assign, bool& inserted);
+  static NodeRef EraseFrom(const NodeRef& node, const Key& key, bool& erased);
+  static NodeRef EraseMin(const NodeRef& node, const Value*& min);
+};
+
+// PersistentTree Lookup
+template <class Key, class Value, class KeyOf>
+const Value* PersistentTree<Key, Value, KeyOf>::Find(const Key& key) const {
+  const Node* node = root_.Get();
+  while (node) {
+    const Key& node_key = KeyOf()(node->value);
+    if (key < node_key) {
+      node = node->left.Get();
+    } else if (node_key < key) {
+      node = node->right.Get();
+    } else {
+      return &node->value;
+    }
+  }
+  return nullptr;
+}
+
+template <class Key, class Value, class KeyOf>
+typename PersistentTree<Key, Value, KeyOf>::ConstIterator
+PersistentTree<Key, Value, KeyOf>::FindIterator(const Key& key) const {
+  ConstIterator it = LowerBound(key);
+  if (it.depth_ && key < KeyOf()(*it)) return End();
+  return it;
+}
+
+// Every node passed on the way left is still ahead of the bound, so it is
+// exactly the iterator stack
+template <class Key, class Value, class KeyOf>
+typename PersistentTree<Key, Value, KeyOf>::ConstIterator
+PersistentTree<Key, Value, KeyOf>::LowerBound(const Key& key) const {
+  ConstIterator it;
+  const Node* node = root_.Get();
+  while (node) {
+    if (KeyOf()(node->value) < key) {
+      node = node->right.Get();
+    } else {
+      it.path_[it.depth_++] = node;
+      node = node->left.Get();
+    }
+  }
+  return it;
+}
+
+// PersistentTree Iterators
+template <class Key, class Value, class KeyOf>
+typename PersistentTree<Key, Value, KeyOf>::ConstIterator
+PersistentTree<Key, Value, KeyOf>::Begin() const {
+  ConstIterator it;
+  it.PushLeft(root_.Get());
+  return it;
+}
+
+// PersistentTree Modifiers
+template <class Key, class Value, class KeyOf>
+PersistentTree<Key, Value, KeyOf> PersistentTree<Key, Value, KeyOf>::Insert(
+    const Value& value, bool assign) const {
+  bool inserted = false;
+  NodeRef root = InsertInto(root_, value, assign, inserted);
+  return PersistentTree(std::move(root), size_ + inserted);
+}
+
+template <class Key, class Value, class KeyOf>
+PersistentTree<Key, Value, KeyOf> PersistentTree<Key, Value, KeyOf>::Erase(
+    const Key& key) const {
+  bool erased = false;
+  NodeRef root = EraseFrom(root_, key, erased);
+  return PersistentTree(std::move(root), size_ - erased);
+}
+
+// Support functions
+template <class Key, class Value, class KeyOf>
+typename PersistentTree<Key, Value, KeyOf>::NodeRef
+PersistentTree<Key, Value, KeyOf>::Make(NodeRef left, const Value& value,
+                                        NodeRef right) {
+  return NodeRef(new Node(std::move(left), value, std::move(right)));
+}
+
+// Joins two subtrees whose heights differ by at most two, rotating once or
+// twice when they differ by two
+template <class Key, class Value, class KeyOf>
+typename PersistentTree<Key, Value, KeyOf>::NodeRef
+PersistentTree<Key, Value, KeyOf>::Balance(NodeRef left, const Value& value,
+                                           NodeRef right) {
+  int left_height = Height(left);
+  int right_height = Height(right);
+  if (left_height > right_height + 1) {
+    if (Height(left->left) >= Height(left->right)) {
+      return Make(left->left, left->value,
+                  Make(left->right, value, std::move(right)));
+    }
+    const NodeRef& middle = left->right;
+    return Make(Make(left->left, left->value, middle->left), middle->value,
+                Make(middle->right, value, std::move(right)));
+  }
+  if (right_height > left_height + 1) {
+    if (Height(right->right) >= Height(right->left)) {
+      return Make(Make(std::move(left), value, right->left), right->value,
+                  right->right);
+    }
+    const NodeRef& middle = right->left;
+    return Make(Make(std::move(left), value, middle->left), middle->value,
+                Make(middle->right, right->value, right->right));
+  }
+  return Make(std::move(left), value, std::move(right));
+}
+
+// A subtree that comes back unchanged is returned as is, so a no-op update
+// copies nothing
+template <class Key, class Value, class KeyOf>
+typename PersistentTree<Key, Value, KeyOf>::NodeRef
+PersistentTree<Key, Value, KeyOf>::InsertInto(const NodeRef& node,
+                                              const Value& value, bool assign,
+                                              bool& inserted) {
+  if (!node) {
+    inserted = true;
+    return Make(NodeRef(), value, NodeRef());
+  }
+  const Key& key = KeyOf()(value);
+  if (key < KeyOfNode(node)) {
+    NodeRef left = InsertInto(node->left, value, assign, inserted);
+    if (left == node->left) return node;
+    return Balance(std::move(left), node->value, node->right);
+  }
+  if (KeyOfNode(node) < key) {
+    NodeRef right = InsertInto(node->right, value, assign, inserted);
+    if (right == node->right) return node;
+    return Balance(node->left, node->value, std::move(right));
+  }
+  if (!assign) return node;
+  return Make(node->left, value, node->right);
+}
+
+template <class Key, class Value, class KeyOf>
+typename PersistentTree<Key, Value, KeyOf>::NodeRef
+PersistentTree<Key, Value, KeyOf>::EraseFrom(const NodeRef& node,
+                                             const Key& key, bool& erased) {
+  if (!node) return node;
+  if (key < KeyOfNode(node)) {
+    NodeRef left = EraseFrom(node->left, key, erased);
+    if (left == node->left) return node;
+    return Balance(std::move(left), node->value, node->right);
+  }
+  if (KeyOfNode(node) < key) {
+    NodeRef right = EraseFrom(node->right, key, erased);
+    if (right == node->right) return node;
+    return Balance(node->left, node->value, std::move(right));
+  }
+  erased = true;
+  if (!node->left) return node->right;
+  if (!node->right) return node->left;
+  const Value* min = nullptr;
+  NodeRef right = EraseMin(node->right, min);
+  return Balance(node->left, *min, std::move(right));
+}
+
+// min points into the old subtree, which the caller keeps alive
+template <class Key, class Value, class KeyOf>
+typename PersistentTree<Key, Value, KeyOf>::NodeRef
+PersistentTree<Key, Value, KeyOf>::EraseMin(const NodeRef& node,
+                                            const Value*& min) {
+  if (!node->left) {
+    min = &node->value;
+    return node->right;
+  }
+  return Balance(EraseMin(node->left, min), node->value, node->right);
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_PERSISTENT_TREE_H_
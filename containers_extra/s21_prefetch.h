@@ -0,0 +1,24 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_PREFETCH_H_
+#define SRC_CONTAINERS_EXTRA_S21_PREFETCH_H_
+
+#include <cstddef>
+
+namespace s21 {
+// Searches a batched lookup keeps in flight: enough independent cache
+// misses to cover the memory latency, few enough for their state to stay
+// in L1
+constexpr size_t kPrefetchGroup = 16;
+
+// Asks for the cache line holding address to be loaded. A prefetch never
+// faults, so address need not point into an object.
+inline void Prefetch(const void* address) {
+#if defined(__GNUC__)
+  __builtin_prefetch(address);
+#else
+  (void)address;
+#endif
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_PREFETCH_H_
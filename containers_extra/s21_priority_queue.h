@@ -0,0 +1,213 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_PRIORITY_QUEUE_H_
+#define SRC_CONTAINERS_EXTRA_S21_PRIORITY_QUEUE_H_
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "../containers/s21_vector.h"
+
+namespace s21 {
+// Implicit d-ary heap stored in a random-access Container. Like
+// std::priority_queue, Top() is the greatest element with respect to
+// Compare, so std::greater gives a min-heap. A larger Arity makes the heap
+// shallower (fewer levels to sift through) at the price of more comparisons
+// per level, and keeps the children of a node next to each other in memory.
+//
+// Sifting moves a "hole" along the path and writes the sifted element only
+// once, at its final position, instead of swapping at every level.
+template <class T, class Container = s21::Vector<T>,
+          class Compare = std::less<T>, size_t Arity = 2>
+class PriorityQueue {
+  static_assert(Arity >= 2, "PriorityQueue arity must be at least 2");
+
+ public:
+  // PriorityQueue Member type
+  using ValueType = T;
+  using Reference = T&;
+  using ConstReference = const T&;
+  using SizeType = size_t;
+
+  // PriorityQueue Member functions
+  PriorityQueue() = default;
+  explicit PriorityQueue(const Compare& compare) : compare_(compare) {}
+  PriorityQueue(std::initializer_list<ValueType> const& items);
+  template <class InputIt>
+  PriorityQueue(InputIt first, InputIt last,
+                const Compare& compare = Compare());
+  PriorityQueue(const PriorityQueue& q) = default;
+  PriorityQueue(PriorityQueue&& q) noexcept
+      : container_(std::move(q.container_)), compare_(q.compare_) {}
+  ~PriorityQueue() = default;
+  PriorityQueue& operator=(PriorityQueue&& q) noexcept;
+
+  // PriorityQueue Element access
+  ConstReference Top() const;
+
+  // PriorityQueue Capacity
+  bool Empty() const { return container_.Empty(); }
+  SizeType Size() const { return container_.Size(); }
+
+  // PriorityQueue Modifiers
+  void Push(ConstReference value);
+  void Push(ValueType&& value);
+  template <typename... Args>
+  void Emplace(Args&&... args);
+  void Pop();
+  // Appends [first, last) and restores the heap bottom-up, which is O(n)
+  // instead of O(n log n) for pushing the elements one by one
+  template <class InputIt>
+  void Heapify(InputIt first, InputIt last);
+  // Push(value) followed by Pop(), returning the popped element. When value
+  // would be popped right away the heap is not touched at all.
+  ValueType PushPop(ValueType value);
+  // Pop() followed by Push(value), returning the popped element, with a
+  // single sift down
+  ValueType Replace(ValueType value);
+  void Swap(PriorityQueue& other);
+
+ private:
+  Container container_;
+  Compare compare_;
+
+  // Support functions
+  static SizeType Parent(SizeType i) { return (i - 1) / Arity; }
+  static SizeType FirstChild(SizeType i) { return i * Arity + 1; }
+  void SiftUp(SizeType hole, ValueType value);
+  void SiftDown(SizeType hole, ValueType value);
+};
+
+// PriorityQueue Member functions
+template <class T, class Container, class Compare, size_t Arity>
+PriorityQueue<T, Container, Compare, Arity>::PriorityQueue(
+    std::initializer_list<ValueType> const& items) {
+  Heapify(items.begin(), items.end());
+}
+
+template <class T, class Container, class Compare, size_t Arity>
+template <class InputIt>
+PriorityQueue<T, Container, Compare, Arity>::PriorityQueue(
+    InputIt first, InputIt last, const Compare& compare)
+    : compare_(compare) {
+  Heapify(first, last);
+}
+
+template <class T, class Container, class Compare, size_t Arity>
+PriorityQueue<T, Container, Compare, Arity>&
+PriorityQueue<T, Container, Compare, Arity>::operator=(
+    PriorityQueue&& q) noexcept {
+  container_ = std::move(q.container_);
+  compare_ = q.compare_;
+  return *this;
+}
+
+// PriorityQueue Element access
+template <class T, class Container, class Compare, size_t Arity>
+typename PriorityQueue<T, Container, Compare, Arity>::ConstReference
+PriorityQueue<T, Container, Compare, Arity>::Top() const {
+  if (Empty()) {
+    throw std::out_of_range("Container is empty");
+  }
+  return container_.Front();
+}
+
+// PriorityQueue Modifiers
+template <class T, class Container, class Compare, size_t Arity>
+void PriorityQueue<T, Container, Compare, Arity>::Push(ConstReference value) {
+  Emplace(value);
+}
+
+template <class T, class Container, class Compare, size_t Arity>
+void PriorityQueue<T, Container, Compare, Arity>::Push(ValueType&& value) {
+  Emplace(std::move(value));
+}
+
+template <class T, class Container, class Compare, size_t Arity>
+template <typename... Args>
+void PriorityQueue<T, Container, Compare, Arity>::Emplace(Args&&... args) {
+  container_.PushBack(ValueType(std::forward<Args>(args)...));
+  SiftUp(Size() - 1, std::move(container_[Size() - 1]));
+}
+
+template <class T, class Container, class Compare, size_t Arity>
+void PriorityQueue<T, Container, Compare, Arity>::Pop() {
+  if (Empty()) {
+    throw std::out_of_range("Container is empty");
+  }
+  ValueType last = std::move(container_[Size() - 1]);
+  container_.PopBack();
+  if (!Empty()) SiftDown(0, std::move(last));
+}
+
+template <class T, class Container, class Compare, size_t Arity>
+template <class InputIt>
+void PriorityQueue<T, Container, Compare, Arity>::Heapify(InputIt first,
+                                                          InputIt last) {
+  for (; first != last; ++first) container_.PushBack(*first);
+  if (Size() < 2) return;
+  for (SizeType i = Parent(Size() - 1) + 1; i-- > 0;) {
+    SiftDown(i, std::move(container_[i]));
+  }
+}
+
+template <class T, class Container, class Compare, size_t Arity>
+typename PriorityQueue<T, Container, Compare, Arity>::ValueType
+PriorityQueue<T, Container, Compare, Arity>::PushPop(ValueType value) {
+  if (Empty() || !compare_(value, container_[0])) return value;
+  ValueType top = std::move(container_[0]);
+  SiftDown(0, std::move(value));
+  return top;
+}
+
+template <class T, class Container, class Compare, size_t Arity>
+typename PriorityQueue<T, Container, Compare, Arity>::ValueType
+PriorityQueue<T, Container, Compare, Arity>::Replace(ValueType value) {
+  if (Empty()) {
+    throw std::out_of_range("Container is empty");
+  }
+  ValueType top = std::move(container_[0]);
+  SiftDown(0, std::move(value));
+  return top;
+}
+
+template <class T, class Container, class Compare, size_t Arity>
+void PriorityQueue<T, Container, Compare, Arity>::Swap(PriorityQueue& other) {
+  container_.Swap(other.container_);
+  std::swap(compare_, other.compare_);
+}
+
+// Support functions
+template <class T, class Container, class Compare, size_t Arity>
+void PriorityQueue<T, Container, Compare, Arity>::SiftUp(SizeType hole,
+                                                         ValueType value) {
+  while (hole > 0) {
+    SizeType parent = Parent(hole);
+    if (!compare_(container_[parent], value)) break;
+    container_[hole] = std::move(container_[parent]);
+    hole = parent;
+  }
+  container_[hole] = std::move(value);
+}
+
+template <class T, class Container, class Compare, size_t Arity>
+void PriorityQueue<T, Container, Compare, Arity>::SiftDown(SizeType hole,
+                                                           ValueType value) {
+  SizeType size = Size();
+  for (SizeType first = FirstChild(hole); first < size;
+       first = FirstChild(hole)) {
+    SizeType best = first;
+    SizeType end = first + Arity < size ? first + Arity : size;
+    for (SizeType child = first + 1; child < end; ++child) {
+      if (compare_(container_[best], container_[child])) best = child;
+    }
+    if (!compare_(value, container_[best])) break;
+    container_[hole] = std::move(container_[best]);
+    hole = best;
+  }
+  container_[hole] = std::move(value);
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_PRIORITY_QUEUE_H_
@@ -0,0 +1,305 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_RCU_MAP_H_
+#define SRC_CONTAINERS_EXTRA_S21_RCU_MAP_H_
+
+#include <atomic>
+#include <cstdint>
+#include <initializer_list>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "../containers/s21_map.h"
+#include "../containers/s21_vector.h"
+#include "s21_epoch.h"
+#include "s21_prefetch.h"
+
+namespace s21 {
+// Read-mostly map in the style of read-copy-update. Readers find the
+// current version through one atomic pointer and binary search it: a
+// version is an immutable sorted array, and the reader's only writes are
+// the Epoch pin and unpin on its own cache line, with no lock and no atomic
+// read-modify-write.
+//
+// Writers stage changes, which readers do not see, and Publish merges them
+// into a new version off to the side, swaps the pointer and retires the old
+// version to the Epoch, which deletes it once every reader that could still
+// be on it has moved on.
+template <class K, class V>
+class RcuMap {
+ public:
+  // RcuMap Member type
+  using KeyType = K;
+  using MappedType = V;
+  using ValueType = std::pair<K, V>;
+  using ConstReference = const ValueType&;
+  using SizeType = size_t;
+  using ConstIterator = const ValueType*;
+
+ private:
+  struct Version {
+    Vector<ValueType> entries;
+  };
+
+ public:
+  // A consistent view of one version, kept alive while the View exists.
+  // Belongs to the thread that took it.
+  class View {
+    friend class RcuMap;
+
+   public:
+    // RcuMap::View Lookup
+    // Null if the key is absent
+    const V* Find(const K& key) const;
+    bool Contains(const K& key) const { return Find(key) != nullptr; }
+    ConstIterator LowerBound(const K& key) const;
+    // Batched Find and Contains: write a value pointer, null if absent, or
+    // a bool to out for each of count keys read from keys. The binary
+    // searches of kPrefetchGroup keys step in lockstep, so their misses
+    // overlap.
+    template <class ForwardIt, class OutputIt>
+    void FindBatch(ForwardIt keys, SizeType count, OutputIt out) const;
+    template <class ForwardIt, class OutputIt>
+    void ContainsBatch(ForwardIt keys, SizeType count, OutputIt out) const;
+
+    // RcuMap::View Iterators
+    ConstIterator Begin() const;
+    ConstIterator End() const { return Begin() + Size(); }
+
+    // RcuMap::View Capacity
+    bool Empty() const { return Size() == 0; }
+    SizeType Size() const { return version_->entries.Size(); }
+
+   private:
+    explicit View(const RcuMap& map)
+        : guard_(map.epoch_),
+          version_(map.current_.load(std::memory_order_acquire)) {}
+
+    Epoch::Guard guard_;
+    const Version* version_;
+
+    template <class ForwardIt, class Emit>
+    void SearchBatch(ForwardIt keys, SizeType count, Emit emit) const;
+  };
+
+  // RcuMap Member functions
+  RcuMap() : current_(new Version) {}
+  RcuMap(std::initializer_list<ValueType> const& items);
+  RcuMap(const RcuMap& m) = delete;
+  RcuMap& operator=(const RcuMap& m) = delete;
+  ~RcuMap() { delete current_.load(); }
+
+  // RcuMap Lookup
+  View Read() const { return View(*this); }
+  // Copies the value to out; false if the key is absent
+  bool Find(const K& key, V& out) const;
+  bool Contains(const K& key) const { return Read().Contains(key); }
+  // Writes a bool per key to out, all looked up in the same version
+  template <class ForwardIt, class OutputIt>
+  void ContainsBatch(ForwardIt keys, SizeType count, OutputIt out) const {
+    Read().ContainsBatch(keys, count, out);
+  }
+  // Throws std::out_of_range if the key is absent
+  V At(const K& key) const;
+
+  // RcuMap Capacity
+  bool Empty() const { return Size() == 0; }
+  SizeType Size() const { return Read().Size(); }
+
+  // RcuMap Modifiers
+  // Staged until the next Publish; a later change to a key overrides an
+  // earlier one
+  void InsertOrAssign(const K& key, const V& value);
+  void Erase(const K& key);
+  SizeType Staged() const;
+  // Builds the next version from the current one and the staged changes
+  // and makes it the current one; O(n + changes log changes)
+  void Publish();
+  // Waits for a grace period, after which no reader can still be on a
+  // version retired before the call, and frees the versions this thread
+  // retired. Must not be called while this thread holds a View.
+  void Synchronize();
+
+ private:
+  struct Change {
+    bool erase = false;
+    V value = V();
+  };
+
+  std::atomic<Version*> current_;
+  mutable Epoch epoch_;
+  mutable std::mutex writer_;
+  Map<K, Change> staged_;
+};
+
+// RcuMap::View Lookup
+template <class K, class V>
+const V* RcuMap<K, V>::View::Find(const K& key) const {
+  ConstIterator it = LowerBound(key);
+  if (it == End() || key < it->first) return nullptr;
+  return &it->second;
+}
+
+// Branch-free binary search: the half to keep is picked with a conditional
+// move, so the lookups of a hot read path do not pay for mispredictions
+template <class K, class V>
+typename RcuMap<K, V>::ConstIterator RcuMap<K, V>::View::LowerBound(
+    const K& key) const {
+  ConstIterator base = Begin();
+  SizeType size = Size();
+  while (size > 1) {
+    SizeType half = size / 2;
+    base = base[half].first < key ? base + half : base;
+    size -= half;
+  }
+  return size && base->first < key ? base + 1 : base;
+}
+
+template <class K, class V>
+template <class ForwardIt, class OutputIt>
+void RcuMap<K, V>::View::FindBatch(ForwardIt keys, SizeType count,
+                                   OutputIt out) const {
+  SearchBatch(keys, count, [&out](const V* value) {
+    *out = value;
+    ++out;
+  });
+}
+
+template <class K, class V>
+template <class ForwardIt, class OutputIt>
+void RcuMap<K, V>::View::ContainsBatch(ForwardIt keys, SizeType count,
+                                       OutputIt out) const {
+  SearchBatch(keys, count, [&out](const V* value) {
+    *out = value != nullptr;
+    ++out;
+  });
+}
+
+// LowerBound for kPrefetchGroup keys at a time. Every search over the same
+// array takes the same number of steps, so they stay in lockstep without
+// bookkeeping, and each prefetches the entry it probes next.
+template <class K, class V>
+template <class ForwardIt, class Emit>
+void RcuMap<K, V>::View::SearchBatch(ForwardIt keys, SizeType count,
+                                     Emit emit) const {
+  const K* key[kPrefetchGroup];
+  ConstIterator base[kPrefetchGroup];
+  ConstIterator end = End();
+  while (count) {
+    SizeType group = count < kPrefetchGroup ? count : kPrefetchGroup;
+    for (SizeType i = 0; i < group; ++i, ++keys) {
+      key[i] = &*keys;
+      base[i] = Begin();
+    }
+    SizeType size = Size();
+    while (size > 1) {
+      SizeType half = size / 2;
+      SizeType next = (size - half) / 2;
+      for (SizeType i = 0; i < group; ++i) {
+        base[i] = base[i][half].first < *key[i] ? base[i] + half : base[i];
+        Prefetch(base[i] + next);
+      }
+      size -= half;
+    }
+    for (SizeType i = 0; i < group; ++i) {
+      ConstIterator it =
+          size && base[i]->first < *key[i] ? base[i] + 1 : base[i];
+      emit(it != end && !(*key[i] < it->first) ? &it->second : nullptr);
+    }
+    count -= group;
+  }
+}
+
+// RcuMap::View Iterators
+template <class K, class V>
+typename RcuMap<K, V>::ConstIterator RcuMap<K, V>::View::Begin() const {
+  return Empty() ? nullptr : &version_->entries[0];
+}
+
+// RcuMap Member functions
+template <class K, class V>
+RcuMap<K, V>::RcuMap(std::initializer_list<ValueType> const& items)
+    : RcuMap() {
+  for (auto it = items.begin(); it != items.end(); ++it) {
+    InsertOrAssign(it->first, it->second);
+  }
+  Publish();
+}
+
+// RcuMap Lookup
+template <class K, class V>
+bool RcuMap<K, V>::Find(const K& key, V& out) const {
+  View view = Read();
+  const V* value = view.Find(key);
+  if (!value) return false;
+  out = *value;
+  return true;
+}
+
+template <class K, class V>
+V RcuMap<K, V>::At(const K& key) const {
+  View view = Read();
+  const V* value = view.Find(key);
+  if (!value) {
+    throw std::out_of_range("This element is not exists");
+  }
+  return *value;
+}
+
+// RcuMap Modifiers
+template <class K, class V>
+void RcuMap<K, V>::InsertOrAssign(const K& key, const V& value) {
+  std::lock_guard<std::mutex> lock(writer_);
+  staged_.InsertOrAssign(key, Change{false, value});
+}
+
+template <class K, class V>
+void RcuMap<K, V>::Erase(const K& key) {
+  std::lock_guard<std::mutex> lock(writer_);
+  staged_.InsertOrAssign(key, Change{true, V()});
+}
+
+template <class K, class V>
+typename RcuMap<K, V>::SizeType RcuMap<K, V>::Staged() const {
+  std::lock_guard<std::mutex> lock(writer_);
+  return staged_.Size();
+}
+
+// Both the version and the staged changes are sorted, so the next version
+// is a single merge of the two
+template <class K, class V>
+void RcuMap<K, V>::Publish() {
+  std::lock_guard<std::mutex> lock(writer_);
+  if (staged_.Empty()) return;
+  Version* old = current_.load(std::memory_order_relaxed);
+  const Vector<ValueType>& entries = old->entries;
+  Version* next = new Version;
+  next->entries.Reserve(entries.Size() + staged_.Size());
+  SizeType i = 0;
+  for (auto it = staged_.Cbegin(); it != staged_.Cend(); ++it) {
+    const K& key = it->first;
+    for (; i < entries.Size() && entries[i].first < key; ++i) {
+      next->entries.PushBack(entries[i]);
+    }
+    if (i < entries.Size() && !(key < entries[i].first)) ++i;
+    if (!it->second.erase) next->entries.PushBack({key, it->second.value});
+  }
+  for (; i < entries.Size(); ++i) next->entries.PushBack(entries[i]);
+  current_.store(next, std::memory_order_release);
+  staged_.Clear();
+  epoch_.Retire(old);
+  epoch_.Collect();
+}
+
+template <class K, class V>
+void RcuMap<K, V>::Synchronize() {
+  std::uint64_t target = epoch_.Current() + 2;
+  while (epoch_.Current() < target) {
+    if (!epoch_.TryAdvance()) std::this_thread::yield();
+  }
+  epoch_.Collect();
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_RCU_MAP_H_
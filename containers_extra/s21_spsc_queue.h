@@ -0,0 +1,235 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_SPSC_QUEUE_H_
+#define SRC_CONTAINERS_EXTRA_S21_SPSC_QUEUE_H_
+
+#include <atomic>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace s21 {
+// Bounded lock-free queue for exactly one producer thread and one consumer
+// thread. Push/TryPush* may only be called by the producer, Front/Pop/TryPop*
+// only by the consumer.
+template <class T>
+class SpscQueue {
+ public:
+  // SpscQueue Member type
+  using ValueType = T;
+  using Pointer = T*;
+  using Reference = T&;
+  using ConstReference = const T&;
+  using SizeType = size_t;
+
+  static constexpr SizeType kCacheLine = 64;
+
+  // SpscQueue Member functions
+  explicit SpscQueue(SizeType capacity);
+  SpscQueue(const SpscQueue& q) = delete;
+  SpscQueue& operator=(const SpscQueue& q) = delete;
+  ~SpscQueue();
+
+  // SpscQueue Element access (consumer)
+  Reference Front();
+
+  // SpscQueue Capacity
+  bool Empty() const;
+  SizeType Size() const;
+  SizeType Capacity() const;
+
+  // SpscQueue Modifiers (producer)
+  bool TryPush(ConstReference value);
+  bool TryPush(ValueType&& value);
+  void Push(ConstReference value);
+  void Push(ValueType&& value);
+  // Pushes up to count elements from first with a single publish; returns
+  // the number pushed. If a copy throws, none of the batch is pushed.
+  template <class InputIt>
+  SizeType TryPushN(InputIt first, SizeType count);
+  template <typename... Args>
+  bool TryEmplace(Args&&... args);
+
+  // SpscQueue Modifiers (consumer)
+  void Pop();
+  bool TryPop(Reference out);
+  template <class OutputIt>
+  SizeType TryPopN(OutputIt out, SizeType max_count);
+
+ private:
+  // head_ is written only by the consumer and tail_ only by the producer.
+  // Each side also keeps a private copy of the other side's index and reloads
+  // it only when the copy shows too few slots, so in the steady state the two
+  // cache lines are not bounced between cores.
+  alignas(kCacheLine) std::atomic<SizeType> head_{0};
+  SizeType cached_tail_ = 0;
+  alignas(kCacheLine) std::atomic<SizeType> tail_{0};
+  SizeType cached_head_ = 0;
+  alignas(kCacheLine) SizeType mask_;
+  Pointer buffer_;
+
+  // Support functions
+  SizeType FreeSlots(SizeType tail, SizeType wanted);
+  SizeType ReadySlots(SizeType head, SizeType wanted);
+};
+
+// SpscQueue Member functions
+template <class T>
+SpscQueue<T>::SpscQueue(SizeType capacity) {
+  SizeType size = 1;
+  while (size < capacity) size <<= 1;
+  mask_ = size - 1;
+  buffer_ = static_cast<Pointer>(::operator new(sizeof(ValueType) * size));
+}
+
+template <class T>
+SpscQueue<T>::~SpscQueue() {
+  while (!Empty()) {
+    Pop();
+  }
+  ::operator delete(buffer_);
+}
+
+// SpscQueue Element access
+template <class T>
+typename SpscQueue<T>::Reference SpscQueue<T>::Front() {
+  SizeType head = head_.load(std::memory_order_relaxed);
+  if (!ReadySlots(head, 1)) {
+    throw std::out_of_range("Container is empty");
+  }
+  return buffer_[head & mask_];
+}
+
+// SpscQueue Capacity
+template <class T>
+bool SpscQueue<T>::Empty() const {
+  return Size() == 0;
+}
+
+template <class T>
+typename SpscQueue<T>::SizeType SpscQueue<T>::Size() const {
+  SizeType head = head_.load(std::memory_order_acquire);
+  return tail_.load(std::memory_order_acquire) - head;
+}
+
+template <class T>
+typename SpscQueue<T>::SizeType SpscQueue<T>::Capacity() const {
+  return mask_ + 1;
+}
+
+// SpscQueue Modifiers (producer)
+template <class T>
+bool SpscQueue<T>::TryPush(ConstReference value) {
+  return TryEmplace(value);
+}
+
+template <class T>
+bool SpscQueue<T>::TryPush(ValueType&& value) {
+  return TryEmplace(std::move(value));
+}
+
+template <class T>
+void SpscQueue<T>::Push(ConstReference value) {
+  while (!TryEmplace(value)) {
+    std::this_thread::yield();
+  }
+}
+
+template <class T>
+void SpscQueue<T>::Push(ValueType&& value) {
+  while (!TryEmplace(std::move(value))) {
+    std::this_thread::yield();
+  }
+}
+
+template <class T>
+template <class InputIt>
+typename SpscQueue<T>::SizeType SpscQueue<T>::TryPushN(InputIt first,
+                                                       SizeType count) {
+  SizeType tail = tail_.load(std::memory_order_relaxed);
+  SizeType free_slots = FreeSlots(tail, count);
+  if (count > free_slots) count = free_slots;
+  SizeType built = 0;
+  try {
+    for (; built < count; ++built, ++first) {
+      new (&buffer_[(tail + built) & mask_]) ValueType(*first);
+    }
+  } catch (...) {
+    while (built) buffer_[(tail + --built) & mask_].~ValueType();
+    throw;
+  }
+  if (count) tail_.store(tail + count, std::memory_order_release);
+  return count;
+}
+
+template <class T>
+template <typename... Args>
+bool SpscQueue<T>::TryEmplace(Args&&... args) {
+  SizeType tail = tail_.load(std::memory_order_relaxed);
+  if (!FreeSlots(tail, 1)) return false;
+  new (&buffer_[tail & mask_]) ValueType(std::forward<Args>(args)...);
+  tail_.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+// SpscQueue Modifiers (consumer)
+template <class T>
+void SpscQueue<T>::Pop() {
+  SizeType head = head_.load(std::memory_order_relaxed);
+  if (ReadySlots(head, 1)) {
+    buffer_[head & mask_].~ValueType();
+    head_.store(head + 1, std::memory_order_release);
+  }
+}
+
+template <class T>
+bool SpscQueue<T>::TryPop(Reference out) {
+  SizeType head = head_.load(std::memory_order_relaxed);
+  if (!ReadySlots(head, 1)) return false;
+  out = std::move(buffer_[head & mask_]);
+  buffer_[head & mask_].~ValueType();
+  head_.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+template <class T>
+template <class OutputIt>
+typename SpscQueue<T>::SizeType SpscQueue<T>::TryPopN(OutputIt out,
+                                                      SizeType max_count) {
+  SizeType head = head_.load(std::memory_order_relaxed);
+  SizeType count = ReadySlots(head, max_count);
+  if (count > max_count) count = max_count;
+  for (SizeType i = 0; i < count; ++i, ++out) {
+    Pointer slot = &buffer_[(head + i) & mask_];
+    *out = std::move(*slot);
+    slot->~ValueType();
+  }
+  if (count) head_.store(head + count, std::memory_order_release);
+  return count;
+}
+
+// Support functions
+template <class T>
+typename SpscQueue<T>::SizeType SpscQueue<T>::FreeSlots(SizeType tail,
+                                                         SizeType wanted) {
+  SizeType free_slots = Capacity() - (tail - cached_head_);
+  if (free_slots < wanted) {
+    cached_head_ = head_.load(std::memory_order_acquire);
+    free_slots = Capacity() - (tail - cached_head_);
+  }
+  return free_slots;
+}
+
+template <class T>
+typename SpscQueue<T>::SizeType SpscQueue<T>::ReadySlots(SizeType head,
+                                                          SizeType wanted) {
+  SizeType ready = cached_tail_ - head;
+  if (ready < wanted) {
+    cached_tail_ = tail_.load(std::memory_order_acquire);
+    ready = cached_tail_ - head;
+  }
+  return ready;
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_SPSC_QUEUE_H_
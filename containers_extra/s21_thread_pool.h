@@ -0,0 +1,308 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_THREAD_POOL_H_
+#define SRC_CONTAINERS_EXTRA_S21_THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "../containers/s21_vector.h"
+#include "s21_mpmc_queue.h"
+#include "s21_work_stealing_deque.h"
+
+namespace s21 {
+// Reference fork-join pool built on WorkStealingDeque. Every worker owns a
+// deque: tasks forked by Invoke are pushed to and popped from its bottom, and
+// idle workers steal from the top of the others. Tasks submitted from outside
+// the pool go through a shared MpmcQueue.
+//
+// An exception never escapes a worker: the first one thrown by a submitted
+// task is kept and rethrown by Wait, and one thrown by either half of Invoke
+// is rethrown by Invoke once both halves are done.
+class ThreadPool {
+ public:
+  // ThreadPool Member type
+  using SizeType = size_t;
+
+  static constexpr SizeType kInjectionCapacity = 1024;
+
+  // ThreadPool Member functions
+  explicit ThreadPool(SizeType threads = std::thread::hardware_concurrency());
+  ThreadPool(const ThreadPool& p) = delete;
+  ThreadPool& operator=(const ThreadPool& p) = delete;
+  ~ThreadPool();
+
+  // ThreadPool Capacity
+  SizeType Size() const { return workers_.Size(); }
+
+  // ThreadPool Modifiers
+  // Queues fn to run on some worker
+  template <class F>
+  void Submit(F&& fn);
+  // Runs first and second, potentially in parallel, and returns when both
+  // are done. Called from a worker, second is forked onto its deque and the
+  // worker keeps executing other tasks while waiting for a thief to finish
+  // it; called from any other thread, both run inline. Both run even if one
+  // throws; the exception of first wins if both do.
+  template <class F1, class F2>
+  void Invoke(F1&& first, F2&& second);
+  // Blocks until every task passed to Submit has finished, then rethrows
+  // the first exception one of them threw since the last Wait; later ones
+  // are dropped
+  void Wait();
+
+ private:
+  struct Task {
+    void (*execute)(Task*) = nullptr;
+    std::atomic<bool> done{false};
+  };
+
+  // Heap task created by Submit, deleted by whoever runs it
+  template <class F>
+  struct SubmittedTask : Task {
+    F fn;
+    ThreadPool* pool;
+    template <class G>
+    SubmittedTask(G&& g, ThreadPool* p) : fn(std::forward<G>(g)), pool(p) {
+      this->execute = &Run;
+    }
+    static void Run(Task* task) {
+      auto* self = static_cast<SubmittedTask*>(task);
+      ThreadPool* pool = self->pool;
+      try {
+        self->fn();
+      } catch (...) {
+        pool->KeepError(std::current_exception());
+      }
+      delete self;
+      pool->FinishSubmitted();
+    }
+  };
+
+  // Stack task forked by Invoke; the forking frame waits on done and then
+  // reads error
+  template <class F>
+  struct ForkedTask : Task {
+    F& fn;
+    std::exception_ptr error;
+    explicit ForkedTask(F& f) : fn(f) { this->execute = &Run; }
+    static void Run(Task* task) {
+      auto* self = static_cast<ForkedTask*>(task);
+      try {
+        self->fn();
+      } catch (...) {
+        self->error = std::current_exception();
+      }
+      self->done.store(true, std::memory_order_release);
+    }
+  };
+
+  struct Worker {
+    WorkStealingDeque<Task*> deque;
+    std::thread thread;
+    // Picks the first victim to steal from; starts at the worker's index
+    // so that idle workers spread over different victims
+    SizeType seed = 0;
+  };
+
+  Vector<Worker*> workers_;
+  MpmcQueue<Task*> injection_;
+  std::atomic<bool> stop_{false};
+
+  // queued_ counts tasks that were pushed and not yet taken; workers only go
+  // to sleep when it is zero, and pushers only notify when someone sleeps
+  std::atomic<SizeType> queued_{0};
+  std::atomic<SizeType> sleeping_{0};
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+
+  std::atomic<SizeType> unfinished_{0};
+  std::mutex wait_mutex_;
+  std::condition_variable all_done_;
+  // First exception of a submitted task, guarded by wait_mutex_
+  std::exception_ptr error_;
+
+  static inline thread_local Worker* current_worker_ = nullptr;
+  static inline thread_local ThreadPool* current_pool_ = nullptr;
+
+  // Support functions
+  void WorkerLoop(Worker* self);
+  Task* FindTask(Worker* self);
+  void Enqueue(Worker* self, Task* task);
+  void FinishSubmitted();
+  void KeepError(std::exception_ptr error);
+  void WaitUnfinished();
+};
+
+// ThreadPool Member functions
+inline ThreadPool::ThreadPool(SizeType threads)
+    : injection_(kInjectionCapacity) {
+  if (threads == 0) threads = 1;
+  for (SizeType i = 0; i < threads; ++i) {
+    workers_.PushBack(new Worker);
+    workers_[i]->seed = i;
+  }
+  for (SizeType i = 0; i < threads; ++i) {
+    Worker* worker = workers_[i];
+    worker->thread = std::thread([this, worker] { WorkerLoop(worker); });
+  }
+}
+
+// A task exception nobody waited for is dropped here
+inline ThreadPool::~ThreadPool() {
+  WaitUnfinished();
+  stop_.store(true, std::memory_order_seq_cst);
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    wake_.notify_all();
+  }
+  // Workers still running may be stealing from the deques of finished ones,
+  // so nothing is deleted before every thread has been joined
+  for (SizeType i = 0; i < workers_.Size(); ++i) {
+    workers_[i]->thread.join();
+  }
+  for (SizeType i = 0; i < workers_.Size(); ++i) {
+    delete workers_[i];
+  }
+}
+
+// ThreadPool Modifiers
+// The task is counted only once it is built, so a throwing allocation or
+// copy of fn leaves Wait nothing to wait for; counting it before Enqueue
+// keeps a quick worker from finishing it first
+template <class F>
+void ThreadPool::Submit(F&& fn) {
+  Task* task = new SubmittedTask<std::decay_t<F>>(std::forward<F>(fn), this);
+  unfinished_.fetch_add(1, std::memory_order_relaxed);
+  Enqueue(current_pool_ == this ? current_worker_ : nullptr, task);
+}
+
+template <class F1, class F2>
+void ThreadPool::Invoke(F1&& first, F2&& second) {
+  Worker* self = current_pool_ == this ? current_worker_ : nullptr;
+  std::exception_ptr error;
+  if (!self) {
+    try {
+      first();
+    } catch (...) {
+      error = std::current_exception();
+    }
+    try {
+      second();
+    } catch (...) {
+      if (!error) error = std::current_exception();
+    }
+    if (error) std::rethrow_exception(error);
+    return;
+  }
+  // forked lives in this frame, so it must be done before anything unwinds
+  ForkedTask<F2> forked(second);
+  Enqueue(self, &forked);
+  try {
+    first();
+  } catch (...) {
+    error = std::current_exception();
+  }
+  while (!forked.done.load(std::memory_order_acquire)) {
+    Task* task = FindTask(self);
+    if (task) {
+      task->execute(task);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  if (!error) error = forked.error;
+  if (error) std::rethrow_exception(error);
+}
+
+inline void ThreadPool::Wait() {
+  WaitUnfinished();
+  std::exception_ptr error;
+  {
+    std::lock_guard<std::mutex> lock(wait_mutex_);
+    std::swap(error, error_);
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+// Support functions
+inline void ThreadPool::WorkerLoop(Worker* self) {
+  current_worker_ = self;
+  current_pool_ = this;
+  while (!stop_.load(std::memory_order_acquire)) {
+    Task* task = FindTask(self);
+    if (task) {
+      task->execute(task);
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    sleeping_.fetch_add(1, std::memory_order_seq_cst);
+    wake_.wait(lock, [this] {
+      return queued_.load(std::memory_order_seq_cst) != 0 ||
+             stop_.load(std::memory_order_seq_cst);
+    });
+    sleeping_.fetch_sub(1, std::memory_order_relaxed);
+  }
+  current_worker_ = nullptr;
+  current_pool_ = nullptr;
+}
+
+// Own deque first (most recently forked, still hot in cache), then the
+// shared queue, then the other workers starting at a per-worker offset
+inline ThreadPool::Task* ThreadPool::FindTask(Worker* self) {
+  Task* task = nullptr;
+  bool found = self->deque.TryPop(task) || injection_.TryPop(task);
+  if (!found) {
+    SizeType n = workers_.Size();
+    self->seed = self->seed * 1103515245 + 12345;
+    SizeType start = (self->seed >> 16) % n;
+    for (SizeType i = 0; i < n && !found; ++i) {
+      Worker* victim = workers_[(start + i) % n];
+      if (victim != self) found = victim->deque.Steal(task);
+    }
+  }
+  if (!found) return nullptr;
+  queued_.fetch_sub(1, std::memory_order_relaxed);
+  return task;
+}
+
+// Counting the task before it becomes visible keeps queued_ from dropping
+// below zero when a thief takes it right away
+inline void ThreadPool::Enqueue(Worker* self, Task* task) {
+  queued_.fetch_add(1, std::memory_order_seq_cst);
+  if (self) {
+    self->deque.Push(task);
+  } else {
+    injection_.Push(task);
+  }
+  if (sleeping_.load(std::memory_order_seq_cst)) {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    wake_.notify_one();
+  }
+}
+
+inline void ThreadPool::WaitUnfinished() {
+  std::unique_lock<std::mutex> lock(wait_mutex_);
+  all_done_.wait(lock, [this] {
+    return unfinished_.load(std::memory_order_acquire) == 0;
+  });
+}
+
+inline void ThreadPool::KeepError(std::exception_ptr error) {
+  std::lock_guard<std::mutex> lock(wait_mutex_);
+  if (!error_) error_ = error;
+}
+
+inline void ThreadPool::FinishSubmitted() {
+  if (unfinished_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    std::lock_guard<std::mutex> lock(wait_mutex_);
+    all_done_.notify_all();
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_THREAD_POOL_H_
@@ -0,0 +1,281 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_TIMER_WHEEL_H_
+#define SRC_CONTAINERS_EXTRA_S21_TIMER_WHEEL_H_
+
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+#include "../containers/s21_vector.h"
+
+namespace s21 {
+// Hierarchical timer wheel over a 64-bit tick counter. Level k has kSlots
+// slots, each covering 2^(kSlotBits * k) ticks; a timer lives on the lowest
+// level on which its deadline and the current time share a slot range, and
+// is moved down (cascaded) when the wheel reaches its slot. Every
+// operation is O(1) apart from cascading, which touches each timer at most
+// once per level.
+//
+// Timers are nodes in a single Vector pool and slots are doubly linked
+// lists of pool indices, so scheduling, cancelling and expiring reuse freed
+// nodes instead of allocating. A handle carries the node's generation, so a
+// handle whose timer already fired or was cancelled is simply stale.
+template <class T>
+class TimerWheel {
+ public:
+  // TimerWheel Member type
+  using ValueType = T;
+  using Reference = T&;
+  using ConstReference = const T&;
+  using SizeType = size_t;
+  using Tick = std::uint64_t;
+
+  class Handle {
+    friend class TimerWheel;
+
+   public:
+    Handle() = default;
+    bool operator==(const Handle& other) const {
+      return index_ == other.index_ && generation_ == other.generation_;
+    }
+    bool operator!=(const Handle& other) const { return !(*this == other); }
+
+   private:
+    Handle(SizeType index, std::uint32_t generation)
+        : index_(index), generation_(generation) {}
+    SizeType index_ = std::numeric_limits<SizeType>::max();
+    std::uint32_t generation_ = 0;
+  };
+
+  static constexpr int kSlotBits = 6;
+  static constexpr SizeType kSlots = SizeType(1) << kSlotBits;
+  static constexpr int kLevels = (64 + kSlotBits - 1) / kSlotBits;
+
+  // TimerWheel Member functions
+  explicit TimerWheel(Tick now = 0);
+  TimerWheel(const TimerWheel& w) = delete;
+  TimerWheel& operator=(const TimerWheel& w) = delete;
+  ~TimerWheel() = default;
+
+  // TimerWheel Capacity
+  bool Empty() const { return size_ == 0; }
+  SizeType Size() const { return size_; }
+  Tick Now() const { return now_; }
+  // True while the timer has neither fired nor been cancelled
+  bool Pending(Handle handle) const;
+  void Reserve(SizeType n) { nodes_.Reserve(n); }
+
+  // TimerWheel Modifiers
+  // A deadline that is not in the future fires on the next Advance
+  Handle Schedule(Tick deadline, ConstReference value);
+  Handle Schedule(Tick deadline, ValueType&& value);
+  // Returns false if the timer already fired or was cancelled
+  bool Cancel(Handle handle);
+  // Moves the clock to now and calls fn(value) for every timer whose
+  // deadline has been reached; returns the number of expired timers. fn may
+  // schedule and cancel timers. Stretches of ticks with no timer on the
+  // lower levels are skipped without visiting their slots.
+  template <class Fn>
+  SizeType Advance(Tick now, Fn fn);
+
+ private:
+  static constexpr SizeType kNil = std::numeric_limits<SizeType>::max();
+  // Extra list that holds the batch being expired
+  static constexpr SizeType kExpiring = kSlots * kLevels;
+
+  struct Node {
+    ValueType value;
+    Tick deadline = 0;
+    SizeType next = kNil;
+    SizeType prev = kNil;
+    SizeType slot = kNil;
+    std::uint32_t generation = 0;
+  };
+
+  Vector<Node> nodes_;
+  Vector<SizeType> heads_;
+  SizeType level_sizes_[kLevels] = {};
+  SizeType free_ = kNil;
+  SizeType size_ = 0;
+  Tick now_;
+
+  // Support functions
+  SizeType Acquire();
+  void Release(SizeType index);
+  SizeType SlotFor(Tick deadline) const;
+  void Link(SizeType index, SizeType slot);
+  void Unlink(SizeType index);
+  void Cascade(int level);
+  static Tick Span(int level) { return Tick(1) << (kSlotBits * level); }
+};
+
+// TimerWheel Member functions
+template <class T>
+TimerWheel<T>::TimerWheel(Tick now) : heads_(kExpiring + 1), now_(now) {
+  for (SizeType i = 0; i < heads_.Size(); ++i) heads_[i] = kNil;
+}
+
+// TimerWheel Capacity
+template <class T>
+bool TimerWheel<T>::Pending(Handle handle) const {
+  return handle.index_ < nodes_.Size() &&
+         nodes_[handle.index_].generation == handle.generation_ &&
+         nodes_[handle.index_].slot != kNil;
+}
+
+// TimerWheel Modifiers
+template <class T>
+typename TimerWheel<T>::Handle TimerWheel<T>::Schedule(Tick deadline,
+                                                       ConstReference value) {
+  return Schedule(deadline, ValueType(value));
+}
+
+template <class T>
+typename TimerWheel<T>::Handle TimerWheel<T>::Schedule(Tick deadline,
+                                                       ValueType&& value) {
+  SizeType index = Acquire();
+  Node& node = nodes_[index];
+  node.value = std::move(value);
+  node.deadline = deadline > now_ ? deadline : now_ + 1;
+  Link(index, SlotFor(node.deadline));
+  ++size_;
+  return Handle(index, node.generation);
+}
+
+template <class T>
+bool TimerWheel<T>::Cancel(Handle handle) {
+  if (!Pending(handle)) return false;
+  Unlink(handle.index_);
+  Release(handle.index_);
+  --size_;
+  return true;
+}
+
+template <class T>
+template <class Fn>
+typename TimerWheel<T>::SizeType TimerWheel<T>::Advance(Tick now, Fn fn) {
+  SizeType expired = 0;
+  while (now_ < now) {
+    // With the lowest `empty` levels vacant nothing can happen before the
+    // next tick that cascades level `empty`
+    int empty = 0;
+    while (empty < kLevels && level_sizes_[empty] == 0) ++empty;
+    Tick tick = now_ + 1;
+    if (empty > 0) {
+      if (empty == kLevels || kSlotBits * empty >= 64) {
+        now_ = now;
+        break;
+      }
+      Tick boundary = ((now_ >> (kSlotBits * empty)) + 1)
+                      << (kSlotBits * empty);
+      if (boundary == 0 || boundary > now) {
+        now_ = now;
+        break;
+      }
+      tick = boundary;
+    }
+    now_ = tick;
+    for (int level = kLevels - 1; level > 0; --level) {
+      if (kSlotBits * level < 64 && (tick & (Span(level) - 1)) == 0) {
+        Cascade(level);
+      }
+    }
+    SizeType slot = static_cast<SizeType>(tick & (kSlots - 1));
+    // Park the due batch on its own list first, so fn may freely schedule
+    // into the slot that is being expired or cancel timers of the batch
+    std::swap(heads_[slot], heads_[kExpiring]);
+    for (SizeType i = heads_[kExpiring]; i != kNil; i = nodes_[i].next) {
+      nodes_[i].slot = kExpiring;
+      --level_sizes_[0];
+    }
+    while (heads_[kExpiring] != kNil) {
+      SizeType index = heads_[kExpiring];
+      Unlink(index);
+      ValueType value = std::move(nodes_[index].value);
+      Release(index);
+      --size_;
+      ++expired;
+      fn(value);
+    }
+  }
+  return expired;
+}
+
+// Support functions
+template <class T>
+typename TimerWheel<T>::SizeType TimerWheel<T>::Acquire() {
+  if (free_ == kNil) {
+    nodes_.PushBack(Node());
+    return nodes_.Size() - 1;
+  }
+  SizeType index = free_;
+  free_ = nodes_[index].next;
+  return index;
+}
+
+template <class T>
+void TimerWheel<T>::Release(SizeType index) {
+  Node& node = nodes_[index];
+  ++node.generation;
+  node.slot = kNil;
+  node.prev = kNil;
+  node.next = free_;
+  free_ = index;
+}
+
+// The lowest level on which the deadline and the current time fall into
+// the same slot range. A deadline equal to now_ only comes from a cascade
+// and maps to the level 0 slot that is expired right after it.
+template <class T>
+typename TimerWheel<T>::SizeType TimerWheel<T>::SlotFor(Tick deadline) const {
+  int level = 0;
+  while (level < kLevels - 1 && kSlotBits * (level + 1) < 64 &&
+         (deadline >> (kSlotBits * (level + 1))) !=
+             (now_ >> (kSlotBits * (level + 1)))) {
+    ++level;
+  }
+  SizeType slot = static_cast<SizeType>(
+      (deadline >> (kSlotBits * level)) & (kSlots - 1));
+  return level * kSlots + slot;
+}
+
+template <class T>
+void TimerWheel<T>::Link(SizeType index, SizeType slot) {
+  Node& node = nodes_[index];
+  node.slot = slot;
+  node.prev = kNil;
+  node.next = heads_[slot];
+  if (node.next != kNil) nodes_[node.next].prev = index;
+  heads_[slot] = index;
+  if (slot != kExpiring) ++level_sizes_[slot / kSlots];
+}
+
+template <class T>
+void TimerWheel<T>::Unlink(SizeType index) {
+  Node& node = nodes_[index];
+  if (node.prev == kNil) {
+    heads_[node.slot] = node.next;
+  } else {
+    nodes_[node.prev].next = node.next;
+  }
+  if (node.next != kNil) nodes_[node.next].prev = node.prev;
+  if (node.slot != kExpiring) --level_sizes_[node.slot / kSlots];
+}
+
+template <class T>
+void TimerWheel<T>::Cascade(int level) {
+  SizeType slot =
+      level * kSlots + static_cast<SizeType>((now_ >> (kSlotBits * level)) &
+                                             (kSlots - 1));
+  SizeType index = heads_[slot];
+  heads_[slot] = kNil;
+  while (index != kNil) {
+    SizeType next = nodes_[index].next;
+    --level_sizes_[level];
+    Link(index, SlotFor(nodes_[index].deadline));
+    index = next;
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_TIMER_WHEEL_H_
@@ -0,0 +1,535 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_UNROLLED_LIST_H_
+#define SRC_CONTAINERS_EXTRA_S21_UNROLLED_LIST_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+// Doubly linked list of chunks, each holding up to B elements contiguously.
+// Iteration walks arrays instead of chasing one pointer per element, and
+// the per-element overhead is two pointers per chunk rather than per value.
+//
+// A full chunk is split in half on a middle insert, while inserting at
+// either end of a full chunk opens a new one, so PushBack and PushFront
+// leave chunks completely filled. A chunk that Erase leaves below half
+// capacity is merged with a neighbour or takes elements from it, so erasures
+// never leave a chunk less than three eighths full unless it is the only
+// one. Every such step moves at most B elements, so Insert, Erase and Splice
+// are O(B) regardless of the list length. Any insertion or erasure
+// invalidates iterators into the chunks it touches.
+template <class T, size_t B = 16>
+class UnrolledList {
+  static_assert(B >= 2, "UnrolledList chunks must hold at least 2 elements");
+
+  // The sentinel is only links, the chunks add element storage
+  struct Links {
+    Links* next_ = nullptr;
+    Links* prev_ = nullptr;
+    size_t count_ = 0;
+  };
+
+  struct Chunk : Links {
+    alignas(T) unsigned char storage_[sizeof(T) * B];
+    T* Data() { return reinterpret_cast<T*>(storage_); }
+  };
+
+ public:
+  // UnrolledList Member type
+  using ValueType = T;
+  using Reference = T&;
+  using ConstReference = const T&;
+  using SizeType = size_t;
+
+  // internal class UnrolledListIterator
+  template <class Value>
+  class IteratorBase {
+    friend class UnrolledList;
+
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value*;
+    using reference = Value&;
+
+    IteratorBase() = default;
+    IteratorBase(Links* chunk, SizeType index)
+        : chunk_(chunk), index_(index) {}
+    // Iterator converts to ConstIterator
+    template <class Other>
+    IteratorBase(const IteratorBase<Other>& other)
+        : chunk_(other.chunk_), index_(other.index_) {}
+
+    reference operator*() const noexcept {
+      return static_cast<Chunk*>(chunk_)->Data()[index_];
+    }
+    pointer operator->() const noexcept { return &**this; }
+
+    IteratorBase& operator++() noexcept {
+      if (++index_ == chunk_->count_) {
+        chunk_ = chunk_->next_;
+        index_ = 0;
+      }
+      return *this;
+    }
+
+    IteratorBase operator++(int) noexcept {
+      IteratorBase tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    IteratorBase& operator--() noexcept {
+      if (index_ == 0) {
+        chunk_ = chunk_->prev_;
+        index_ = chunk_->count_;
+      }
+      --index_;
+      return *this;
+    }
+
+    IteratorBase operator--(int) noexcept {
+      IteratorBase tmp = *this;
+      --*this;
+      return tmp;
+    }
+
+    bool operator==(const IteratorBase& other) const noexcept {
+      return chunk_ == other.chunk_ && index_ == other.index_;
+    }
+
+    bool operator!=(const IteratorBase& other) const noexcept {
+      return !(*this == other);
+    }
+
+   private:
+    template <class>
+    friend class IteratorBase;
+    Links* chunk_ = nullptr;
+    SizeType index_ = 0;
+  };
+
+  using Iterator = IteratorBase<T>;
+  using ConstIterator = IteratorBase<const T>;
+
+  // UnrolledList Member functions
+  UnrolledList() { head_.next_ = head_.prev_ = &head_; }
+  explicit UnrolledList(SizeType n);
+  UnrolledList(std::initializer_list<ValueType> const& items);
+  UnrolledList(const UnrolledList& l);
+  UnrolledList(UnrolledList&& l) noexcept : UnrolledList() { Swap(l); }
+  ~UnrolledList() { Clear(); }
+  UnrolledList& operator=(const UnrolledList& l);
+  UnrolledList& operator=(UnrolledList&& l) noexcept;
+
+  // UnrolledList Element access
+  ConstReference Front() const;
+  ConstReference Back() const;
+
+  // UnrolledList Iterators
+  Iterator Begin() { return Iterator(head_.next_, 0); }
+  Iterator End() { return Iterator(&head_, 0); }
+  ConstIterator Cbegin() const;
+  ConstIterator Cend() const;
+
+  // UnrolledList Capacity
+  bool Empty() const { return size_ == 0; }
+  SizeType Size() const { return size_; }
+  SizeType MaxSize() const;
+  // Number of allocated chunks, for judging how densely they are filled
+  SizeType ChunkCount() const { return chunks_; }
+
+  // UnrolledList Modifiers
+  void Clear();
+  Iterator Insert(Iterator pos, ConstReference value);
+  Iterator Insert(Iterator pos, ValueType&& value);
+  // Returns the iterator following the erased element
+  Iterator Erase(Iterator pos);
+  void PushBack(ConstReference value) { Insert(End(), value); }
+  void PushBack(ValueType&& value) { Insert(End(), std::move(value)); }
+  void PopBack();
+  void PushFront(ConstReference value) { Insert(Begin(), value); }
+  void PushFront(ValueType&& value) { Insert(Begin(), std::move(value)); }
+  void PopFront();
+  void Swap(UnrolledList& other);
+  // Moves all elements of other in front of pos by relinking its chunks;
+  // only the chunk pos points into is split
+  void Splice(Iterator pos, UnrolledList& other);
+
+  template <typename... Args>
+  Iterator Emplace(Iterator pos, Args&&... args);
+  template <typename... Args>
+  void EmplaceBack(Args&&... args);
+  template <typename... Args>
+  void EmplaceFront(Args&&... args);
+
+ private:
+  Links head_;
+  SizeType size_ = 0;
+  SizeType chunks_ = 0;
+
+  // Support functions
+  static Chunk* AsChunk(Links* links) { return static_cast<Chunk*>(links); }
+  Links* NewChunkBefore(Links* next);
+  void FreeChunk(Links* chunk);
+  Links* Split(Links* chunk, SizeType at);
+  static void Relocate(Links* from, SizeType first, Links* to);
+  static void MoveFront(Links* from, SizeType n, Links* to);
+  static void MoveBack(Links* from, SizeType n, Links* to);
+  void Rebalance(Links*& chunk, SizeType& index);
+  static void InsertAt(Links* chunk, SizeType index, ValueType&& value);
+  static void EraseAt(Links* chunk, SizeType index);
+  void CheckNotEmpty() const;
+};
+
+// UnrolledList Member functions
+template <class T, size_t B>
+UnrolledList<T, B>::UnrolledList(SizeType n) : UnrolledList() {
+  while (n--) {
+    PushBack(ValueType());
+  }
+}
+
+template <class T, size_t B>
+UnrolledList<T, B>::UnrolledList(std::initializer_list<ValueType> const& items)
+    : UnrolledList() {
+  for (auto it = items.begin(); it != items.end(); ++it) {
+    PushBack(*it);
+  }
+}
+
+template <class T, size_t B>
+UnrolledList<T, B>::UnrolledList(const UnrolledList& l) : UnrolledList() {
+  for (ConstIterator it = l.Cbegin(); it != l.Cend(); ++it) {
+    PushBack(*it);
+  }
+}
+
+template <class T, size_t B>
+UnrolledList<T, B>& UnrolledList<T, B>::operator=(const UnrolledList& l) {
+  if (this != &l) {
+    UnrolledList copy(l);
+    Swap(copy);
+  }
+  return *this;
+}
+
+template <class T, size_t B>
+UnrolledList<T, B>& UnrolledList<T, B>::operator=(UnrolledList&& l) noexcept {
+  Clear();
+  Swap(l);
+  return *this;
+}
+
+// UnrolledList Element access
+template <class T, size_t B>
+typename UnrolledList<T, B>::ConstReference UnrolledList<T, B>::Front() const {
+  CheckNotEmpty();
+  return AsChunk(head_.next_)->Data()[0];
+}
+
+template <class T, size_t B>
+typename UnrolledList<T, B>::ConstReference UnrolledList<T, B>::Back() const {
+  CheckNotEmpty();
+  Links* last = head_.prev_;
+  return AsChunk(last)->Data()[last->count_ - 1];
+}
+
+// UnrolledList Iterators
+template <class T, size_t B>
+typename UnrolledList<T, B>::ConstIterator UnrolledList<T, B>::Cbegin() const {
+  return ConstIterator(head_.next_, 0);
+}
+
+template <class T, size_t B>
+typename UnrolledList<T, B>::ConstIterator UnrolledList<T, B>::Cend() const {
+  return ConstIterator(const_cast<Links*>(&head_), 0);
+}
+
+// UnrolledList Capacity
+template <class T, size_t B>
+typename UnrolledList<T, B>::SizeType UnrolledList<T, B>::MaxSize() const {
+  return std::numeric_limits<SizeType>::max() / sizeof(Chunk) * B;
+}
+
+// UnrolledList Modifiers
+template <class T, size_t B>
+void UnrolledList<T, B>::Clear() {
+  while (head_.next_ != &head_) {
+    Links* chunk = head_.next_;
+    T* data = AsChunk(chunk)->Data();
+    for (SizeType i = 0; i < chunk->count_; ++i) data[i].~T();
+    FreeChunk(chunk);
+  }
+  size_ = 0;
+}
+
+template <class T, size_t B>
+typename UnrolledList<T, B>::Iterator UnrolledList<T, B>::Insert(
+    Iterator pos, ConstReference value) {
+  return Emplace(pos, value);
+}
+
+template <class T, size_t B>
+typename UnrolledList<T, B>::Iterator UnrolledList<T, B>::Insert(
+    Iterator pos, ValueType&& value) {
+  return Emplace(pos, std::move(value));
+}
+
+template <class T, size_t B>
+typename UnrolledList<T, B>::Iterator UnrolledList<T, B>::Erase(
+    Iterator pos) {
+  if (pos.chunk_ == &head_) {
+    throw std::out_of_range("Iterator is NULL");
+  }
+  Links* chunk = pos.chunk_;
+  SizeType index = pos.index_;
+  EraseAt(chunk, index);
+  --size_;
+  if (chunk->count_ == 0) {
+    Links* next = chunk->next_;
+    FreeChunk(chunk);
+    return Iterator(next, 0);
+  }
+  if (chunk->count_ < B / 2) Rebalance(chunk, index);
+  if (index < chunk->count_) return Iterator(chunk, index);
+  return Iterator(chunk->next_, 0);
+}
+
+template <class T, size_t B>
+void UnrolledList<T, B>::PopBack() {
+  CheckNotEmpty();
+  Erase(--End());
+}
+
+template <class T, size_t B>
+void UnrolledList<T, B>::PopFront() {
+  CheckNotEmpty();
+  Erase(Begin());
+}
+
+// The sentinels stay where they are, so the chunks next to each one are
+// repointed after the exchange
+template <class T, size_t B>
+void UnrolledList<T, B>::Swap(UnrolledList& other) {
+  std::swap(head_.next_, other.head_.next_);
+  std::swap(head_.prev_, other.head_.prev_);
+  std::swap(size_, other.size_);
+  std::swap(chunks_, other.chunks_);
+  for (UnrolledList* list : {this, &other}) {
+    if (list->chunks_ == 0) {
+      list->head_.next_ = list->head_.prev_ = &list->head_;
+    } else {
+      list->head_.next_->prev_ = &list->head_;
+      list->head_.prev_->next_ = &list->head_;
+    }
+  }
+}
+
+template <class T, size_t B>
+void UnrolledList<T, B>::Splice(Iterator pos, UnrolledList& other) {
+  if (&other == this || other.Empty()) return;
+  Links* next = pos.chunk_;
+  if (pos.index_ > 0) next = Split(next, pos.index_);
+  Links* first = other.head_.next_;
+  Links* last = other.head_.prev_;
+  first->prev_ = next->prev_;
+  next->prev_->next_ = first;
+  last->next_ = next;
+  next->prev_ = last;
+  size_ += other.size_;
+  chunks_ += other.chunks_;
+  other.head_.next_ = other.head_.prev_ = &other.head_;
+  other.size_ = 0;
+  other.chunks_ = 0;
+}
+
+// At a chunk boundary the element goes to the end of the previous chunk or
+// into a fresh one, so filling from either end never splits; only an insert
+// inside a full chunk splits it
+template <class T, size_t B>
+template <typename... Args>
+typename UnrolledList<T, B>::Iterator UnrolledList<T, B>::Emplace(
+    Iterator pos, Args&&... args) {
+  ValueType value(std::forward<Args>(args)...);
+  Links* chunk = pos.chunk_;
+  SizeType index = pos.index_;
+  if (chunk == &head_ || (index == 0 && chunk->count_ == B)) {
+    Links* prev = chunk->prev_;
+    if (prev != &head_ && prev->count_ < B) {
+      chunk = prev;
+      index = prev->count_;
+    } else {
+      chunk = NewChunkBefore(chunk);
+      index = 0;
+    }
+  } else if (chunk->count_ == B) {
+    Links* upper = Split(chunk, B / 2);
+    if (index > B / 2) {
+      chunk = upper;
+      index -= B / 2;
+    }
+  }
+  InsertAt(chunk, index, std::move(value));
+  ++size_;
+  return Iterator(chunk, index);
+}
+
+template <class T, size_t B>
+template <typename... Args>
+void UnrolledList<T, B>::EmplaceBack(Args&&... args) {
+  Emplace(End(), std::forward<Args>(args)...);
+}
+
+template <class T, size_t B>
+template <typename... Args>
+void UnrolledList<T, B>::EmplaceFront(Args&&... args) {
+  Emplace(Begin(), std::forward<Args>(args)...);
+}
+
+// Support functions
+template <class T, size_t B>
+typename UnrolledList<T, B>::Links* UnrolledList<T, B>::NewChunkBefore(
+    Links* next) {
+  Links* chunk = new Chunk;
+  chunk->next_ = next;
+  chunk->prev_ = next->prev_;
+  next->prev_->next_ = chunk;
+  next->prev_ = chunk;
+  ++chunks_;
+  return chunk;
+}
+
+// The chunk must already be empty of live elements
+template <class T, size_t B>
+void UnrolledList<T, B>::FreeChunk(Links* chunk) {
+  chunk->prev_->next_ = chunk->next_;
+  chunk->next_->prev_ = chunk->prev_;
+  delete AsChunk(chunk);
+  --chunks_;
+}
+
+// Moves the elements from position at onwards into a new chunk right after
+// chunk and returns the new chunk
+template <class T, size_t B>
+typename UnrolledList<T, B>::Links* UnrolledList<T, B>::Split(Links* chunk,
+                                                              SizeType at) {
+  Links* upper = NewChunkBefore(chunk->next_);
+  Relocate(chunk, at, upper);
+  return upper;
+}
+
+// Appends the elements [first, from->count_) of from to to
+template <class T, size_t B>
+void UnrolledList<T, B>::Relocate(Links* from, SizeType first, Links* to) {
+  T* source = AsChunk(from)->Data();
+  T* target = AsChunk(to)->Data();
+  for (SizeType i = first; i < from->count_; ++i) {
+    new (target + to->count_++) T(std::move(source[i]));
+    source[i].~T();
+  }
+  from->count_ = first;
+}
+
+// Moves the first n elements of from to the back of to
+template <class T, size_t B>
+void UnrolledList<T, B>::MoveFront(Links* from, SizeType n, Links* to) {
+  T* source = AsChunk(from)->Data();
+  T* target = AsChunk(to)->Data();
+  for (SizeType i = 0; i < n; ++i) {
+    new (target + to->count_++) T(std::move(source[i]));
+    source[i].~T();
+  }
+  for (SizeType i = n; i < from->count_; ++i) {
+    new (source + i - n) T(std::move(source[i]));
+    source[i].~T();
+  }
+  from->count_ -= n;
+}
+
+// Moves the last n elements of from to the front of to
+template <class T, size_t B>
+void UnrolledList<T, B>::MoveBack(Links* from, SizeType n, Links* to) {
+  T* source = AsChunk(from)->Data();
+  T* target = AsChunk(to)->Data();
+  for (SizeType i = to->count_; i-- > 0;) {
+    new (target + i + n) T(std::move(target[i]));
+    target[i].~T();
+  }
+  from->count_ -= n;
+  for (SizeType i = 0; i < n; ++i) {
+    new (target + i) T(std::move(source[from->count_ + i]));
+    source[from->count_ + i].~T();
+  }
+  to->count_ += n;
+}
+
+// Refills chunk from its successor, or its predecessor at the end of the
+// list. Two chunks that fit in three quarters of one are merged, leaving
+// room for a following insert not to split them straight away; otherwise
+// they are evened out, which leaves chunk at 3B/8 or more; a neighbour no
+// larger than chunk is left alone. chunk and index are moved along with the
+// element they point to.
+template <class T, size_t B>
+void UnrolledList<T, B>::Rebalance(Links*& chunk, SizeType& index) {
+  Links* next = chunk->next_;
+  Links* prev = chunk->prev_;
+  if (next != &head_) {
+    if (chunk->count_ + next->count_ <= B - B / 4) {
+      Relocate(next, 0, chunk);
+      FreeChunk(next);
+    } else if (next->count_ > chunk->count_ + 1) {
+      MoveFront(next, (next->count_ - chunk->count_) / 2, chunk);
+    }
+  } else if (prev != &head_) {
+    if (prev->count_ + chunk->count_ <= B - B / 4) {
+      index += prev->count_;
+      Relocate(chunk, 0, prev);
+      FreeChunk(chunk);
+      chunk = prev;
+    } else if (prev->count_ > chunk->count_ + 1) {
+      SizeType n = (prev->count_ - chunk->count_) / 2;
+      MoveBack(prev, n, chunk);
+      index += n;
+    }
+  }
+}
+
+template <class T, size_t B>
+void UnrolledList<T, B>::InsertAt(Links* chunk, SizeType index,
+                                  ValueType&& value) {
+  T* data = AsChunk(chunk)->Data();
+  SizeType count = chunk->count_;
+  if (index == count) {
+    new (data + count) T(std::move(value));
+  } else {
+    new (data + count) T(std::move(data[count - 1]));
+    std::move_backward(data + index, data + count - 1, data + count);
+    data[index] = std::move(value);
+  }
+  ++chunk->count_;
+}
+
+template <class T, size_t B>
+void UnrolledList<T, B>::EraseAt(Links* chunk, SizeType index) {
+  T* data = AsChunk(chunk)->Data();
+  std::move(data + index + 1, data + chunk->count_, data + index);
+  data[--chunk->count_].~T();
+}
+
+template <class T, size_t B>
+void UnrolledList<T, B>::CheckNotEmpty() const {
+  if (Empty()) {
+    throw std::out_of_range("Container is empty");
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_UNROLLED_LIST_H_
@@ -0,0 +1,182 @@
+#ifndef SRC_CONTAINERS_EXTRA_S21_WORK_STEALING_DEQUE_H_
+#define SRC_CONTAINERS_EXTRA_S21_WORK_STEALING_DEQUE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+#include "../containers/s21_vector.h"
+
+namespace s21 {
+// Chase-Lev work-stealing deque. One owner thread pushes and pops at the
+// bottom with plain loads and stores; any number of thieves take elements
+// from the top, competing with a compare-and-swap on top_. The circular
+// array doubles when it runs full. Thieves may still be reading an old array
+// after it was replaced, so replaced arrays are kept until the deque is
+// destroyed.
+//
+// Elements are copied in and out of atomic slots, so T must be trivially
+// copyable; task schedulers store pointers.
+template <class T>
+class WorkStealingDeque {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "WorkStealingDeque elements must be trivially copyable");
+
+ public:
+  // WorkStealingDeque Member type
+  using ValueType = T;
+  using Reference = T&;
+  using ConstReference = const T&;
+  using SizeType = size_t;
+
+  static constexpr SizeType kCacheLine = 64;
+  static constexpr SizeType kDefaultCapacity = 64;
+
+  // WorkStealingDeque Member functions
+  explicit WorkStealingDeque(SizeType capacity = kDefaultCapacity);
+  WorkStealingDeque(const WorkStealingDeque& d) = delete;
+  WorkStealingDeque& operator=(const WorkStealingDeque& d) = delete;
+  ~WorkStealingDeque();
+
+  // WorkStealingDeque Capacity
+  bool Empty() const;
+  SizeType Size() const;
+  SizeType Capacity() const;
+
+  // WorkStealingDeque Modifiers (owner)
+  void Push(ConstReference value);
+  bool TryPop(Reference out);
+
+  // WorkStealingDeque Modifiers (thieves)
+  bool Steal(Reference out);
+
+ private:
+  struct Array {
+    std::int64_t mask;
+    std::atomic<T>* slots;
+
+    explicit Array(std::int64_t capacity)
+        : mask(capacity - 1), slots(new std::atomic<T>[capacity]) {}
+    ~Array() { delete[] slots; }
+
+    T Get(std::int64_t i) const {
+      return slots[i & mask].load(std::memory_order_relaxed);
+    }
+    void Put(std::int64_t i, T value) {
+      slots[i & mask].store(value, std::memory_order_relaxed);
+    }
+  };
+
+  alignas(kCacheLine) std::atomic<std::int64_t> top_{0};
+  alignas(kCacheLine) std::atomic<std::int64_t> bottom_{0};
+  std::atomic<Array*> array_;
+  Vector<Array*> retired_;  // touched only by the owner
+
+  // Support functions
+  Array* Grow(Array* array, std::int64_t bottom, std::int64_t top);
+};
+
+// WorkStealingDeque Member functions
+template <class T>
+WorkStealingDeque<T>::WorkStealingDeque(SizeType capacity) {
+  std::int64_t size = 2;
+  while (size < static_cast<std::int64_t>(capacity)) size <<= 1;
+  array_.store(new Array(size), std::memory_order_relaxed);
+}
+
+template <class T>
+WorkStealingDeque<T>::~WorkStealingDeque() {
+  delete array_.load(std::memory_order_relaxed);
+  for (SizeType i = 0; i < retired_.Size(); ++i) {
+    delete retired_[i];
+  }
+}
+
+// WorkStealingDeque Capacity
+template <class T>
+bool WorkStealingDeque<T>::Empty() const {
+  return Size() == 0;
+}
+
+// Exact for the owner while no thief is active, a snapshot otherwise
+template <class T>
+typename WorkStealingDeque<T>::SizeType WorkStealingDeque<T>::Size() const {
+  std::int64_t bottom = bottom_.load(std::memory_order_acquire);
+  std::int64_t top = top_.load(std::memory_order_acquire);
+  return bottom > top ? static_cast<SizeType>(bottom - top) : 0;
+}
+
+template <class T>
+typename WorkStealingDeque<T>::SizeType WorkStealingDeque<T>::Capacity()
+    const {
+  return static_cast<SizeType>(array_.load(std::memory_order_acquire)->mask +
+                               1);
+}
+
+// WorkStealingDeque Modifiers (owner)
+template <class T>
+void WorkStealingDeque<T>::Push(ConstReference value) {
+  std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+  std::int64_t top = top_.load(std::memory_order_acquire);
+  Array* array = array_.load(std::memory_order_relaxed);
+  if (bottom - top > array->mask) array = Grow(array, bottom, top);
+  array->Put(bottom, value);
+  bottom_.store(bottom + 1, std::memory_order_release);
+}
+
+// Publishing the decremented bottom before reading top (both seq_cst) makes
+// the owner and a thief agree on who gets the last remaining element; that
+// one element is then settled with the same compare-and-swap thieves use
+template <class T>
+bool WorkStealingDeque<T>::TryPop(Reference out) {
+  std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+  Array* array = array_.load(std::memory_order_relaxed);
+  bottom_.store(bottom, std::memory_order_seq_cst);
+  std::int64_t top = top_.load(std::memory_order_seq_cst);
+  bool taken = top <= bottom;
+  if (taken) {
+    out = array->Get(bottom);
+    if (top == bottom) {
+      taken = top_.compare_exchange_strong(top, top + 1,
+                                           std::memory_order_seq_cst,
+                                           std::memory_order_relaxed);
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+  } else {
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+  }
+  return taken;
+}
+
+// WorkStealingDeque Modifiers (thieves)
+template <class T>
+bool WorkStealingDeque<T>::Steal(Reference out) {
+  std::int64_t top = top_.load(std::memory_order_seq_cst);
+  std::int64_t bottom = bottom_.load(std::memory_order_seq_cst);
+  if (top >= bottom) return false;
+  Array* array = array_.load(std::memory_order_acquire);
+  T value = array->Get(top);
+  if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                    std::memory_order_relaxed)) {
+    return false;  // lost the race to the owner or another thief
+  }
+  out = value;
+  return true;
+}
+
+// Support functions
+template <class T>
+typename WorkStealingDeque<T>::Array* WorkStealingDeque<T>::Grow(
+    Array* array, std::int64_t bottom, std::int64_t top) {
+  Array* bigger = new Array(2 * (array->mask + 1));
+  for (std::int64_t i = top; i < bottom; ++i) {
+    bigger->Put(i, array->Get(i));
+  }
+  retired_.PushBack(array);
+  array_.store(bigger, std::memory_order_release);
+  return bigger;
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONTAINERS_EXTRA_S21_WORK_STEALING_DEQUE_H_
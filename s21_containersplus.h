@@ -2,6 +2,36 @@
 #define SRC_S21_CONTAINERSPLUS_H_
 
 #include "containers_extra/s21_array.h"
+#include "containers_extra/s21_blocking_queue.h"
+#include "containers_extra/s21_bloom_filter.h"
+#include "containers_extra/s21_cache.h"
+#include "containers_extra/s21_concurrent_map.h"
+#include "containers_extra/s21_concurrent_skip_list_map.h"
+#include "containers_extra/s21_cow_map.h"
+#include "containers_extra/s21_cow_vector.h"
+#include "containers_extra/s21_deque.h"
+#include "containers_extra/s21_epoch.h"
+#include "containers_extra/s21_filtered_map.h"
+#include "containers_extra/s21_filtered_multiset.h"
+#include "containers_extra/s21_filtered_set.h"
+#include "containers_extra/s21_forward_list.h"
+#include "containers_extra/s21_frozen_map.h"
+#include "containers_extra/s21_frozen_set.h"
+#include "containers_extra/s21_indexed_priority_queue.h"
+#include "containers_extra/s21_intrusive_list.h"
+#include "containers_extra/s21_intrusive_set.h"
+#include "containers_extra/s21_lock_free_stack.h"
+#include "containers_extra/s21_mpmc_queue.h"
 #include "containers_extra/s21_multiset.h"
+#include "containers_extra/s21_pairing_heap.h"
+#include "containers_extra/s21_persistent_map.h"
+#include "containers_extra/s21_persistent_set.h"
+#include "containers_extra/s21_priority_queue.h"
+#include "containers_extra/s21_rcu_map.h"
+#include "containers_extra/s21_spsc_queue.h"
+#include "containers_extra/s21_thread_pool.h"
+#include "containers_extra/s21_timer_wheel.h"
+#include "containers_extra/s21_unrolled_list.h"
+#include "containers_extra/s21_work_stealing_deque.h"
 
 #endif  // SRC_S21_CONTAINERSPLUS_H_
\ No newline at end of file
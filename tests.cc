@@ -1,11 +1,22 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <forward_list>
+#include <functional>
 #include <list>
 #include <map>
+#include <memory>
 #include <queue>
+#include <random>
 #include <set>
 #include <stack>
+#include <string>
+#include <string_view>
+#include <thread>
 #include <vector>
 
 #include "s21_containers.h"
@@ -129,6 +140,1649 @@ TEST(array, fill_test) {
   }
 }
 
+// BLOCKING QUEUE---------------------------------------------------------------
+
+TEST(blocking_queue, push_pop_test) {
+  s21::BlockingQueue<int> my_queue;
+  std::queue<int> orig_queue;
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_TRUE(my_queue.Push(i));
+    orig_queue.push(i);
+  }
+  ASSERT_EQ(my_queue.Size(), orig_queue.size());
+  int value = 0;
+  while (!orig_queue.empty()) {
+    ASSERT_TRUE(my_queue.Pop(value));
+    ASSERT_EQ(value, orig_queue.front());
+    orig_queue.pop();
+  }
+  ASSERT_TRUE(my_queue.Empty());
+  ASSERT_FALSE(my_queue.TryPop(value));
+}
+
+TEST(blocking_queue, push_range_pop_batch_test) {
+  s21::BlockingQueue<std::string> my_queue;
+  std::vector<std::string> items = {"a", "b", "c", "d", "e"};
+  ASSERT_EQ(my_queue.PushRange(items.begin(), items.end()), items.size());
+  s21::Vector<std::string> batch;
+  ASSERT_EQ(my_queue.PopBatch(3, batch), 3U);
+  ASSERT_EQ(my_queue.PopBatch(3, batch), 2U);
+  ASSERT_EQ(batch.Size(), items.size());
+  for (size_t i = 0; i < items.size(); ++i) ASSERT_EQ(batch[i], items[i]);
+}
+
+TEST(blocking_queue, try_pop_for_test) {
+  s21::BlockingQueue<int> my_queue;
+  int value = 0;
+  ASSERT_FALSE(my_queue.TryPopFor(value, std::chrono::milliseconds(5)));
+  std::thread producer([&my_queue] { my_queue.Push(42); });
+  ASSERT_TRUE(my_queue.TryPopFor(value, std::chrono::seconds(10)));
+  ASSERT_EQ(value, 42);
+  producer.join();
+}
+
+TEST(blocking_queue, close_test) {
+  s21::BlockingQueue<int> my_queue;
+  my_queue.Push(1);
+  std::thread consumer([&my_queue] {
+    int value = 0;
+    ASSERT_TRUE(my_queue.Pop(value));
+    ASSERT_EQ(value, 1);
+    ASSERT_FALSE(my_queue.Pop(value));
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  my_queue.Close();
+  consumer.join();
+  ASSERT_TRUE(my_queue.Closed());
+  ASSERT_FALSE(my_queue.Push(2));
+  ASSERT_TRUE(my_queue.Empty());
+}
+
+TEST(blocking_queue, stress_test) {
+  constexpr int kPerProducer = 20000;
+  constexpr int kThreads = 4;
+  s21::BlockingQueue<int> my_queue;
+  std::atomic<long long> sum{0};
+  std::vector<std::thread> producers, consumers;
+  for (int t = 0; t < kThreads; ++t) {
+    producers.emplace_back([&my_queue] {
+      int batch[16];
+      for (int i = 0; i < kPerProducer; i += 16) {
+        for (int j = 0; j < 16; ++j) batch[j] = i + j;
+        my_queue.PushRange(batch, batch + 16);
+      }
+    });
+    consumers.emplace_back([&my_queue, &sum, t] {
+      int value = 0;
+      if (t % 2) {
+        while (my_queue.Pop(value)) sum += value;
+      } else {
+        for (;;) {
+          s21::Vector<int> batch;
+          if (!my_queue.PopBatch(8, batch)) break;
+          for (size_t i = 0; i < batch.Size(); ++i) sum += batch[i];
+        }
+      }
+    });
+  }
+  for (auto& producer : producers) producer.join();
+  my_queue.Close();
+  for (auto& consumer : consumers) consumer.join();
+  ASSERT_EQ(sum.load(), 1LL * kThreads * kPerProducer * (kPerProducer - 1) / 2);
+}
+
+// BLOOM FILTER-----------------------------------------------------------------
+
+TEST(bloom_filter, insert_test) {
+  s21::BloomFilter<int> filter(10000);
+  ASSERT_EQ(filter.Capacity(), 10000U);
+  ASSERT_GE(filter.Bits(), 100000U);
+  ASSERT_EQ(filter.Hashes(), 7);
+  for (int i = 0; i < 20000; i += 2) filter.Insert(i);
+  int false_positives = 0;
+  for (int i = 0; i < 20000; i += 2) {
+    ASSERT_TRUE(filter.MayContain(i));
+    false_positives += filter.MayContain(i + 1);
+  }
+  ASSERT_LT(false_positives, 300);
+  filter.Clear();
+  for (int i = 0; i < 20000; ++i) ASSERT_FALSE(filter.MayContain(i));
+}
+
+TEST(bloom_filter, bits_per_key_test) {
+  ASSERT_NEAR(s21::BloomFilter<int>::BitsPerKey(0.01), 9.585, 0.01);
+  ASSERT_EQ(s21::BloomFilter<int>::BitsPerKey(1), 1);
+  double bits_per_key = s21::BloomFilter<int>::BitsPerKey(0.001);
+  s21::BloomFilter<std::string> filter(5000, bits_per_key);
+  for (int i = 0; i < 5000; ++i) filter.Insert("key" + std::to_string(i));
+  int false_positives = 0;
+  for (int i = 0; i < 5000; ++i) {
+    ASSERT_TRUE(filter.MayContain("key" + std::to_string(i)));
+    false_positives += filter.MayContain("absent" + std::to_string(i));
+  }
+  ASSERT_LT(false_positives, 25);
+  s21::BloomFilter<int> empty;
+  ASSERT_FALSE(empty.MayContain(0));
+}
+
+// CACHE------------------------------------------------------------------------
+
+TEST(lru_cache, get_put_test) {
+  s21::LruCache<int, std::string> cache(3);
+  cache.Put(1, "one");
+  cache.Put(2, "two");
+  cache.Put(3, "three");
+  ASSERT_EQ(*cache.Get(1), "one");
+  cache.Put(4, "four");
+  ASSERT_FALSE(cache.Contains(2));
+  ASSERT_EQ(cache.Get(2), nullptr);
+  ASSERT_TRUE(cache.Contains(1));
+  cache.Put(3, "THREE");
+  cache.Put(5, "five");
+  ASSERT_FALSE(cache.Contains(1));
+  ASSERT_EQ(*cache.Get(3), "THREE");
+  ASSERT_EQ(cache.Size(), 3U);
+  ASSERT_EQ(cache.Stats().hits, 2U);
+  ASSERT_EQ(cache.Stats().misses, 1U);
+  ASSERT_EQ(cache.Stats().evictions, 2U);
+  ASSERT_TRUE(cache.Erase(4));
+  ASSERT_FALSE(cache.Erase(4));
+  ASSERT_EQ(cache.Size(), 2U);
+  cache.Clear();
+  ASSERT_TRUE(cache.Empty());
+  ASSERT_FALSE(cache.Contains(3));
+}
+
+TEST(lru_cache, weigher_test) {
+  s21::LruCache<int, std::string> cache(
+      10, [](const int&, const std::string& value) { return value.size(); });
+  cache.Put(1, "aaaa");
+  cache.Put(2, "bbbb");
+  ASSERT_EQ(cache.Weight(), 8U);
+  cache.Put(3, "ccccc");
+  ASSERT_FALSE(cache.Contains(1));
+  ASSERT_EQ(cache.Weight(), 9U);
+  ASSERT_FALSE(cache.Put(4, "dddddddddddd"));
+  ASSERT_FALSE(cache.Contains(4));
+  cache.Put(2, "bbbbbb");
+  ASSERT_FALSE(cache.Contains(3));
+  ASSERT_EQ(cache.Weight(), 6U);
+  ASSERT_EQ(cache.Size(), 1U);
+}
+
+TEST(lru_cache, random_test) {
+  s21::LruCache<int, int> cache(64);
+  std::list<std::pair<int, int>> orig_order;
+  unsigned state = 99;
+  for (int round = 0; round < 20000; ++round) {
+    state = state * 1103515245U + 12345U;
+    int key = static_cast<int>((state >> 8) % 128);
+    auto orig = std::find_if(orig_order.begin(), orig_order.end(),
+                             [key](const auto& p) { return p.first == key; });
+    if (state % 2) {
+      int* value = cache.Get(key);
+      ASSERT_EQ(value != nullptr, orig != orig_order.end());
+      if (value) {
+        ASSERT_EQ(*value, orig->second);
+        orig_order.splice(orig_order.end(), orig_order, orig);
+      }
+    } else {
+      cache.Put(key, round);
+      if (orig != orig_order.end()) orig_order.erase(orig);
+      orig_order.push_back({key, round});
+      if (orig_order.size() > 64) orig_order.pop_front();
+    }
+  }
+  ASSERT_EQ(cache.Size(), orig_order.size());
+  for (const auto& entry : orig_order) ASSERT_TRUE(cache.Contains(entry.first));
+}
+
+TEST(lfu_cache, eviction_order_test) {
+  s21::LfuCache<std::string, int> cache(3);
+  cache.Put("a", 1);
+  cache.Put("b", 2);
+  cache.Put("c", 3);
+  cache.Get("a");
+  cache.Get("a");
+  cache.Get("b");
+  ASSERT_EQ(cache.Frequency("a"), 3U);
+  ASSERT_EQ(cache.Frequency("b"), 2U);
+  ASSERT_EQ(cache.Frequency("c"), 1U);
+  cache.Put("d", 4);
+  ASSERT_FALSE(cache.Contains("c"));
+  // d is the only entry with a single use
+  cache.Put("e", 5);
+  ASSERT_FALSE(cache.Contains("d"));
+  cache.Get("e");
+  // b and e have two uses each, b reached them first
+  cache.Put("f", 6);
+  ASSERT_FALSE(cache.Contains("b"));
+  ASSERT_TRUE(cache.Contains("e"));
+  ASSERT_TRUE(cache.Contains("f"));
+  ASSERT_TRUE(cache.Contains("a"));
+  ASSERT_EQ(cache.Stats().evictions, 3U);
+  ASSERT_TRUE(cache.Erase("a"));
+  ASSERT_EQ(cache.Frequency("a"), 0U);
+  ASSERT_EQ(cache.Size(), 2U);
+}
+
+TEST(lfu_cache, random_test) {
+  struct Model {
+    int value;
+    size_t frequency;
+    int used;
+  };
+  s21::LfuCache<int, int> cache(32);
+  std::map<int, Model> model;
+  unsigned state = 4242;
+  for (int round = 0; round < 20000; ++round) {
+    state = state * 1103515245U + 12345U;
+    int key = static_cast<int>((state >> 8) % 96);
+    auto orig = model.find(key);
+    if (state % 3) {
+      int* value = cache.Get(key);
+      ASSERT_EQ(value != nullptr, orig != model.end());
+      if (value) {
+        ASSERT_EQ(*value, orig->second.value);
+        ++orig->second.frequency;
+        orig->second.used = round;
+      }
+    } else if (orig != model.end()) {
+      cache.Put(key, round);
+      orig->second = {round, orig->second.frequency + 1, round};
+    } else {
+      if (model.size() == 32) {
+        auto victim = std::min_element(
+            model.begin(), model.end(), [](const auto& a, const auto& b) {
+              return std::make_pair(a.second.frequency, a.second.used) <
+                     std::make_pair(b.second.frequency, b.second.used);
+            });
+        model.erase(victim);
+      }
+      cache.Put(key, round);
+      model[key] = {round, 1, round};
+    }
+  }
+  ASSERT_EQ(cache.Size(), model.size());
+  for (const auto& entry : model) {
+    ASSERT_EQ(cache.Frequency(entry.first), entry.second.frequency);
+  }
+}
+
+// CONCURRENT MAP---------------------------------------------------------------
+
+TEST(concurrent_map, basic_test) {
+  s21::ConcurrentMap<int, std::string, 4> my_map;
+  ASSERT_TRUE(my_map.Empty());
+  ASSERT_TRUE(my_map.Insert(1, "one"));
+  ASSERT_FALSE(my_map.Insert(1, "uno"));
+  ASSERT_TRUE(my_map.InsertOrAssign(2, "two"));
+  ASSERT_FALSE(my_map.InsertOrAssign(2, "dos"));
+  std::string value;
+  ASSERT_TRUE(my_map.Find(1, value));
+  ASSERT_EQ(value, "one");
+  ASSERT_EQ(my_map.At(2), "dos");
+  ASSERT_FALSE(my_map.Find(3, value));
+  ASSERT_EQ(my_map.Size(), 2U);
+  ASSERT_TRUE(my_map.Erase(1));
+  ASSERT_FALSE(my_map.Erase(1));
+  ASSERT_FALSE(my_map.Contains(1));
+  ASSERT_TRUE(my_map.Compute(3, [](std::string& v) {
+    v += "three";
+    return true;
+  }));
+  ASSERT_EQ(my_map.At(3), "three");
+  ASSERT_FALSE(my_map.Compute(3, [](std::string&) { return false; }));
+  ASSERT_FALSE(my_map.Contains(3));
+  my_map.Clear();
+  ASSERT_TRUE(my_map.Empty());
+}
+
+TEST(concurrent_map, for_each_test) {
+  s21::ConcurrentMap<int, int> my_map;
+  std::map<int, int> orig_map;
+  for (int i = 0; i < 200; ++i) {
+    my_map.Insert(i * 7, i);
+    orig_map[i * 7] = i;
+  }
+  std::map<int, int> seen;
+  my_map.ForEach([&seen](const int& key, const int& value) {
+    seen[key] = value;
+  });
+  ASSERT_EQ(seen, orig_map);
+}
+
+TEST(concurrent_map, concurrent_compute_test) {
+  s21::ConcurrentMap<int, int, 8> counters;
+  const int kThreads = 4;
+  const int kIncrements = 5000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&counters, t] {
+      for (int i = 0; i < kIncrements; ++i) {
+        counters.Compute(i % 50, [](int& v) {
+          ++v;
+          return true;
+        });
+        if (i % 10 == t) counters.Contains(i % 50);
+      }
+    });
+  }
+  // Every consistent snapshot has whole increments only
+  for (int round = 0; round < 20; ++round) {
+    long long total = 0;
+    counters.ForEach([&total](const int&, const int& v) { total += v; });
+    ASSERT_LE(total, kThreads * kIncrements);
+  }
+  for (std::thread& thread : threads) thread.join();
+  ASSERT_EQ(counters.Size(), 50U);
+  long long total = 0;
+  counters.ForEach([&total](const int&, const int& v) { total += v; });
+  ASSERT_EQ(total, kThreads * kIncrements);
+  ASSERT_EQ(counters.At(0), kThreads * kIncrements / 50);
+}
+
+TEST(concurrent_map, batch_test) {
+  s21::ConcurrentMap<int, int, 4> my_map;
+  for (int key = 0; key < 200; key += 2) my_map.Insert(key, key * 10);
+  std::vector<int> keys;
+  for (int key = 250; key >= -10; key -= 3) keys.push_back(key);
+  std::vector<char> contains(keys.size());
+  my_map.ContainsBatch(keys.begin(), keys.size(), contains.begin());
+  std::vector<int> values(keys.size(), -1);
+  std::vector<bool> found;
+  size_t hits = my_map.FindBatch(keys.begin(), keys.size(), values.begin(),
+                                 std::back_inserter(found));
+  size_t expected_hits = 0;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    bool present = keys[i] >= 0 && keys[i] < 200 && keys[i] % 2 == 0;
+    expected_hits += present;
+    ASSERT_EQ(contains[i] != 0, present);
+    ASSERT_EQ(found[i], present);
+    ASSERT_EQ(values[i], present ? keys[i] * 10 : -1);
+  }
+  ASSERT_EQ(hits, expected_hits);
+}
+
+// CONCURRENT SKIP LIST MAP-----------------------------------------------------
+
+TEST(concurrent_skip_list_map, basic_test) {
+  s21::ConcurrentSkipListMap<int, std::string> my_map;
+  std::map<int, std::string> orig_map;
+  ASSERT_TRUE(my_map.Empty());
+  ASSERT_EQ(my_map.Begin(), my_map.End());
+  for (int i = 0; i < 300; ++i) {
+    int key = (i * 37) % 301;
+    std::string value = std::to_string(i);
+    ASSERT_EQ(my_map.Insert(key, value), orig_map.emplace(key, value).second);
+  }
+  ASSERT_FALSE(my_map.Insert(37, "again"));
+  for (int key = 0; key < 301; key += 3) {
+    ASSERT_EQ(my_map.Erase(key), orig_map.erase(key) == 1);
+  }
+  ASSERT_FALSE(my_map.Erase(0));
+  ASSERT_EQ(my_map.Size(), orig_map.size());
+  auto orig_it = orig_map.begin();
+  for (auto it = my_map.Begin(); it != my_map.End(); ++it, ++orig_it) {
+    ASSERT_EQ(it->first, orig_it->first);
+    ASSERT_EQ(it->second, orig_it->second);
+  }
+  ASSERT_EQ(orig_it, orig_map.end());
+  std::string value;
+  ASSERT_TRUE(my_map.Find(37, value));
+  ASSERT_EQ(value, orig_map[37]);
+  ASSERT_FALSE(my_map.Find(3, value));
+  ASSERT_EQ(my_map.Find(3), my_map.End());
+  ASSERT_EQ(my_map.Find(4)->second, orig_map[4]);
+  ASSERT_TRUE(my_map.Contains(1));
+  ASSERT_EQ(my_map.At(2), orig_map[2]);
+  ASSERT_EQ(my_map.LowerBound(3)->first, 4);
+  ASSERT_EQ(my_map.LowerBound(-5)->first, orig_map.begin()->first);
+  ASSERT_EQ(my_map.LowerBound(301), my_map.End());
+}
+
+TEST(concurrent_skip_list_map, concurrent_insert_erase_test) {
+  s21::ConcurrentSkipListMap<int, int> my_map;
+  const int kThreads = 4;
+  const int kKeys = 2000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&my_map, t] {
+      for (int i = t; i < kKeys; i += kThreads) my_map.Insert(i, i * 2);
+      for (int i = t; i < kKeys; i += 2 * kThreads) my_map.Erase(i);
+      // Every thread races for the same surviving keys here
+      for (int i = kThreads; i < kKeys; i += 2 * kThreads) {
+        if (my_map.Erase(i)) my_map.Insert(i, i * 2);
+      }
+    });
+  }
+  for (std::thread& thread : threads) thread.join();
+  std::set<int> orig_set;
+  for (int t = 0; t < kThreads; ++t) {
+    for (int i = t + kThreads; i < kKeys; i += 2 * kThreads) orig_set.insert(i);
+  }
+  ASSERT_EQ(my_map.Size(), orig_set.size());
+  auto orig_it = orig_set.begin();
+  for (auto it = my_map.Begin(); it != my_map.End(); ++it, ++orig_it) {
+    ASSERT_EQ(it->first, *orig_it);
+    ASSERT_EQ(it->second, *orig_it * 2);
+  }
+  ASSERT_EQ(orig_it, orig_set.end());
+}
+
+TEST(concurrent_skip_list_map, concurrent_scan_test) {
+  s21::ConcurrentSkipListMap<int, int> my_map;
+  // Even keys stay put, odd keys come and go while readers scan
+  for (int i = 0; i < 1000; i += 2) my_map.Insert(i, i);
+  std::atomic<bool> stop{false};
+  std::thread writer([&my_map, &stop] {
+    for (int round = 0; !stop; ++round) {
+      for (int i = 1; i < 1000; i += 2) {
+        if (round % 2 == 0) {
+          my_map.Insert(i, i);
+        } else {
+          my_map.Erase(i);
+        }
+      }
+    }
+  });
+  for (int scan = 0; scan < 50; ++scan) {
+    int previous = -1;
+    int evens = 0;
+    for (auto it = my_map.LowerBound(0); it != my_map.End(); ++it) {
+      ASSERT_LT(previous, it->first);
+      ASSERT_EQ(it->first, it->second);
+      if (it->first % 2 == 0) ++evens;
+      previous = it->first;
+    }
+    ASSERT_EQ(evens, 500);
+  }
+  stop = true;
+  writer.join();
+  ASSERT_EQ(my_map.Find(998)->second, 998);
+}
+
+// COW MAP----------------------------------------------------------------------
+
+TEST(cow_map, share_test) {
+  s21::CowMap<int, std::string> my_map{{1, "one"}, {2, "two"}};
+  s21::CowMap<int, std::string> copy = my_map;
+  const s21::CowMap<int, std::string>& reader = copy;
+  ASSERT_EQ(my_map.UseCount(), 2U);
+  ASSERT_EQ(&reader.Get(), &my_map.Get());
+  ASSERT_EQ(reader.At(2), "two");
+  ASSERT_EQ(reader.Find(1)->second, "one");
+  ASSERT_TRUE(reader.Contains(1));
+  ASSERT_EQ(copy.At(1), "one");
+  ASSERT_EQ(copy.Find(2)->second, "two");
+  ASSERT_EQ(copy.Begin()->first, 1);
+  ASSERT_TRUE(copy.Find(3) == copy.End());
+  ASSERT_EQ(my_map.UseCount(), 2U);
+  copy.InsertOrAssign(1, "uno");
+  copy[3] = "three";
+  ASSERT_EQ(my_map.UseCount(), 1U);
+  ASSERT_EQ(copy.UseCount(), 1U);
+  ASSERT_EQ(my_map.At(1), "one");
+  ASSERT_FALSE(my_map.Contains(3));
+  ASSERT_EQ(copy.At(1), "uno");
+  ASSERT_EQ(copy.Size(), 3U);
+}
+
+TEST(cow_map, modifiers_test) {
+  s21::CowMap<int, int> my_map{{1, 10}, {2, 20}, {3, 30}};
+  s21::CowMap<int, int> copy = my_map;
+  ASSERT_FALSE(copy.Erase(4));
+  ASSERT_EQ(my_map.UseCount(), 2U);
+  ASSERT_TRUE(copy.Erase(2));
+  ASSERT_EQ(my_map.UseCount(), 1U);
+  ASSERT_EQ(my_map.Size(), 3U);
+  copy.Merge(my_map);
+  copy.Merge(copy);
+  ASSERT_EQ(copy.Size(), 3U);
+  copy.Erase(copy.Find(1));
+  ASSERT_FALSE(copy.Contains(1));
+  s21::CowMap<int, int> other = copy;
+  other.Clear();
+  ASSERT_TRUE(other.Empty());
+  ASSERT_EQ(copy.Size(), 2U);
+  other.Swap(copy);
+  ASSERT_TRUE(copy.Empty());
+  ASSERT_EQ(other.At(3), 30);
+  copy = other;
+  auto pos = copy.Find(3);
+  copy.Mutate().At(3) = 33;
+  copy.Erase(pos);
+  ASSERT_EQ(copy.Size(), 1U);
+  ASSERT_EQ(other.At(3), 30);
+  std::map<int, int> orig_map{{1, 10}, {2, 20}, {3, 30}};
+  auto orig_it = orig_map.begin();
+  for (auto it = my_map.Cbegin(); it != my_map.Cend(); ++it, ++orig_it) {
+    ASSERT_EQ(it->first, orig_it->first);
+    ASSERT_EQ(it->second, orig_it->second);
+  }
+}
+
+TEST(cow_map, threads_test) {
+  s21::CowMap<int, int> my_map;
+  for (int i = 0; i < 1000; ++i) my_map.Insert((i * 7919) % 1000, i);
+  std::vector<std::thread> stages;
+  std::atomic<int> bad{0};
+  for (int t = 0; t < 4; ++t) {
+    // Every stage gets the map by value; odd stages change their copy
+    stages.emplace_back([copy = my_map, t, &bad]() mutable {
+      for (int round = 0; round < 20; ++round) {
+        s21::CowMap<int, int> local = copy;
+        if (t % 2) local.InsertOrAssign(round, -t);
+        for (int key = 0; key < 1000; key += 37) {
+          int expected = (t % 2 && key == round) ? -t : copy.At(key);
+          if (local.At(key) != expected) ++bad;
+        }
+      }
+    });
+  }
+  for (std::thread& stage : stages) stage.join();
+  ASSERT_EQ(bad, 0);
+  ASSERT_EQ(my_map.UseCount(), 1U);
+  ASSERT_EQ(my_map.Size(), 1000U);
+  ASSERT_EQ(my_map.At(0), 0);
+}
+
+// COW VECTOR-------------------------------------------------------------------
+
+TEST(cow_vector, share_test) {
+  s21::CowVector<int> my_vector{1, 2, 3};
+  s21::CowVector<int> copy = my_vector;
+  const s21::CowVector<int>& reader = copy;
+  ASSERT_EQ(my_vector.UseCount(), 2U);
+  ASSERT_EQ(reader.Data(), static_cast<const s21::CowVector<int>&>(my_vector)
+                               .Data());
+  ASSERT_EQ(reader[1], 2);
+  ASSERT_EQ(reader.At(2), 3);
+  ASSERT_EQ(reader.Front(), 1);
+  ASSERT_EQ(reader.Back(), 3);
+  ASSERT_EQ(reader.Size(), 3U);
+  ASSERT_EQ(copy.At(0), 1);
+  ASSERT_EQ(*++copy.Begin(), 2);
+  ASSERT_EQ(copy.Data(), my_vector.Data());
+  ASSERT_EQ(my_vector.UseCount(), 2U);
+  copy.PushBack(4);
+  copy[0] = 10;
+  ASSERT_EQ(my_vector.UseCount(), 1U);
+  std::vector<int> orig_vector{1, 2, 3};
+  std::vector<int> orig_copy{10, 2, 3, 4};
+  ASSERT_EQ(my_vector.Size(), orig_vector.size());
+  ASSERT_EQ(copy.Size(), orig_copy.size());
+  for (size_t i = 0; i < orig_vector.size(); ++i) {
+    ASSERT_EQ(my_vector[i], orig_vector[i]);
+  }
+  for (size_t i = 0; i < orig_copy.size(); ++i) {
+    ASSERT_EQ(copy[i], orig_copy[i]);
+  }
+}
+
+TEST(cow_vector, random_copies_test) {
+  std::vector<s21::CowVector<int>> copies(1);
+  std::vector<std::vector<int>> orig_copies(1);
+  std::mt19937 rng(46);
+  for (int i = 0; i < 2000; ++i) {
+    size_t pick = rng() % copies.size();
+    switch (rng() % 5) {
+      case 0:
+        copies.push_back(copies[pick]);
+        orig_copies.push_back(orig_copies[pick]);
+        break;
+      case 1:
+        if (!orig_copies[pick].empty()) {
+          copies[pick].PopBack();
+          orig_copies[pick].pop_back();
+        }
+        break;
+      case 2:
+        if (!orig_copies[pick].empty()) {
+          size_t pos = rng() % orig_copies[pick].size();
+          copies[pick][pos] = i;
+          orig_copies[pick][pos] = i;
+        }
+        break;
+      default:
+        copies[pick].PushBack(i);
+        orig_copies[pick].push_back(i);
+    }
+  }
+  for (size_t c = 0; c < copies.size(); ++c) {
+    const s21::CowVector<int>& copy = copies[c];
+    ASSERT_EQ(copy.Size(), orig_copies[c].size());
+    for (size_t i = 0; i < copy.Size(); ++i) {
+      ASSERT_EQ(copy[i], orig_copies[c][i]);
+    }
+  }
+}
+
+TEST(cow_vector, modifiers_test) {
+  s21::CowVector<std::string> my_vector{"a", "b", "c"};
+  s21::CowVector<std::string> copy = my_vector;
+  copy.Insert(copy.Begin(), "z");
+  copy.Erase(++copy.Begin());
+  copy.EmplaceBack(2, 'd');
+  std::vector<std::string> orig_copy{"z", "b", "c", "dd"};
+  ASSERT_EQ(copy.Size(), orig_copy.size());
+  size_t i = 0;
+  for (auto it = copy.Cbegin(); it != copy.Cend(); ++it, ++i) {
+    ASSERT_EQ(*it, orig_copy[i]);
+  }
+  ASSERT_EQ(my_vector.Size(), 3U);
+  ASSERT_EQ(my_vector.Get()[0], "a");
+  s21::CowVector<std::string> shared = my_vector;
+  shared.Mutate().PopBack();
+  ASSERT_EQ(shared.Size(), 2U);
+  ASSERT_EQ(my_vector.Size(), 3U);
+  s21::CowVector<std::string> other = copy;
+  other.Clear();
+  ASSERT_TRUE(other.Empty());
+  ASSERT_EQ(other.UseCount(), 0U);
+  ASSERT_EQ(copy.UseCount(), 1U);
+  other.Reserve(10);
+  ASSERT_EQ(other.Capacity(), 10U);
+  other.Swap(copy);
+  ASSERT_EQ(other.Size(), 4U);
+  ASSERT_TRUE(copy.Empty());
+  s21::CowVector<std::string> shared_copy = shared;
+  auto pos = ++shared.Cbegin();
+  shared[0] = "first";
+  ASSERT_EQ(*pos, "b");
+  shared.Erase(pos);
+  ASSERT_EQ(shared.Size(), 1U);
+  ASSERT_EQ(shared.Front(), "first");
+  shared = shared_copy;
+  pos = shared.Insert(shared.End(), "c");
+  ASSERT_EQ(*pos, "c");
+  ASSERT_EQ(shared.Size(), 3U);
+  ASSERT_EQ(shared_copy.Size(), 2U);
+  ASSERT_EQ(shared_copy[1], "b");
+  s21::CowVector<std::string> adopted(s21::Vector<std::string>{"x", "y"});
+  ASSERT_EQ(adopted.At(1), "y");
+}
+
+// DEQUE------------------------------------------------------------------------
+
+template <typename ValueType>
+bool compare_deques(const s21::Deque<ValueType>& my_deque,
+                    const std::deque<ValueType>& orig_deque) {
+  bool result = my_deque.Size() == orig_deque.size();
+  for (size_t i = 0; result && i < orig_deque.size(); ++i) {
+    result = my_deque[i] == orig_deque[i];
+  }
+  return result;
+}
+
+TEST(deque, default_constructor_test) {
+  s21::Deque<int> my_deque;
+  std::deque<int> orig_deque;
+  ASSERT_EQ(my_deque.Size(), orig_deque.size());
+  ASSERT_EQ(my_deque.Empty(), orig_deque.empty());
+  ASSERT_TRUE(my_deque.Begin() == my_deque.End());
+}
+
+TEST(deque, size_constructor_test) {
+  s21::Deque<int> my_deque(700);
+  std::deque<int> orig_deque(700);
+  ASSERT_TRUE(compare_deques(my_deque, orig_deque));
+}
+
+TEST(deque, initializer_list_constructor_test) {
+  s21::Deque<int> my_deque{1, 2, 3, 4, 5};
+  std::deque<int> orig_deque{1, 2, 3, 4, 5};
+  ASSERT_TRUE(compare_deques(my_deque, orig_deque));
+  ASSERT_EQ(my_deque.Front(), orig_deque.front());
+  ASSERT_EQ(my_deque.Back(), orig_deque.back());
+}
+
+TEST(deque, copy_constructor_test) {
+  s21::Deque<std::string> my_deque{"one", "two", "three"};
+  s21::Deque<std::string> my_copy(my_deque);
+  std::deque<std::string> orig_deque{"one", "two", "three"};
+  ASSERT_TRUE(compare_deques(my_copy, orig_deque));
+  ASSERT_TRUE(compare_deques(my_deque, orig_deque));
+}
+
+TEST(deque, move_constructor_test) {
+  s21::Deque<int> my_deque{7, 8, 9};
+  s21::Deque<int> my_move(std::move(my_deque));
+  std::deque<int> orig_deque{7, 8, 9};
+  ASSERT_TRUE(compare_deques(my_move, orig_deque));
+  ASSERT_TRUE(my_deque.Empty());
+}
+
+TEST(deque, move_operator_test) {
+  s21::Deque<int> my_deque{7, 8, 9};
+  s21::Deque<int> my_move{1};
+  my_move = std::move(my_deque);
+  std::deque<int> orig_deque{7, 8, 9};
+  ASSERT_TRUE(compare_deques(my_move, orig_deque));
+  ASSERT_TRUE(my_deque.Empty());
+}
+
+TEST(deque, push_pop_both_ends_test) {
+  s21::Deque<int> my_deque;
+  std::deque<int> orig_deque;
+  for (int i = 0; i < 5000; ++i) {
+    if (i % 3) {
+      my_deque.PushBack(i);
+      orig_deque.push_back(i);
+    } else {
+      my_deque.PushFront(i);
+      orig_deque.push_front(i);
+    }
+  }
+  ASSERT_TRUE(compare_deques(my_deque, orig_deque));
+  for (int i = 0; i < 2000; ++i) {
+    if (i % 2) {
+      my_deque.PopBack();
+      orig_deque.pop_back();
+    } else {
+      my_deque.PopFront();
+      orig_deque.pop_front();
+    }
+  }
+  ASSERT_TRUE(compare_deques(my_deque, orig_deque));
+}
+
+TEST(deque, queue_usage_test) {
+  s21::Deque<int> my_deque;
+  std::deque<int> orig_deque;
+  for (int i = 0; i < 100000; ++i) {
+    my_deque.PushBack(i);
+    orig_deque.push_back(i);
+    if (my_deque.Size() > 100) {
+      my_deque.PopFront();
+      orig_deque.pop_front();
+    }
+  }
+  ASSERT_TRUE(compare_deques(my_deque, orig_deque));
+}
+
+TEST(deque, stable_reference_test) {
+  s21::Deque<int> my_deque{42};
+  const int& first = my_deque.Front();
+  for (int i = 0; i < 10000; ++i) {
+    my_deque.PushBack(i);
+    my_deque.PushFront(-i);
+  }
+  ASSERT_EQ(first, 42);
+  ASSERT_EQ(&first, &my_deque[10000]);
+}
+
+TEST(deque, random_access_iterator_test) {
+  s21::Deque<int> my_deque;
+  std::deque<int> orig_deque;
+  for (int i = 0; i < 1000; ++i) {
+    my_deque.PushFront((i * 7919) % 1000);
+    orig_deque.push_front((i * 7919) % 1000);
+  }
+  std::sort(my_deque.Begin(), my_deque.End());
+  std::sort(orig_deque.begin(), orig_deque.end());
+  ASSERT_TRUE(compare_deques(my_deque, orig_deque));
+  auto it = my_deque.Begin();
+  ASSERT_EQ(my_deque.End() - it, 1000);
+  ASSERT_EQ(it[500], orig_deque[500]);
+  it += 10;
+  ASSERT_EQ(*it, orig_deque[10]);
+  ASSERT_TRUE(my_deque.Begin() < it);
+}
+
+TEST(deque, emplace_test) {
+  s21::Deque<std::pair<int, char>> my_deque;
+  my_deque.EmplaceBack(1, 'b');
+  my_deque.EmplaceFront(0, 'a');
+  ASSERT_EQ(my_deque.Front().second, 'a');
+  ASSERT_EQ(my_deque.Back().first, 1);
+}
+
+TEST(deque, shrink_to_fit_test) {
+  s21::Deque<int> my_deque;
+  for (int i = 0; i < 3000; ++i) my_deque.PushBack(i);
+  for (int i = 0; i < 2990; ++i) my_deque.PopFront();
+  my_deque.ShrinkToFit();
+  ASSERT_EQ(my_deque.Size(), 10U);
+  ASSERT_EQ(my_deque.Front(), 2990);
+  my_deque.PushFront(1);
+  ASSERT_EQ(my_deque.Front(), 1);
+  my_deque.Clear();
+  my_deque.ShrinkToFit();
+  ASSERT_TRUE(my_deque.Empty());
+  my_deque.PushBack(5);
+  ASSERT_EQ(my_deque.Back(), 5);
+}
+
+TEST(deque, queue_adaptor_test) {
+  s21::Queue<int, s21::Deque<int>> my_queue{1, 2, 3};
+  std::queue<int> orig_queue({1, 2, 3});
+  my_queue.Push(4);
+  orig_queue.push(4);
+  while (!orig_queue.empty()) {
+    ASSERT_EQ(my_queue.Front(), orig_queue.front());
+    ASSERT_EQ(my_queue.Back(), orig_queue.back());
+    my_queue.Pop();
+    orig_queue.pop();
+  }
+  ASSERT_TRUE(my_queue.Empty());
+}
+
+TEST(deque, stack_adaptor_test) {
+  s21::Stack<int, s21::Deque<int>> my_stack{1, 2, 3};
+  std::stack<int> orig_stack({1, 2, 3});
+  my_stack.Push(4);
+  orig_stack.push(4);
+  while (!orig_stack.empty()) {
+    ASSERT_EQ(my_stack.Top(), orig_stack.top());
+    my_stack.Pop();
+    orig_stack.pop();
+  }
+  ASSERT_TRUE(my_stack.Empty());
+}
+
+// EPOCH------------------------------------------------------------------------
+
+struct EpochItem {
+  std::atomic<int>* deleted;
+  ~EpochItem() { ++*deleted; }
+};
+
+TEST(epoch, retire_test) {
+  std::atomic<int> deleted{0};
+  {
+    s21::Epoch epoch;
+    {
+      s21::Epoch::Guard guard = epoch.Pin();
+      epoch.Retire(new EpochItem{&deleted});
+      ASSERT_EQ(epoch.Pending(), 1U);
+      // The guard keeps this thread in the epoch the item was retired in
+      for (int i = 0; i < 5; ++i) epoch.Collect();
+      ASSERT_EQ(deleted, 0);
+    }
+    for (int i = 0; i < 3; ++i) epoch.Collect();
+    ASSERT_EQ(deleted, 1);
+    ASSERT_EQ(epoch.Pending(), 0U);
+    epoch.Retire(new EpochItem{&deleted});
+  }
+  ASSERT_EQ(deleted, 2);
+}
+
+TEST(epoch, nested_guard_test) {
+  std::atomic<int> deleted{0};
+  s21::Epoch epoch;
+  s21::Epoch::Guard outer(epoch);
+  {
+    s21::Epoch::Guard inner(epoch);
+    s21::Epoch::Guard copy = inner;
+    epoch.Retire(new EpochItem{&deleted});
+  }
+  for (int i = 0; i < 5; ++i) epoch.Collect();
+  ASSERT_EQ(deleted, 0);
+  outer = s21::Epoch::Guard();
+  for (int i = 0; i < 3; ++i) epoch.Collect();
+  ASSERT_EQ(deleted, 1);
+}
+
+TEST(epoch, pinned_thread_test) {
+  std::atomic<int> deleted{0};
+  s21::Epoch epoch;
+  std::atomic<int> stage{0};
+  std::thread reader([&epoch, &stage] {
+    s21::Epoch::Guard guard(epoch);
+    stage = 1;
+    while (stage != 2) std::this_thread::yield();
+  });
+  while (stage != 1) std::this_thread::yield();
+  epoch.Retire(new EpochItem{&deleted});
+  for (int i = 0; i < 5; ++i) epoch.Collect();
+  ASSERT_EQ(deleted, 0);
+  stage = 2;
+  reader.join();
+  for (int i = 0; i < 3; ++i) epoch.Collect();
+  ASSERT_EQ(deleted, 1);
+}
+
+TEST(epoch, short_lived_test) {
+  std::atomic<int> deleted{0};
+  s21::Epoch outer;
+  outer.Retire(new EpochItem{&deleted});
+  for (int i = 0; i < 1000; ++i) {
+    s21::Epoch epoch;
+    s21::Epoch::Guard guard(epoch);
+    s21::Epoch::Guard outer_guard(outer);
+    epoch.Retire(new EpochItem{&deleted});
+  }
+  ASSERT_EQ(deleted, 1000);
+  ASSERT_EQ(outer.Pending(), 1U);
+  for (int i = 0; i < 3; ++i) outer.Collect();
+  ASSERT_EQ(deleted, 1001);
+}
+
+TEST(epoch, concurrent_swap_test) {
+  s21::Epoch epoch;
+  std::atomic<s21::MapNode<int, int>*> shared{
+      new s21::MapNode<int, int>(0, 0)};
+  std::atomic<int> bad_reads{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([&epoch, &shared, &bad_reads, t] {
+      for (int i = 0; i < 5000; ++i) {
+        s21::Epoch::Guard guard(epoch);
+        s21::MapNode<int, int>* node = shared.load();
+        if (node->node_pair.second != node->node_pair.first * 2) ++bad_reads;
+        if (i % 4 == t % 4) {
+          auto* fresh = new s21::MapNode<int, int>(i, i * 2);
+          epoch.Retire(shared.exchange(fresh));
+          epoch.Retire(new s21::SetNode<int>(i));
+        }
+      }
+    });
+  }
+  for (std::thread& thread : threads) thread.join();
+  ASSERT_EQ(bad_reads, 0);
+  ASSERT_GT(epoch.Current(), 0U);
+  delete shared.load();
+}
+
+// FILTERED MAP-----------------------------------------------------------------
+
+TEST(filtered_map, lookup_test) {
+  s21::FilteredMap<int, std::string> my_map{{1, "one"}, {2, "two"}};
+  const s21::FilteredMap<int, std::string>& reader = my_map;
+  ASSERT_EQ(reader.At(1), "one");
+  ASSERT_EQ(reader.Find(2)->second, "two");
+  ASSERT_TRUE(reader.Find(3) == reader.Cend());
+  ASSERT_TRUE(my_map.Find(3) == my_map.End());
+  ASSERT_FALSE(reader.Contains(3));
+  my_map[3] = "three";
+  my_map.InsertOrAssign(1, "uno");
+  my_map.InsertOrAssign(4, "four");
+  ASSERT_FALSE(my_map.Insert(2, "dos").second);
+  ASSERT_EQ(my_map.At(1), "uno");
+  ASSERT_EQ(my_map.At(2), "two");
+  ASSERT_EQ(my_map.At(3), "three");
+  ASSERT_EQ(my_map.Get().At(4), "four");
+  s21::FilterStats stats = my_map.Stats();
+  ASSERT_EQ(stats.hits + stats.misses + stats.false_positives, 9U);
+  ASSERT_EQ(stats.hits, 5U);
+  my_map.ResetStats();
+  ASSERT_EQ(my_map.Stats().hits, 0U);
+}
+
+TEST(filtered_map, subscript_test) {
+  s21::FilteredMap<int, int> my_map{{50, 5}, {20, 2}, {80, 8}, {10, 1},
+                                    {30, 3}};
+  ASSERT_EQ(my_map[30], 3);
+  my_map[80] = 7;
+  ASSERT_EQ(my_map[0], 0);
+  ASSERT_EQ(my_map.Size(), 6U);
+  ASSERT_EQ(my_map.At(50), 5);
+  ASSERT_EQ(my_map.At(80), 7);
+  ASSERT_EQ(my_map.At(30), 3);
+}
+
+TEST(filtered_map, modifiers_test) {
+  s21::FilteredMap<int, int> my_map(s21::FilterOptions{4, 0.5});
+  std::map<int, int> orig_map;
+  std::mt19937 gen(7);
+  for (int i = 0; i < 3000; ++i) {
+    int key = gen() % 1000;
+    if (gen() % 3) {
+      ASSERT_EQ(my_map.Insert(key, i).second, orig_map.emplace(key, i).second);
+    } else {
+      ASSERT_EQ(my_map.Erase(key), orig_map.erase(key) == 1);
+    }
+  }
+  ASSERT_GT(my_map.Stats().rebuilds, 0U);
+  ASSERT_EQ(my_map.Size(), orig_map.size());
+  for (int key = 0; key < 1000; ++key) {
+    ASSERT_EQ(my_map.Contains(key), orig_map.count(key) == 1);
+  }
+  auto orig_it = orig_map.begin();
+  for (auto it = my_map.Cbegin(); it != my_map.Cend(); ++it, ++orig_it) {
+    ASSERT_EQ(it->first, orig_it->first);
+    ASSERT_EQ(it->second, orig_it->second);
+  }
+  s21::FilteredMap<int, int> other;
+  other.Swap(my_map);
+  ASSERT_TRUE(my_map.Empty());
+  ASSERT_EQ(other.Size(), orig_map.size());
+  other.Erase(other.Begin());
+  ASSERT_FALSE(other.Contains(orig_map.begin()->first));
+  other.Clear();
+  ASSERT_TRUE(other.Empty());
+  ASSERT_FALSE(other.Contains(orig_map.rbegin()->first));
+}
+
+// FILTERED MULTISET------------------------------------------------------------
+
+TEST(filtered_multiset, lookup_test) {
+  s21::FilteredMultiset<int> my_multiset{5, 1, 5, 3, 5};
+  ASSERT_EQ(my_multiset.Size(), 5U);
+  ASSERT_EQ(my_multiset.Count(5), 3U);
+  ASSERT_EQ(my_multiset.Count(2), 0U);
+  ASSERT_TRUE(my_multiset.Contains(3));
+  ASSERT_EQ(*my_multiset.Find(1), 1);
+  ASSERT_FALSE(my_multiset.Find(4) != my_multiset.End());
+  ASSERT_TRUE(my_multiset.Erase(5));
+  ASSERT_FALSE(my_multiset.Erase(4));
+  ASSERT_EQ(my_multiset.Get().Count(5), 2U);
+  my_multiset.Erase(my_multiset.Find(3));
+  ASSERT_FALSE(my_multiset.Contains(3));
+  std::multiset<int> orig_multiset{1, 5, 5};
+  auto orig_it = orig_multiset.begin();
+  for (auto it = my_multiset.Begin(); it != my_multiset.End();
+       ++it, ++orig_it) {
+    ASSERT_EQ(*it, *orig_it);
+  }
+  s21::FilterStats stats = my_multiset.Stats();
+  ASSERT_EQ(stats.hits, 5U);
+  ASSERT_EQ(stats.hits + stats.misses + stats.false_positives, 9U);
+}
+
+TEST(filtered_multiset, rebuild_test) {
+  s21::FilteredMultiset<int> my_multiset;
+  for (int i = 0; i < 500; ++i) {
+    my_multiset.Insert(i % 100);
+  }
+  size_t rebuilds = my_multiset.Stats().rebuilds;
+  ASSERT_GT(rebuilds, 0U);
+  for (int i = 0; i < 400; ++i) ASSERT_TRUE(my_multiset.Erase(i % 100));
+  ASSERT_GT(my_multiset.Stats().rebuilds, rebuilds);
+  for (int i = 0; i < 100; ++i) ASSERT_EQ(my_multiset.Count(i), 1U);
+  s21::FilteredMultiset<int> other;
+  other.Swap(my_multiset);
+  ASSERT_TRUE(my_multiset.Empty());
+  other.Clear();
+  ASSERT_FALSE(other.Contains(0));
+}
+
+// FILTERED SET-----------------------------------------------------------------
+
+TEST(filtered_set, lookup_test) {
+  s21::FilteredSet<int> my_set;
+  for (int i = 0; i < 2000; i += 2) my_set.Insert((i * 7919) % 2000);
+  const s21::FilteredSet<int>& reader = my_set;
+  for (int i = 0; i < 2000; ++i) {
+    ASSERT_EQ(reader.Contains(i), i % 2 == 0);
+    ASSERT_EQ(reader.Find(i) != reader.Cend(), i % 2 == 0);
+  }
+  s21::FilterStats stats = reader.Stats();
+  ASSERT_EQ(stats.hits, 2000U);
+  ASSERT_EQ(stats.misses + stats.false_positives, 2000U);
+  ASSERT_LT(stats.false_positives, 100U);
+  ASSERT_GT(stats.rebuilds, 0U);
+}
+
+TEST(filtered_set, modifiers_test) {
+  s21::FilteredSet<std::string> my_set({"b", "a", "c"},
+                                       s21::FilterOptions{8, 0.1});
+  ASSERT_FALSE(my_set.Insert("a").second);
+  ASSERT_TRUE(my_set.Erase("b"));
+  ASSERT_FALSE(my_set.Erase("d"));
+  ASSERT_FALSE(my_set.Contains("b"));
+  ASSERT_EQ(*my_set.Find("c"), "c");
+  s21::FilteredSet<std::string> copy = my_set;
+  copy.Erase(copy.Find("a"));
+  ASSERT_TRUE(my_set.Contains("a"));
+  ASSERT_FALSE(copy.Contains("a"));
+  ASSERT_EQ(my_set.Get().Size(), 2U);
+  copy.Swap(my_set);
+  ASSERT_EQ(my_set.Size(), 1U);
+  ASSERT_EQ(copy.Size(), 2U);
+  copy.Clear();
+  ASSERT_TRUE(copy.Empty());
+  ASSERT_FALSE(copy.Contains("c"));
+  copy.Insert("e");
+  ASSERT_TRUE(copy.Contains("e"));
+}
+
+// FROZEN MAP-------------------------------------------------------------------
+
+TEST(frozen_map, freeze_test) {
+  s21::Map<int, std::string> my_map{{5, "five"}, {1, "one"}, {3, "three"}};
+  s21::FrozenMap<int, std::string> frozen = my_map.Freeze();
+  my_map.InsertOrAssign(1, "uno");
+  std::map<int, std::string> orig_map{{5, "five"}, {1, "one"}, {3, "three"}};
+  ASSERT_EQ(frozen.Size(), orig_map.size());
+  auto orig_it = orig_map.begin();
+  for (auto it = frozen.Begin(); it != frozen.End(); ++it, ++orig_it) {
+    ASSERT_EQ(it->first, orig_it->first);
+    ASSERT_EQ(it->second, orig_it->second);
+  }
+  ASSERT_EQ(frozen.At(1), "one");
+  ASSERT_EQ(frozen.Find(3)->second, "three");
+  ASSERT_EQ(frozen.Find(4), frozen.End());
+  ASSERT_EQ(frozen.LowerBound(4)->first, 5);
+  ASSERT_EQ(frozen.LowerBound(6), frozen.End());
+  ASSERT_FALSE(frozen.Contains(2));
+}
+
+TEST(frozen_map, initializer_list_test) {
+  s21::FrozenMap<int, int> frozen{{2, 20}, {1, 10}, {2, 21}, {3, 30}};
+  ASSERT_EQ(frozen.Size(), 3U);
+  ASSERT_EQ(frozen.At(2), 20);
+  ASSERT_EQ(frozen.Begin()->first, 1);
+  s21::FrozenMap<int, int> empty{};
+  ASSERT_TRUE(empty.Empty());
+  ASSERT_EQ(empty.Begin(), empty.End());
+  ASSERT_EQ(empty.LowerBound(1), empty.End());
+  ASSERT_FALSE(empty.Contains(1));
+}
+
+// FROZEN SET-------------------------------------------------------------------
+
+TEST(frozen_set, lookup_test) {
+  // Every size up to 70 covers full, partial and one-node bottom levels
+  std::mt19937 rng(47);
+  for (int size = 0; size <= 70; ++size) {
+    s21::Set<int> my_set;
+    std::set<int> orig_set;
+    while (static_cast<int>(orig_set.size()) < size) {
+      int value = rng() % 200 * 2;
+      my_set.Insert(value);
+      orig_set.insert(value);
+    }
+    s21::FrozenSet<int> frozen = my_set.Freeze();
+    ASSERT_EQ(frozen.Size(), orig_set.size());
+    ASSERT_TRUE(std::equal(frozen.Begin(), frozen.End(), orig_set.begin(),
+                           orig_set.end()));
+    for (int value = -1; value <= 401; ++value) {
+      auto orig_it = orig_set.lower_bound(value);
+      auto it = frozen.LowerBound(value);
+      if (orig_it == orig_set.end()) {
+        ASSERT_EQ(it, frozen.End());
+      } else {
+        ASSERT_EQ(*it, *orig_it);
+      }
+      ASSERT_EQ(frozen.Contains(value), orig_set.count(value) == 1);
+      ASSERT_EQ(frozen.Find(value) != frozen.End(), frozen.Contains(value));
+    }
+  }
+}
+
+TEST(frozen_set, large_test) {
+  s21::Set<int> my_set;
+  std::set<int> orig_set;
+  std::mt19937 rng(470);
+  for (int i = 0; i < 100000; ++i) {
+    int value = rng() % 1000000;
+    my_set.Insert(value);
+    orig_set.insert(value);
+  }
+  s21::FrozenSet<int> frozen = my_set.Freeze();
+  ASSERT_TRUE(std::equal(frozen.Begin(), frozen.End(), orig_set.begin(),
+                         orig_set.end()));
+  for (int i = 0; i < 100000; ++i) {
+    int value = rng() % 1000001;
+    auto orig_it = orig_set.lower_bound(value);
+    auto it = frozen.LowerBound(value);
+    ASSERT_EQ(it == frozen.End(), orig_it == orig_set.end());
+    if (orig_it != orig_set.end()) {
+      ASSERT_EQ(*it, *orig_it);
+    }
+  }
+}
+
+TEST(frozen_set, initializer_list_test) {
+  s21::FrozenSet<std::string> frozen{"pear", "apple", "fig", "apple"};
+  std::set<std::string> orig_set{"pear", "apple", "fig", "apple"};
+  ASSERT_EQ(frozen.Size(), 3U);
+  ASSERT_TRUE(std::equal(frozen.Cbegin(), frozen.Cend(), orig_set.begin(),
+                         orig_set.end()));
+  ASSERT_EQ(*frozen.LowerBound("b"), "fig");
+  s21::FrozenSet<std::string> copy(frozen);
+  ASSERT_TRUE(copy.Contains("pear"));
+}
+
+TEST(frozen_set, batch_test) {
+  s21::FrozenSet<int> empty;
+  int probe = 1;
+  bool found = true;
+  empty.ContainsBatch(&probe, 1, &found);
+  ASSERT_FALSE(found);
+  for (int size : {1, 2, 15, 16, 17, 1000}) {
+    s21::Set<int> my_set;
+    for (int value = 0; value < size; ++value) my_set.Insert(value * 3);
+    s21::FrozenSet<int> frozen = my_set.Freeze();
+    std::vector<int> keys;
+    for (int key = -2; key < size * 3 + 2; ++key) keys.push_back(key);
+    std::vector<s21::FrozenSet<int>::ConstIterator> its(keys.size());
+    std::vector<char> contains(keys.size());
+    frozen.FindBatch(keys.begin(), keys.size(), its.begin());
+    frozen.ContainsBatch(keys.begin(), keys.size(), contains.begin());
+    for (size_t i = 0; i < keys.size(); ++i) {
+      ASSERT_EQ(its[i], frozen.Find(keys[i]));
+      ASSERT_EQ(contains[i] != 0, frozen.Contains(keys[i]));
+    }
+  }
+}
+
+// FORWARD LIST-----------------------------------------------------------------
+
+TEST(forward_list, push_front_test) {
+  s21::ForwardList<int> my_list;
+  std::forward_list<int> orig_list;
+  for (int i = 0; i < 20; ++i) {
+    my_list.PushFront(i);
+    orig_list.push_front(i);
+  }
+  ASSERT_EQ(my_list.Size(), 20U);
+  ASSERT_EQ(my_list.Front(), orig_list.front());
+  ASSERT_TRUE(std::equal(orig_list.begin(), orig_list.end(), my_list.Begin()));
+  my_list.PopFront();
+  orig_list.pop_front();
+  ASSERT_EQ(my_list.Front(), orig_list.front());
+  ASSERT_EQ(my_list.Size(), 19U);
+}
+
+TEST(forward_list, insert_erase_after_test) {
+  s21::ForwardList<std::string> my_list{"a", "b", "c"};
+  std::forward_list<std::string> orig_list{"a", "b", "c"};
+  auto it = my_list.InsertAfter(my_list.Begin(), "x");
+  auto orig = orig_list.insert_after(orig_list.begin(), "x");
+  ASSERT_EQ(*it, *orig);
+  my_list.EmplaceAfter(my_list.BeforeBegin(), 2, 'z');
+  orig_list.emplace_after(orig_list.before_begin(), 2, 'z');
+  auto next = my_list.EraseAfter(it);
+  auto orig_next = orig_list.erase_after(orig);
+  ASSERT_EQ(*next, *orig_next);
+  ASSERT_EQ(my_list.Size(), 4U);
+  ASSERT_TRUE(std::equal(orig_list.begin(), orig_list.end(), my_list.Begin()));
+}
+
+TEST(forward_list, splice_after_test) {
+  s21::ForwardList<int> my_list{1, 2, 3};
+  s21::ForwardList<int> other{10, 20, 30};
+  std::forward_list<int> orig_list{1, 2, 3};
+  std::forward_list<int> orig_other{10, 20, 30};
+  my_list.SpliceAfter(my_list.Begin(), other, other.Begin());
+  orig_list.splice_after(orig_list.begin(), orig_other, orig_other.begin());
+  ASSERT_EQ(other.Size(), 2U);
+  my_list.SpliceAfter(my_list.BeforeBegin(), other);
+  orig_list.splice_after(orig_list.before_begin(), orig_other);
+  ASSERT_TRUE(other.Empty());
+  ASSERT_EQ(my_list.Size(), 6U);
+  ASSERT_TRUE(std::equal(orig_list.begin(), orig_list.end(), my_list.Begin()));
+}
+
+TEST(forward_list, sort_merge_test) {
+  s21::ForwardList<int> my_list;
+  std::forward_list<int> orig_list;
+  for (int i = 0; i < 1000; ++i) {
+    my_list.PushFront((i * 7919) % 301);
+    orig_list.push_front((i * 7919) % 301);
+  }
+  my_list.Sort();
+  orig_list.sort();
+  ASSERT_TRUE(std::equal(orig_list.begin(), orig_list.end(), my_list.Begin()));
+  s21::ForwardList<int> other{-5, 0, 150, 500};
+  std::forward_list<int> orig_other{-5, 0, 150, 500};
+  my_list.Merge(other);
+  orig_list.merge(orig_other);
+  ASSERT_TRUE(other.Empty());
+  ASSERT_EQ(my_list.Size(), 1004U);
+  ASSERT_TRUE(std::equal(orig_list.begin(), orig_list.end(), my_list.Begin()));
+  my_list.Unique();
+  orig_list.unique();
+  ASSERT_EQ(my_list.Size(), 303U);
+  ASSERT_TRUE(std::equal(orig_list.begin(), orig_list.end(), my_list.Begin()));
+}
+
+TEST(forward_list, sort_stable_test) {
+  using Item = std::pair<int, int>;
+  struct ByKey {
+    Item item;
+    bool operator<(const ByKey& other) const {
+      return item.first < other.item.first;
+    }
+  };
+  s21::ForwardList<ByKey> my_list;
+  for (int i = 0; i < 100; ++i) my_list.PushFront({{i % 7, i}});
+  my_list.Sort();
+  auto prev = my_list.Begin();
+  for (auto it = std::next(prev); it != my_list.End(); ++prev, ++it) {
+    ASSERT_LE(prev->item.first, it->item.first);
+    if (prev->item.first == it->item.first) {
+      ASSERT_GT(prev->item.second, it->item.second);
+    }
+  }
+}
+
+TEST(forward_list, reverse_copy_test) {
+  s21::ForwardList<int> my_list{1, 2, 3, 4, 5};
+  my_list.Reverse();
+  std::forward_list<int> orig_list{5, 4, 3, 2, 1};
+  ASSERT_TRUE(std::equal(orig_list.begin(), orig_list.end(), my_list.Begin()));
+  s21::ForwardList<int> copy(my_list);
+  ASSERT_TRUE(std::equal(orig_list.begin(), orig_list.end(), copy.Begin()));
+  s21::ForwardList<int> moved(std::move(copy));
+  ASSERT_TRUE(copy.Empty());
+  ASSERT_EQ(moved.Size(), 5U);
+  copy = moved;
+  ASSERT_EQ(copy.Front(), 5);
+  moved.Clear();
+  ASSERT_EQ(moved.Begin(), moved.End());
+  s21::ForwardList<int> empty;
+  empty.Reverse();
+  empty.Sort();
+  ASSERT_TRUE(empty.Empty());
+}
+
+// INDEXED PRIORITY QUEUE-------------------------------------------------------
+
+TEST(indexed_priority_queue, push_pop_test) {
+  s21::IndexedPriorityQueue<int> my_queue;
+  std::priority_queue<int, std::vector<int>, std::greater<int>> orig_queue;
+  for (int i = 0; i < 500; ++i) {
+    int value = (i * 7919) % 1000;
+    my_queue.Push(value);
+    orig_queue.push(value);
+  }
+  ASSERT_EQ(my_queue.Size(), orig_queue.size());
+  while (!orig_queue.empty()) {
+    ASSERT_EQ(my_queue.Top(), orig_queue.top());
+    my_queue.Pop();
+    orig_queue.pop();
+  }
+  ASSERT_TRUE(my_queue.Empty());
+}
+
+TEST(indexed_priority_queue, update_erase_test) {
+  s21::IndexedPriorityQueue<int, std::less<int>, 2> my_queue;
+  std::multiset<int> orig_set;
+  std::vector<s21::IndexedPriorityQueue<int>::Handle> handles;
+  for (int i = 0; i < 300; ++i) {
+    handles.push_back(my_queue.Push(i * 10));
+    orig_set.insert(i * 10);
+  }
+  for (int i = 0; i < 300; i += 3) {
+    orig_set.erase(orig_set.find(my_queue.Get(handles[i])));
+    my_queue.DecreaseKey(handles[i], -i);
+    orig_set.insert(-i);
+  }
+  for (int i = 1; i < 300; i += 3) {
+    orig_set.erase(orig_set.find(my_queue.Get(handles[i])));
+    my_queue.IncreaseKey(handles[i], 5000 + i);
+    orig_set.insert(5000 + i);
+  }
+  for (int i = 2; i < 300; i += 6) {
+    orig_set.erase(orig_set.find(my_queue.Get(handles[i])));
+    my_queue.Update(handles[i], (i * 31) % 3000);
+    orig_set.insert((i * 31) % 3000);
+  }
+  for (int i = 5; i < 300; i += 6) {
+    orig_set.erase(orig_set.find(my_queue.Get(handles[i])));
+    my_queue.Erase(handles[i]);
+    ASSERT_FALSE(my_queue.Contains(handles[i]));
+  }
+  ASSERT_EQ(my_queue.Size(), orig_set.size());
+  ASSERT_EQ(my_queue.Get(my_queue.TopHandle()), *orig_set.begin());
+  for (int value : orig_set) {
+    ASSERT_EQ(my_queue.Top(), value);
+    my_queue.Pop();
+  }
+  ASSERT_TRUE(my_queue.Empty());
+}
+
+TEST(indexed_priority_queue, handle_reuse_test) {
+  s21::IndexedPriorityQueue<std::string> my_queue;
+  auto first = my_queue.Push("b");
+  auto second = my_queue.Push("a");
+  ASSERT_EQ(my_queue.TopHandle(), second);
+  my_queue.Pop();
+  ASSERT_FALSE(my_queue.Contains(second));
+  auto third = my_queue.Push("c");
+  ASSERT_EQ(third, second);
+  ASSERT_EQ(my_queue.Get(third), "c");
+  ASSERT_EQ(my_queue.Get(first), "b");
+  my_queue.Clear();
+  ASSERT_TRUE(my_queue.Empty());
+  ASSERT_FALSE(my_queue.Contains(first));
+}
+
+// INTRUSIVE LIST---------------------------------------------------------------
+
+struct IntrusiveItem {
+  int value = 0;
+  s21::IntrusiveListHook list_hook;
+  s21::IntrusiveListHook other_hook;
+  s21::IntrusiveSetHook set_hook;
+
+  bool operator<(const IntrusiveItem& other) const {
+    return value < other.value;
+  }
+};
+
+using ItemList = s21::IntrusiveList<IntrusiveItem, &IntrusiveItem::list_hook>;
+using OtherList =
+    s21::IntrusiveList<IntrusiveItem, &IntrusiveItem::other_hook>;
+using ItemSet = s21::IntrusiveSet<IntrusiveItem, &IntrusiveItem::set_hook,
+                                  std::less<>>;
+
+bool operator<(const IntrusiveItem& item, int value) {
+  return item.value < value;
+}
+
+bool operator<(int value, const IntrusiveItem& item) {
+  return value < item.value;
+}
+
+TEST(intrusive_list, push_pop_test) {
+  std::vector<IntrusiveItem> items(10);
+  ItemList my_list;
+  std::list<int> orig_list;
+  for (int i = 0; i < 10; ++i) {
+    items[i].value = i;
+    if (i % 2) {
+      my_list.PushBack(items[i]);
+      orig_list.push_back(i);
+    } else {
+      my_list.PushFront(items[i]);
+      orig_list.push_front(i);
+    }
+  }
+  ASSERT_EQ(my_list.Size(), orig_list.size());
+  ASSERT_EQ(my_list.Front().value, orig_list.front());
+  ASSERT_EQ(my_list.Back().value, orig_list.back());
+  auto orig = orig_list.begin();
+  for (auto it = my_list.Begin(); it != my_list.End(); ++it, ++orig) {
+    ASSERT_EQ(it->value, *orig);
+  }
+  auto rorig = orig_list.rbegin();
+  for (auto it = my_list.End(); it != my_list.Begin(); ++rorig) {
+    ASSERT_EQ((--it)->value, *rorig);
+  }
+  my_list.PopFront();
+  my_list.PopBack();
+  orig_list.pop_front();
+  orig_list.pop_back();
+  ASSERT_EQ(my_list.Front().value, orig_list.front());
+  ASSERT_EQ(my_list.Back().value, orig_list.back());
+  ASSERT_FALSE(items[8].list_hook.Linked());
+  ASSERT_FALSE(items[9].list_hook.Linked());
+  my_list.Clear();
+  ASSERT_TRUE(my_list.Empty());
+  ASSERT_FALSE(items[0].list_hook.Linked());
+}
+
+TEST(intrusive_list, erase_object_test) {
+  std::vector<IntrusiveItem> items(6);
+  ItemList my_list;
+  for (int i = 0; i < 6; ++i) {
+    items[i].value = i;
+    my_list.PushBack(items[i]);
+  }
+  my_list.Erase(items[3]);
+  my_list.Erase(items[0]);
+  auto next = my_list.Erase(ItemList::IteratorTo(items[4]));
+  ASSERT_EQ(next->value, 5);
+  my_list.Insert(next, items[0]);
+  std::vector<int> result;
+  for (auto it = my_list.Cbegin(); it != my_list.Cend(); ++it) {
+    result.push_back(it->value);
+  }
+  ASSERT_EQ(result, (std::vector<int>{1, 2, 0, 5}));
+  ASSERT_FALSE(items[3].list_hook.Linked());
+  ASSERT_TRUE(items[0].list_hook.Linked());
+}
+
+TEST(intrusive_list, two_hooks_test) {
+  std::vector<IntrusiveItem> items(8);
+  ItemList all;
+  OtherList odd;
+  for (int i = 0; i < 8; ++i) {
+    items[i].value = i;
+    all.PushBack(items[i]);
+    if (i % 2) odd.PushFront(items[i]);
+  }
+  all.Erase(items[3]);
+  ASSERT_EQ(all.Size(), 7U);
+  ASSERT_EQ(odd.Size(), 4U);
+  std::vector<int> result;
+  for (auto it = odd.Begin(); it != odd.End(); ++it) {
+    result.push_back(it->value);
+  }
+  ASSERT_EQ(result, (std::vector<int>{7, 5, 3, 1}));
+  // A copy is not linked anywhere
+  IntrusiveItem copy = items[5];
+  ASSERT_FALSE(copy.list_hook.Linked());
+  ASSERT_FALSE(copy.other_hook.Linked());
+}
+
+TEST(intrusive_list, splice_swap_test) {
+  std::vector<IntrusiveItem> items(6);
+  ItemList first;
+  ItemList second;
+  for (int i = 0; i < 6; ++i) {
+    items[i].value = i;
+    (i < 3 ? first : second).PushBack(items[i]);
+  }
+  first.Splice(++first.Begin(), second);
+  ASSERT_TRUE(second.Empty());
+  ASSERT_EQ(first.Size(), 6U);
+  std::vector<int> result;
+  for (auto it = first.Begin(); it != first.End(); ++it) {
+    result.push_back(it->value);
+  }
+  ASSERT_EQ(result, (std::vector<int>{0, 3, 4, 5, 1, 2}));
+  first.Swap(second);
+  ASSERT_TRUE(first.Empty());
+  ASSERT_EQ(first.Begin(), first.End());
+  ASSERT_EQ(second.Back().value, 2);
+  ItemList moved(std::move(second));
+  ASSERT_TRUE(second.Empty());
+  ASSERT_EQ(moved.Size(), 6U);
+  ASSERT_EQ(moved.Front().value, 0);
+  ASSERT_EQ((--moved.End())->value, 2);
+}
+
+// INTRUSIVE SET----------------------------------------------------------------
+
+TEST(intrusive_set, insert_find_test) {
+  std::vector<IntrusiveItem> items(8);
+  ItemSet my_set;
+  int values[] = {5, 3, 8, 1, 4, 7, 9, 3};
+  for (int i = 0; i < 8; ++i) {
+    items[i].value = values[i];
+    auto result = my_set.Insert(items[i]);
+    ASSERT_EQ(result.second, i != 7);
+    ASSERT_EQ(result.first->value, values[i]);
+  }
+  ASSERT_EQ(my_set.Size(), 7U);
+  ASSERT_FALSE(items[7].set_hook.Linked());
+  ASSERT_TRUE(my_set.Contains(4));
+  ASSERT_FALSE(my_set.Contains(6));
+  ASSERT_EQ(my_set.Find(6), my_set.End());
+  ASSERT_EQ(my_set.LowerBound(6)->value, 7);
+  ASSERT_EQ(my_set.UpperBound(7)->value, 8);
+  ASSERT_EQ(my_set.LowerBound(10), my_set.End());
+  ASSERT_EQ(my_set.Begin()->value, 1);
+  ASSERT_EQ((--my_set.End())->value, 9);
+  my_set.Erase(items[0]);
+  ASSERT_FALSE(my_set.Contains(5));
+  ASSERT_FALSE(items[0].set_hook.Linked());
+  std::vector<int> result;
+  for (auto it = my_set.Cbegin(); it != my_set.Cend(); ++it) {
+    result.push_back(it->value);
+  }
+  ASSERT_EQ(result, (std::vector<int>{1, 3, 4, 7, 8, 9}));
+}
+
+TEST(intrusive_set, random_test) {
+  std::vector<IntrusiveItem> items(2000);
+  ItemSet my_set;
+  std::set<int> orig_set;
+  unsigned state = 12345;
+  for (int round = 0; round < 20000; ++round) {
+    state = state * 1103515245U + 12345U;
+    int index = static_cast<int>((state >> 8) % items.size());
+    IntrusiveItem& item = items[index];
+    if (item.set_hook.Linked()) {
+      my_set.Erase(item);
+      orig_set.erase(item.value);
+    } else {
+      item.value = index;
+      ASSERT_TRUE(my_set.Insert(item).second);
+      orig_set.insert(index);
+    }
+  }
+  ASSERT_EQ(my_set.Size(), orig_set.size());
+  auto orig = orig_set.begin();
+  for (auto it = my_set.Begin(); it != my_set.End(); ++it, ++orig) {
+    ASSERT_EQ(it->value, *orig);
+  }
+  auto rorig = orig_set.rbegin();
+  for (auto it = my_set.End(); it != my_set.Begin(); ++rorig) {
+    ASSERT_EQ((--it)->value, *rorig);
+  }
+  auto it = my_set.Begin();
+  while (it != my_set.End()) {
+    orig_set.erase(it->value);
+    it = my_set.Erase(it);
+    if (it != my_set.End()) ++it;
+  }
+  ASSERT_EQ(my_set.Size(), orig_set.size());
+  orig = orig_set.begin();
+  for (it = my_set.Begin(); it != my_set.End(); ++it, ++orig) {
+    ASSERT_EQ(it->value, *orig);
+  }
+  my_set.Clear();
+  ASSERT_TRUE(my_set.Empty());
+  for (const IntrusiveItem& item : items) {
+    ASSERT_FALSE(item.set_hook.Linked());
+  }
+}
+
+TEST(intrusive_set, list_and_set_test) {
+  std::vector<IntrusiveItem> items(5);
+  ItemList order;
+  ItemSet index;
+  int values[] = {40, 10, 30, 50, 20};
+  for (int i = 0; i < 5; ++i) {
+    items[i].value = values[i];
+    order.PushBack(items[i]);
+    index.Insert(items[i]);
+  }
+  // Look up through the set, unlink from both in O(1)
+  IntrusiveItem& found = *index.Find(30);
+  order.Erase(found);
+  index.Erase(found);
+  ASSERT_EQ(order.Size(), 4U);
+  ASSERT_EQ(index.Size(), 4U);
+  ASSERT_EQ(order.Front().value, 40);
+  ASSERT_EQ((++order.Begin())->value, 10);
+  ASSERT_EQ((++index.Begin())->value, 20);
+  ItemSet other;
+  other.Swap(index);
+  ASSERT_TRUE(index.Empty());
+  ASSERT_EQ(index.Begin(), index.End());
+  ASSERT_EQ(other.Size(), 4U);
+  ASSERT_EQ((--other.End())->value, 50);
+  ASSERT_TRUE(other.Contains(10));
+}
+
 // LIST-------------------------------------------------------------------------
 
 template <typename ValueType>
@@ -481,15 +2135,79 @@ TEST(list, splice_test_3) {
   ASSERT_TRUE(compare_lists(my_list, orig_list));
 }
 
-TEST(list, splice_test_4) {
-  s21::List<double> my_list{0.01, -0.2, 1.98};
-  std::list<double> orig_list{0.01, -0.2, 1.98};
-  s21::List<double> my_add{3.33, 2.22};
-  std::list<double> orig_add{3.33, 2.22};
-  orig_list.splice(++orig_list.cbegin(), orig_add);
-  my_list.Splice(++my_list.Cbegin(), my_add);
+TEST(list, splice_test_4) {
+  s21::List<double> my_list{0.01, -0.2, 1.98};
+  std::list<double> orig_list{0.01, -0.2, 1.98};
+  s21::List<double> my_add{3.33, 2.22};
+  std::list<double> orig_add{3.33, 2.22};
+  orig_list.splice(++orig_list.cbegin(), orig_add);
+  my_list.Splice(++my_list.Cbegin(), my_add);
+  ASSERT_EQ(my_list.Size(), orig_list.size());
+  ASSERT_TRUE(compare_lists(my_list, orig_list));
+}
+
+TEST(list, splice_test_5) {
+  s21::List<int> my_list{1, 2, 3};
+  std::list<int> orig_list{1, 2, 3};
+  s21::List<int> my_add{7, 8, 9};
+  std::list<int> orig_add{7, 8, 9};
+  orig_list.splice(++orig_list.cbegin(), orig_add, ++orig_add.cbegin());
+  my_list.Splice(++my_list.Cbegin(), my_add, ++my_add.Begin());
+  orig_list.splice(orig_list.cend(), orig_add, orig_add.cbegin());
+  my_list.Splice(my_list.Cend(), my_add, my_add.Cbegin());
+  ASSERT_EQ(my_list.Size(), orig_list.size());
+  ASSERT_EQ(my_add.Size(), orig_add.size());
+  ASSERT_TRUE(compare_lists(my_list, orig_list));
+  ASSERT_TRUE(compare_lists(my_add, orig_add));
+}
+
+TEST(list, splice_test_6) {
+  s21::List<int> my_list{1, 2, 3, 4, 5};
+  std::list<int> orig_list{1, 2, 3, 4, 5};
+  // Move to the front within the same list, as an LRU touch does
+  orig_list.splice(orig_list.cbegin(), orig_list, --orig_list.cend());
+  auto last = my_list.Begin() + 4;
+  my_list.Splice(my_list.Cbegin(), my_list, last);
+  orig_list.splice(orig_list.cend(), orig_list, orig_list.cbegin());
+  my_list.Splice(my_list.Cend(), my_list, my_list.Cbegin());
+  my_list.Splice(my_list.Cbegin(), my_list, my_list.Cbegin());
+  ASSERT_EQ(my_list.Size(), orig_list.size());
+  ASSERT_TRUE(compare_lists(my_list, orig_list));
+  ASSERT_EQ(my_list.Front(), orig_list.front());
+  ASSERT_EQ(my_list.Back(), orig_list.back());
+}
+
+TEST(list, splice_test_7) {
+  s21::List<int> my_list{1, 2, 3};
+  std::list<int> orig_list{1, 2, 3};
+  s21::List<int> my_add{4, 5, 6, 7, 8};
+  std::list<int> orig_add{4, 5, 6, 7, 8};
+  orig_list.splice(++orig_list.cbegin(), orig_add, ++orig_add.cbegin(),
+                   --orig_add.cend());
+  my_list.Splice(++my_list.Cbegin(), my_add, ++my_add.Cbegin(),
+                 my_add.Begin() + 4, 3);
+  ASSERT_EQ(my_list.Size(), orig_list.size());
+  ASSERT_EQ(my_add.Size(), orig_add.size());
+  ASSERT_TRUE(compare_lists(my_list, orig_list));
+  ASSERT_TRUE(compare_lists(my_add, orig_add));
+  orig_list.splice(orig_list.cbegin(), orig_add, orig_add.cbegin(),
+                   orig_add.cend());
+  my_list.Splice(my_list.Cbegin(), my_add, my_add.Cbegin(), my_add.Cend());
+  ASSERT_TRUE(my_add.Empty());
+  ASSERT_EQ(my_list.Size(), orig_list.size());
+  ASSERT_TRUE(compare_lists(my_list, orig_list));
+}
+
+TEST(list, splice_test_8) {
+  s21::List<int> my_list{1, 2, 3, 4, 5, 6};
+  std::list<int> orig_list{1, 2, 3, 4, 5, 6};
+  orig_list.splice(orig_list.cbegin(), orig_list,
+                   std::next(orig_list.cbegin(), 3), orig_list.cend());
+  my_list.Splice(my_list.Cbegin(), my_list, my_list.Begin() + 3,
+                 my_list.Cend());
   ASSERT_EQ(my_list.Size(), orig_list.size());
   ASSERT_TRUE(compare_lists(my_list, orig_list));
+  ASSERT_EQ(my_list.Back(), orig_list.back());
 }
 
 TEST(list, merge_test_1) {
@@ -641,6 +2359,87 @@ TEST(list, emplace_front_test_2) {
   ASSERT_EQ(my_list.Front(), orig_list.front());
 }
 
+// LOCK FREE STACK--------------------------------------------------------------
+
+TEST(lock_free_stack, default_constructor_test) {
+  s21::LockFreeStack<int> my_stack;
+  ASSERT_TRUE(my_stack.Empty());
+  ASSERT_EQ(my_stack.Size(), 0U);
+}
+
+TEST(lock_free_stack, push_pop_test) {
+  s21::LockFreeStack<std::string> my_stack{"a", "b"};
+  std::stack<std::string> orig_stack;
+  orig_stack.push("a");
+  orig_stack.push("b");
+  for (int i = 0; i < 10; ++i) {
+    my_stack.Push(std::to_string(i));
+    orig_stack.push(std::to_string(i));
+  }
+  ASSERT_EQ(my_stack.Size(), orig_stack.size());
+  while (!orig_stack.empty()) {
+    ASSERT_EQ(my_stack.Top(), orig_stack.top());
+    my_stack.Pop();
+    orig_stack.pop();
+  }
+  ASSERT_TRUE(my_stack.Empty());
+  std::string value;
+  ASSERT_FALSE(my_stack.TryPop(value));
+}
+
+TEST(lock_free_stack, pop_all_test) {
+  s21::LockFreeStack<int> my_stack{1, 2, 3};
+  my_stack.Emplace(4);
+  s21::Vector<int> out;
+  ASSERT_EQ(my_stack.PopAll(out), 4U);
+  ASSERT_TRUE(my_stack.Empty());
+  ASSERT_EQ(my_stack.Size(), 0U);
+  ASSERT_EQ(out[0], 4);
+  ASSERT_EQ(out[3], 1);
+  ASSERT_EQ(my_stack.PopAll(out), 0U);
+  my_stack.Push(5);
+  ASSERT_EQ(my_stack.Top(), 5);
+}
+
+TEST(lock_free_stack, destructor_test) {
+  auto shared = std::make_shared<int>(1);
+  {
+    s21::LockFreeStack<std::shared_ptr<int>> my_stack;
+    for (int i = 0; i < 3; ++i) my_stack.Push(shared);
+    my_stack.Pop();
+    ASSERT_EQ(shared.use_count(), 3);
+  }
+  ASSERT_EQ(shared.use_count(), 1);
+}
+
+TEST(lock_free_stack, concurrent_push_pop_test) {
+  constexpr int kThreads = 4;
+  constexpr int kItems = 20000;
+  s21::LockFreeStack<int> my_stack;
+  std::atomic<long long> sum{0};
+  std::atomic<int> bad_sizes{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&my_stack, &sum, &bad_sizes, t] {
+      int value = 0;
+      for (int i = 0; i < kItems; ++i) {
+        my_stack.Push(t * kItems + i);
+        if (i % 2 && my_stack.TryPop(value)) sum += value;
+        // A pop overtaking the count of its push would wrap Size around
+        if (my_stack.Size() > size_t(kThreads * kItems)) ++bad_sizes;
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  ASSERT_EQ(bad_sizes, 0);
+  s21::List<int> rest;
+  my_stack.PopAll(rest);
+  for (auto it = rest.Begin(); it != rest.End(); ++it) sum += *it;
+  long long n = kThreads * kItems;
+  ASSERT_EQ(sum.load(), n * (n - 1) / 2);
+  ASSERT_TRUE(my_stack.Empty());
+}
+
 // MAP--------------------------------------------------------------------------
 
 TEST(map, default_constructor_test) {
@@ -1041,6 +2840,167 @@ TEST(map, emplace_test) {
   }
 }
 
+TEST(map, const_lookup_test) {
+  s21::Map<int, std::string> my_map{{2, "two"}, {1, "one"}, {3, "three"}};
+  const s21::Map<int, std::string>& view = my_map;
+  ASSERT_EQ(view.Size(), 3U);
+  ASSERT_TRUE(view.Contains(2));
+  ASSERT_FALSE(view.Contains(4));
+  ASSERT_EQ(view.At(3), "three");
+  ASSERT_EQ(view.Find(1)->second, "one");
+  ASSERT_EQ(view.Find(4), view.Cend());
+  ASSERT_EQ(my_map.Find(5), my_map.End());
+  my_map.Find(2)->second = "TWO";
+  ASSERT_EQ(view.At(2), "TWO");
+  std::vector<int> keys;
+  for (auto it = view.Cbegin(); it != view.Cend(); ++it) {
+    keys.push_back(it->first);
+  }
+  ASSERT_EQ(keys, (std::vector<int>{1, 2, 3}));
+}
+
+TEST(map, batch_lookup_test) {
+  s21::Map<int, int> my_map;
+  std::mt19937 rng(48);
+  for (int i = 0; i < 500; ++i) my_map.InsertOrAssign(rng() % 1000, i);
+  std::vector<int> keys;
+  for (int i = 0; i < 777; ++i) keys.push_back(rng() % 1100);
+  const s21::Map<int, int>& view = my_map;
+  std::vector<s21::Map<int, int>::ConstIterator> its(keys.size());
+  std::vector<char> contains(keys.size());
+  view.FindBatch(keys.begin(), keys.size(), its.begin());
+  view.ContainsBatch(keys.begin(), keys.size(), contains.begin());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    ASSERT_EQ(its[i], view.Find(keys[i]));
+    ASSERT_EQ(contains[i] != 0, view.Contains(keys[i]));
+  }
+  s21::Map<int, int> empty;
+  empty.ContainsBatch(keys.begin(), keys.size(), contains.begin());
+  ASSERT_EQ(std::count(contains.begin(), contains.end(), 0),
+            static_cast<long>(keys.size()));
+}
+
+TEST(map, compare_test) {
+  s21::Map<int, int, std::greater<int>> my_map;
+  std::map<int, int, std::greater<int>> orig_map;
+  std::mt19937 gen(11);
+  for (int i = 0; i < 2000; ++i) {
+    int key = gen() % 500;
+    if (gen() % 3) {
+      ASSERT_EQ(my_map.Insert(key, i).second, orig_map.emplace(key, i).second);
+    } else if (my_map.Contains(key)) {
+      my_map.Erase(my_map.Find(key));
+      orig_map.erase(key);
+    }
+  }
+  ASSERT_EQ(my_map.Size(), orig_map.size());
+  auto orig_it = orig_map.begin();
+  for (auto it = my_map.Cbegin(); it != my_map.Cend(); ++it, ++orig_it) {
+    ASSERT_EQ(it->first, orig_it->first);
+  }
+  s21::FrozenMap<int, int, std::greater<int>> frozen = my_map.Freeze();
+  orig_it = orig_map.begin();
+  for (auto it = frozen.Begin(); it != frozen.End(); ++it, ++orig_it) {
+    ASSERT_EQ(it->first, orig_it->first);
+    ASSERT_EQ(frozen.At(it->first), orig_it->second);
+  }
+  ASSERT_TRUE(my_map.KeyComp()(2, 1));
+}
+
+TEST(map, transparent_test) {
+  s21::Map<std::string, int, std::less<>> my_map{
+      {"one", 1}, {"two", 2}, {"three", 3}};
+  const s21::Map<std::string, int, std::less<>>& reader = my_map;
+  std::string_view key = "two";
+  ASSERT_EQ(my_map.Find(key)->second, 2);
+  ASSERT_EQ(reader.Find(key)->second, 2);
+  ASSERT_TRUE(reader.Contains(std::string_view("three")));
+  ASSERT_FALSE(reader.Contains(std::string_view("four")));
+  ASSERT_TRUE(reader.Find(std::string_view("four")) == reader.Cend());
+  ASSERT_EQ(my_map.At("one"), 1);
+}
+
+// MPMC QUEUE-------------------------------------------------------------------
+
+TEST(mpmc_queue, capacity_test) {
+  s21::MpmcQueue<int> my_queue(100);
+  ASSERT_EQ(my_queue.Capacity(), 128U);
+  ASSERT_TRUE(my_queue.Empty());
+  ASSERT_EQ(my_queue.Size(), 0U);
+}
+
+TEST(mpmc_queue, try_push_try_pop_test) {
+  s21::MpmcQueue<std::string> my_queue(4);
+  std::queue<std::string> orig_queue;
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_TRUE(my_queue.TryPush(std::to_string(i)));
+    orig_queue.push(std::to_string(i));
+  }
+  ASSERT_FALSE(my_queue.TryPush("full"));
+  ASSERT_EQ(my_queue.Size(), orig_queue.size());
+  std::string value;
+  while (!orig_queue.empty()) {
+    ASSERT_TRUE(my_queue.TryPop(value));
+    ASSERT_EQ(value, orig_queue.front());
+    orig_queue.pop();
+  }
+  ASSERT_FALSE(my_queue.TryPop(value));
+  ASSERT_TRUE(my_queue.Empty());
+}
+
+TEST(mpmc_queue, destructor_test) {
+  auto shared = std::make_shared<int>(5);
+  {
+    s21::MpmcQueue<std::shared_ptr<int>> my_queue(8);
+    for (int i = 0; i < 5; ++i) my_queue.Push(shared);
+    std::shared_ptr<int> out;
+    my_queue.Pop(out);
+    ASSERT_EQ(shared.use_count(), 6);
+  }
+  ASSERT_EQ(shared.use_count(), 1);
+}
+
+void MpmcStress(size_t spin_count) {
+  constexpr int kThreads = 4;
+  constexpr int kItems = 20000;
+  s21::MpmcQueue<int> my_queue(16, spin_count);
+  std::atomic<long long> sum{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&my_queue, t] {
+      for (int i = 0; i < kItems; ++i) my_queue.Push(t * kItems + i);
+    });
+    threads.emplace_back([&my_queue, &sum] {
+      int value = 0;
+      for (int i = 0; i < kItems; ++i) {
+        my_queue.Pop(value);
+        sum += value;
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  long long n = kThreads * kItems;
+  ASSERT_EQ(sum.load(), n * (n - 1) / 2);
+  ASSERT_TRUE(my_queue.Empty());
+}
+
+TEST(mpmc_queue, stress_spin_test) { MpmcStress(1000); }
+
+TEST(mpmc_queue, stress_park_test) { MpmcStress(0); }
+
+TEST(mpmc_queue, blocking_pop_test) {
+  s21::MpmcQueue<int> my_queue(2, 0);
+  std::thread consumer([&my_queue] {
+    int value = 0;
+    for (int expected = 0; expected < 100; ++expected) {
+      my_queue.Pop(value);
+      ASSERT_EQ(value, expected);
+    }
+  });
+  for (int i = 0; i < 100; ++i) my_queue.Push(i);
+  consumer.join();
+}
+
 // MULTISET---------------------------------------------------------------------
 
 template <typename value_type>
@@ -1349,6 +3309,316 @@ TEST(multiset, emplace_test_2) {
   }
 }
 
+TEST(multiset, compare_test) {
+  s21::Multiset<int, std::greater<int>> my_multiset{3, 1, 4, 1, 5, 9, 2, 6};
+  std::multiset<int, std::greater<int>> orig_multiset{3, 1, 4, 1,
+                                                      5, 9, 2, 6};
+  auto orig_it = orig_multiset.begin();
+  for (auto it = my_multiset.Begin(); it != my_multiset.End();
+       ++it, ++orig_it) {
+    ASSERT_EQ(*it, *orig_it);
+  }
+  ASSERT_EQ(my_multiset.Count(1), 2U);
+  ASSERT_EQ(*my_multiset.UpperBound(4), 3);
+  ASSERT_EQ(*my_multiset.LowerBound(7), 6);
+  my_multiset.Erase(my_multiset.Find(9));
+  my_multiset.Erase(my_multiset.Find(4));
+  ASSERT_FALSE(my_multiset.Contains(4));
+  ASSERT_EQ(*my_multiset.Begin(), 6);
+  s21::Multiset<std::string, std::less<>> words{"a", "b", "a"};
+  ASSERT_EQ(words.Count(std::string_view("a")), 2U);
+  ASSERT_EQ(*words.Find(std::string_view("b")), "b");
+  ASSERT_FALSE(words.Contains(std::string_view("c")));
+}
+
+// PAIRING HEAP-----------------------------------------------------------------
+
+TEST(pairing_heap, push_pop_test) {
+  s21::PairingHeap<int> my_heap;
+  std::priority_queue<int, std::vector<int>, std::greater<int>> orig_queue;
+  for (int i = 0; i < 1000; ++i) {
+    int value = (i * 7919) % 1000;
+    my_heap.Push(value);
+    orig_queue.push(value);
+    if (i % 4 == 3) {
+      ASSERT_EQ(my_heap.Top(), orig_queue.top());
+      my_heap.Pop();
+      orig_queue.pop();
+    }
+  }
+  ASSERT_EQ(my_heap.Size(), orig_queue.size());
+  while (!orig_queue.empty()) {
+    ASSERT_EQ(my_heap.Top(), orig_queue.top());
+    my_heap.Pop();
+    orig_queue.pop();
+  }
+  ASSERT_TRUE(my_heap.Empty());
+}
+
+TEST(pairing_heap, update_erase_test) {
+  s21::PairingHeap<int> my_heap;
+  std::multiset<int> orig_set;
+  std::vector<s21::PairingHeap<int>::Handle> handles;
+  for (int i = 0; i < 300; ++i) {
+    handles.push_back(my_heap.Push(i * 10));
+    orig_set.insert(i * 10);
+  }
+  my_heap.Pop();
+  orig_set.erase(orig_set.begin());
+  for (int i = 3; i < 300; i += 3) {
+    orig_set.erase(orig_set.find(my_heap.Get(handles[i])));
+    my_heap.DecreaseKey(handles[i], -i);
+    orig_set.insert(-i);
+  }
+  for (int i = 1; i < 300; i += 3) {
+    orig_set.erase(orig_set.find(my_heap.Get(handles[i])));
+    my_heap.Update(handles[i], 5000 - i);
+    orig_set.insert(5000 - i);
+  }
+  for (int i = 2; i < 300; i += 6) {
+    orig_set.erase(orig_set.find(my_heap.Get(handles[i])));
+    my_heap.Erase(handles[i]);
+  }
+  ASSERT_EQ(my_heap.Size(), orig_set.size());
+  ASSERT_EQ(my_heap.Get(my_heap.TopHandle()), *orig_set.begin());
+  for (int value : orig_set) {
+    ASSERT_EQ(my_heap.Top(), value);
+    my_heap.Pop();
+  }
+}
+
+TEST(pairing_heap, merge_swap_test) {
+  s21::PairingHeap<int> my_heap;
+  s21::PairingHeap<int> other;
+  for (int i = 0; i < 10; ++i) my_heap.Push(2 * i);
+  auto handle = other.Push(7);
+  for (int i = 0; i < 10; ++i) other.Push(2 * i + 1);
+  my_heap.Merge(other);
+  ASSERT_TRUE(other.Empty());
+  ASSERT_EQ(my_heap.Size(), 21U);
+  my_heap.DecreaseKey(handle, -1);
+  ASSERT_EQ(my_heap.Top(), -1);
+  s21::PairingHeap<int> moved(std::move(my_heap));
+  ASSERT_EQ(moved.Size(), 21U);
+  my_heap.Swap(moved);
+  my_heap.Pop();
+  for (int i = 0; i < 20; ++i) {
+    ASSERT_EQ(my_heap.Top(), i);
+    my_heap.Pop();
+  }
+}
+
+// PERSISTENT MAP---------------------------------------------------------------
+
+TEST(persistent_map, versions_test) {
+  s21::PersistentMap<int, std::string> empty;
+  auto one = empty.Insert(1, "one");
+  auto uno = one.InsertOrAssign(1, "uno");
+  auto same = uno.Insert(1, "ein");
+  auto none = uno.Erase(1);
+  ASSERT_TRUE(empty.Empty());
+  ASSERT_EQ(one.At(1), "one");
+  ASSERT_EQ(uno.At(1), "uno");
+  ASSERT_EQ(same.At(1), "uno");
+  ASSERT_EQ(uno.Size(), 1U);
+  ASSERT_FALSE(none.Contains(1));
+  ASSERT_EQ(none.Size(), 0U);
+  ASSERT_EQ(uno.Erase(2).Size(), 1U);
+}
+
+TEST(persistent_map, random_versions_test) {
+  std::vector<s21::PersistentMap<int, int>> versions(1);
+  std::vector<std::map<int, int>> orig_versions(1);
+  std::mt19937 rng(44);
+  for (int i = 0; i < 3000; ++i) {
+    size_t base = rng() % versions.size();
+    int key = rng() % 200;
+    if (rng() % 3 == 0) {
+      versions.push_back(versions[base].Erase(key));
+      orig_versions.push_back(orig_versions[base]);
+      orig_versions.back().erase(key);
+    } else {
+      versions.push_back(versions[base].InsertOrAssign(key, i));
+      orig_versions.push_back(orig_versions[base]);
+      orig_versions.back()[key] = i;
+    }
+  }
+  for (size_t v = 0; v < versions.size(); ++v) {
+    ASSERT_EQ(versions[v].Size(), orig_versions[v].size());
+    auto orig_it = orig_versions[v].begin();
+    for (auto it = versions[v].Begin(); it != versions[v].End();
+         ++it, ++orig_it) {
+      ASSERT_EQ(*it, *orig_it);
+    }
+  }
+}
+
+TEST(persistent_map, lookup_test) {
+  s21::PersistentMap<int, int> my_map{{10, 1}, {20, 2}, {30, 3}};
+  ASSERT_EQ(my_map.Find(20)->second, 2);
+  ASSERT_EQ(my_map.Find(25), my_map.End());
+  ASSERT_EQ(my_map.LowerBound(25)->first, 30);
+  ASSERT_EQ(my_map.LowerBound(5), my_map.Begin());
+  ASSERT_EQ(my_map.LowerBound(31), my_map.End());
+  auto it = my_map.Find(10);
+  ASSERT_EQ((++it)->first, 20);
+}
+
+TEST(persistent_map, balance_test) {
+  // Sorted insertion would degenerate an unbalanced tree into a list, too
+  // deep for the iterator
+  s21::PersistentMap<int, int> my_map;
+  for (int i = 0; i < 100000; ++i) my_map = my_map.Insert(i, i);
+  for (int i = 0; i < 100000; i += 2) my_map = my_map.Erase(i);
+  int expected = 1;
+  for (auto it = my_map.Begin(); it != my_map.End(); ++it, expected += 2) {
+    ASSERT_EQ(it->first, expected);
+  }
+  ASSERT_EQ(my_map.Size(), 50000U);
+}
+
+TEST(persistent_map, snapshot_threads_test) {
+  s21::PersistentMap<int, int> current;
+  for (int i = 0; i < 1000; ++i) current = current.Insert(i, i);
+  std::vector<std::thread> readers;
+  std::atomic<int> bad{0};
+  for (int t = 0; t < 4; ++t) {
+    // Each reader walks its own snapshot while the writer moves on
+    readers.emplace_back([snapshot = current, &bad] {
+      for (int round = 0; round < 20; ++round) {
+        auto copy = snapshot;
+        int count = 0;
+        for (auto it = copy.Begin(); it != copy.End(); ++it, ++count) {
+          if (it->first != count || it->second != count) ++bad;
+        }
+        if (count != 1000) ++bad;
+      }
+    });
+  }
+  for (int i = 0; i < 1000; ++i) current = current.InsertOrAssign(i, -i);
+  for (std::thread& reader : readers) reader.join();
+  ASSERT_EQ(bad, 0);
+  ASSERT_EQ(current.At(7), -7);
+}
+
+// PERSISTENT SET---------------------------------------------------------------
+
+TEST(persistent_set, versions_test) {
+  s21::PersistentSet<int> base{5, 1, 3};
+  auto more = base.Insert(4).Insert(2);
+  auto fewer = more.Erase(1).Erase(5);
+  std::set<int> orig_more{1, 2, 3, 4, 5};
+  ASSERT_TRUE(std::equal(more.Begin(), more.End(), orig_more.begin(),
+                         orig_more.end()));
+  ASSERT_EQ(base.Size(), 3U);
+  ASSERT_FALSE(base.Contains(2));
+  ASSERT_EQ(fewer.Size(), 3U);
+  ASSERT_EQ(*fewer.Begin(), 2);
+  ASSERT_EQ(*fewer.LowerBound(4), 4);
+  ASSERT_EQ(fewer.LowerBound(5), fewer.End());
+  ASSERT_EQ(fewer.Find(1), fewer.End());
+  ASSERT_EQ(more.Insert(3).Size(), 5U);
+}
+
+// PRIORITY QUEUE---------------------------------------------------------------
+
+template <size_t Arity>
+void PriorityQueueMatchesStd() {
+  s21::PriorityQueue<int, s21::Vector<int>, std::less<int>, Arity> my_queue;
+  std::priority_queue<int> orig_queue;
+  unsigned seed = 7;
+  for (int i = 0; i < 2000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int value = static_cast<int>(seed >> 16) % 500;
+    if (i % 3 == 2) {
+      ASSERT_EQ(my_queue.Top(), orig_queue.top());
+      my_queue.Pop();
+      orig_queue.pop();
+    } else {
+      my_queue.Push(value);
+      orig_queue.push(value);
+    }
+  }
+  ASSERT_EQ(my_queue.Size(), orig_queue.size());
+  while (!orig_queue.empty()) {
+    ASSERT_EQ(my_queue.Top(), orig_queue.top());
+    my_queue.Pop();
+    orig_queue.pop();
+  }
+  ASSERT_TRUE(my_queue.Empty());
+}
+
+TEST(priority_queue, push_pop_test) {
+  PriorityQueueMatchesStd<2>();
+  PriorityQueueMatchesStd<4>();
+  PriorityQueueMatchesStd<8>();
+}
+
+TEST(priority_queue, min_heap_test) {
+  s21::PriorityQueue<std::string, s21::Vector<std::string>,
+                     std::greater<std::string>, 4>
+      my_queue{"pear", "apple", "plum", "fig", "kiwi"};
+  std::priority_queue<std::string, std::vector<std::string>,
+                      std::greater<std::string>>
+      orig_queue;
+  for (auto item : {"pear", "apple", "plum", "fig", "kiwi"}) {
+    orig_queue.push(item);
+  }
+  my_queue.Emplace(3, 'a');
+  orig_queue.emplace(3, 'a');
+  while (!orig_queue.empty()) {
+    ASSERT_EQ(my_queue.Top(), orig_queue.top());
+    my_queue.Pop();
+    orig_queue.pop();
+  }
+}
+
+TEST(priority_queue, heapify_test) {
+  std::vector<int> items(1000);
+  for (int i = 0; i < 1000; ++i) items[i] = (i * 7919) % 1000;
+  s21::PriorityQueue<int, s21::Vector<int>, std::less<int>, 8> my_queue(
+      items.begin(), items.end());
+  std::priority_queue<int> orig_queue(items.begin(), items.end());
+  my_queue.Heapify(items.begin(), items.begin() + 10);
+  for (int i = 0; i < 10; ++i) orig_queue.push(items[i]);
+  ASSERT_EQ(my_queue.Size(), orig_queue.size());
+  while (!orig_queue.empty()) {
+    ASSERT_EQ(my_queue.Top(), orig_queue.top());
+    my_queue.Pop();
+    orig_queue.pop();
+  }
+}
+
+TEST(priority_queue, push_pop_replace_test) {
+  s21::PriorityQueue<int> my_queue{5, 1, 8, 3};
+  ASSERT_EQ(my_queue.PushPop(10), 10);
+  ASSERT_EQ(my_queue.Size(), 4U);
+  ASSERT_EQ(my_queue.PushPop(4), 8);
+  ASSERT_EQ(my_queue.Top(), 5);
+  ASSERT_EQ(my_queue.Replace(0), 5);
+  ASSERT_EQ(my_queue.Size(), 4U);
+  int expected[] = {4, 3, 1, 0};
+  for (int value : expected) {
+    ASSERT_EQ(my_queue.Top(), value);
+    my_queue.Pop();
+  }
+  s21::PriorityQueue<int> empty_queue;
+  ASSERT_EQ(empty_queue.PushPop(2), 2);
+  ASSERT_TRUE(empty_queue.Empty());
+}
+
+TEST(priority_queue, move_swap_test) {
+  s21::PriorityQueue<int> my_queue{1, 2, 3};
+  s21::PriorityQueue<int> other{7};
+  my_queue.Swap(other);
+  ASSERT_EQ(my_queue.Top(), 7);
+  ASSERT_EQ(other.Top(), 3);
+  s21::PriorityQueue<int> moved(std::move(other));
+  ASSERT_EQ(moved.Size(), 3U);
+  my_queue = std::move(moved);
+  ASSERT_EQ(my_queue.Top(), 3);
+}
+
 // QUEUE------------------------------------------------------------------------
 
 TEST(queue, default_constructor_test) {
@@ -1538,6 +3808,140 @@ TEST(queue, emplace_back_test) {
   }
 }
 
+TEST(queue, push_range_test) {
+  s21::Queue<int> my_queue{1, 2};
+  std::list<int> tmp{1, 2};
+  std::queue<int, std::list<int>> orig_queue(tmp);
+  std::vector<int> items{3, 4, 5, 6};
+  my_queue.PushRange(items.begin(), items.end());
+  for (int item : items) orig_queue.push(item);
+  ASSERT_EQ(my_queue.Size(), orig_queue.size());
+  while (!orig_queue.empty()) {
+    ASSERT_EQ(my_queue.Front(), orig_queue.front());
+    my_queue.Pop();
+    orig_queue.pop();
+  }
+}
+
+TEST(queue, pop_n_test) {
+  s21::Queue<std::string, s21::Deque<std::string>> my_queue;
+  std::vector<std::string> items{"a", "b", "c", "d", "e"};
+  my_queue.PushRange(items.begin(), items.end());
+  s21::Vector<std::string> out;
+  ASSERT_EQ(my_queue.PopN(3, out), 3U);
+  ASSERT_EQ(my_queue.PopN(10, out), 2U);
+  ASSERT_EQ(my_queue.PopN(1, out), 0U);
+  ASSERT_TRUE(my_queue.Empty());
+  ASSERT_EQ(out.Size(), items.size());
+  for (size_t i = 0; i < items.size(); ++i) ASSERT_EQ(out[i], items[i]);
+  my_queue.ShrinkToFit();
+}
+
+// RCU MAP----------------------------------------------------------------------
+
+TEST(rcu_map, publish_test) {
+  s21::RcuMap<int, std::string> my_map{{2, "two"}, {1, "one"}};
+  ASSERT_EQ(my_map.Size(), 2U);
+  my_map.InsertOrAssign(3, "three");
+  my_map.Erase(1);
+  my_map.InsertOrAssign(2, "deux");
+  ASSERT_EQ(my_map.Staged(), 3U);
+  // Staged changes stay invisible until published
+  ASSERT_TRUE(my_map.Contains(1));
+  ASSERT_FALSE(my_map.Contains(3));
+  auto before = my_map.Read();
+  my_map.Publish();
+  ASSERT_EQ(my_map.Staged(), 0U);
+  ASSERT_FALSE(my_map.Contains(1));
+  ASSERT_EQ(my_map.At(2), "deux");
+  std::string value;
+  ASSERT_TRUE(my_map.Find(3, value));
+  ASSERT_EQ(value, "three");
+  // A view taken earlier keeps its version
+  ASSERT_EQ(*before.Find(1), "one");
+  ASSERT_EQ(*before.Find(2), "two");
+  ASSERT_EQ(before.Find(3), nullptr);
+  auto after = my_map.Read();
+  std::vector<std::pair<int, std::string>> orig_entries{{2, "deux"},
+                                                        {3, "three"}};
+  ASSERT_TRUE(std::equal(after.Begin(), after.End(), orig_entries.begin(),
+                         orig_entries.end()));
+  ASSERT_EQ(after.LowerBound(1)->first, 2);
+  ASSERT_EQ(after.LowerBound(4), after.End());
+}
+
+TEST(rcu_map, grace_period_test) {
+  auto payload = std::make_shared<int>(1);
+  s21::RcuMap<int, std::shared_ptr<int>> my_map;
+  my_map.InsertOrAssign(1, payload);
+  my_map.Publish();
+  {
+    auto view = my_map.Read();
+    my_map.InsertOrAssign(1, std::make_shared<int>(2));
+    my_map.Publish();
+    for (int i = 0; i < 5; ++i) my_map.Read();
+    // Still reachable through the view
+    ASSERT_EQ(**view.Find(1), 1);
+    ASSERT_GT(payload.use_count(), 1);
+  }
+  my_map.Synchronize();
+  ASSERT_EQ(payload.use_count(), 1);
+  ASSERT_EQ(*my_map.At(1), 2);
+}
+
+TEST(rcu_map, concurrent_readers_test) {
+  s21::RcuMap<int, int> my_map;
+  for (int key = 0; key < 100; ++key) my_map.InsertOrAssign(key, 0);
+  my_map.Publish();
+  std::atomic<bool> stop{false};
+  std::atomic<int> bad{0};
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 4; ++t) {
+    readers.emplace_back([&my_map, &stop, &bad] {
+      int last_round = 0;
+      while (!stop) {
+        // Every version maps all keys to the round that published it
+        auto view = my_map.Read();
+        int round = view.Begin()->second;
+        if (round < last_round || view.Size() != 100) ++bad;
+        for (auto it = view.Begin(); it != view.End(); ++it) {
+          if (it->second != round) ++bad;
+        }
+        last_round = round;
+      }
+    });
+  }
+  for (int round = 1; round <= 200; ++round) {
+    for (int key = 0; key < 100; ++key) my_map.InsertOrAssign(key, round);
+    my_map.Publish();
+  }
+  stop = true;
+  for (std::thread& reader : readers) reader.join();
+  ASSERT_EQ(bad, 0);
+  ASSERT_EQ(my_map.At(99), 200);
+}
+
+TEST(rcu_map, batch_test) {
+  s21::RcuMap<int, int> my_map;
+  bool found = true;
+  int probe = 0;
+  my_map.ContainsBatch(&probe, 1, &found);
+  ASSERT_FALSE(found);
+  for (int key = 0; key < 300; key += 3) my_map.InsertOrAssign(key, -key);
+  my_map.Publish();
+  std::vector<int> keys;
+  for (int key = 310; key >= -5; --key) keys.push_back(key);
+  auto view = my_map.Read();
+  std::vector<const int*> values(keys.size());
+  std::vector<char> contains(keys.size());
+  view.FindBatch(keys.begin(), keys.size(), values.begin());
+  my_map.ContainsBatch(keys.begin(), keys.size(), contains.begin());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    ASSERT_EQ(values[i], view.Find(keys[i]));
+    ASSERT_EQ(contains[i] != 0, view.Contains(keys[i]));
+  }
+}
+
 // SET--------------------------------------------------------------------------
 
 template <typename value_type>
@@ -1794,6 +4198,186 @@ TEST(set, emplace_test_2) {
   ASSERT_TRUE(compare_sets(my_set, orig_set));
 }
 
+TEST(set, const_lookup_test) {
+  s21::Set<int> my_set{5, 3, 8, 1};
+  const s21::Set<int>& view = my_set;
+  ASSERT_EQ(view.Size(), 4U);
+  ASSERT_FALSE(view.Empty());
+  ASSERT_TRUE(view.Contains(8));
+  ASSERT_FALSE(view.Contains(4));
+  ASSERT_EQ(*view.Find(3), 3);
+  ASSERT_EQ(view.Find(4), view.Cend());
+  std::vector<int> values;
+  for (auto it = view.Cbegin(); it != view.Cend(); ++it) {
+    values.push_back(*it);
+  }
+  ASSERT_EQ(values, (std::vector<int>{1, 3, 5, 8}));
+}
+
+TEST(set, batch_lookup_test) {
+  s21::Set<std::string> my_set{"kiwi", "apple", "plum", "fig", "pear"};
+  std::vector<std::string> keys{"fig", "lime", "apple", "pear", "", "zz"};
+  std::vector<s21::Set<std::string>::ConstIterator> its;
+  std::vector<bool> contains;
+  my_set.FindBatch(keys.begin(), keys.size(), std::back_inserter(its));
+  my_set.ContainsBatch(keys.begin(), keys.size(),
+                       std::back_inserter(contains));
+  ASSERT_EQ(contains, (std::vector<bool>{1, 0, 1, 1, 0, 0}));
+  const s21::Set<std::string>& view = my_set;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    ASSERT_EQ(its[i], view.Find(keys[i]));
+  }
+}
+
+// Counts the comparisons a search makes
+struct CountingLess {
+  static int count;
+  bool operator()(int a, int b) const {
+    ++count;
+    return a < b;
+  }
+};
+int CountingLess::count = 0;
+
+TEST(set, compare_test) {
+  s21::Set<int, std::greater<int>> my_set;
+  std::set<int, std::greater<int>> orig_set;
+  std::mt19937 gen(5);
+  for (int i = 0; i < 2000; ++i) {
+    int key = gen() % 500;
+    if (gen() % 3) {
+      ASSERT_EQ(my_set.Insert(key).second, orig_set.insert(key).second);
+    } else if (my_set.Contains(key)) {
+      my_set.Erase(my_set.Find(key));
+      orig_set.erase(key);
+    }
+  }
+  ASSERT_EQ(my_set.Size(), orig_set.size());
+  auto orig_it = orig_set.begin();
+  for (auto it = my_set.Cbegin(); it != my_set.Cend(); ++it, ++orig_it) {
+    ASSERT_EQ(*it, *orig_it);
+  }
+  s21::FrozenSet<int, std::greater<int>> frozen = my_set.Freeze();
+  ASSERT_EQ(*frozen.Begin(), *orig_set.begin());
+  ASSERT_EQ(*frozen.LowerBound(600), *orig_set.lower_bound(600));
+  std::vector<int> keys(500);
+  for (int i = 0; i < 500; ++i) keys[i] = i;
+  std::vector<char> hits(500);
+  my_set.ContainsBatch(keys.begin(), keys.size(), hits.begin());
+  for (int i = 0; i < 500; ++i) {
+    ASSERT_EQ(hits[i], orig_set.count(i) == 1);
+    ASSERT_EQ(frozen.Contains(i), orig_set.count(i) == 1);
+  }
+}
+
+TEST(set, one_comparison_test) {
+  // Inserting the middle of each range first gives a balanced tree of ten
+  // levels
+  s21::Set<int, CountingLess> my_set;
+  std::vector<std::pair<int, int>> ranges{{0, 1023}};
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    int low = ranges[i].first, high = ranges[i].second;
+    if (low >= high) continue;
+    int middle = (low + high) / 2;
+    my_set.Insert(middle);
+    ranges.push_back({low, middle});
+    ranges.push_back({middle + 1, high});
+  }
+  ASSERT_EQ(my_set.Size(), 1023U);
+  for (int key = -1; key <= 1023; ++key) {
+    CountingLess::count = 0;
+    ASSERT_EQ(my_set.Contains(key), key >= 0 && key < 1023);
+    ASSERT_LE(CountingLess::count, 11);
+  }
+}
+
+TEST(set, transparent_test) {
+  s21::Set<std::string, std::less<>> my_set{"pear", "apple", "plum"};
+  const s21::Set<std::string, std::less<>>& reader = my_set;
+  std::string_view key = "plum";
+  ASSERT_EQ(*reader.Find(key), "plum");
+  ASSERT_TRUE(my_set.Find(key) != my_set.End());
+  ASSERT_TRUE(reader.Contains(std::string_view("apple")));
+  ASSERT_FALSE(reader.Contains(std::string_view("fig")));
+  ASSERT_TRUE(reader.Contains("pear"));
+}
+
+// SPSC QUEUE-------------------------------------------------------------------
+
+TEST(spsc_queue, capacity_test) {
+  s21::SpscQueue<int> my_queue(100);
+  ASSERT_EQ(my_queue.Capacity(), 128U);
+  ASSERT_TRUE(my_queue.Empty());
+  ASSERT_EQ(my_queue.Size(), 0U);
+}
+
+TEST(spsc_queue, push_pop_test) {
+  s21::SpscQueue<int> my_queue(4);
+  std::queue<int> orig_queue;
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_TRUE(my_queue.TryPush(i));
+    orig_queue.push(i);
+  }
+  ASSERT_FALSE(my_queue.TryPush(4));
+  ASSERT_EQ(my_queue.Size(), orig_queue.size());
+  while (!orig_queue.empty()) {
+    ASSERT_EQ(my_queue.Front(), orig_queue.front());
+    my_queue.Pop();
+    orig_queue.pop();
+  }
+  ASSERT_TRUE(my_queue.Empty());
+  int value = 0;
+  ASSERT_FALSE(my_queue.TryPop(value));
+}
+
+TEST(spsc_queue, wrap_around_test) {
+  s21::SpscQueue<std::string> my_queue(8);
+  std::queue<std::string> orig_queue;
+  for (int i = 0; i < 100; ++i) {
+    my_queue.Push(std::to_string(i));
+    orig_queue.push(std::to_string(i));
+    if (i % 3 == 0) {
+      std::string value;
+      ASSERT_TRUE(my_queue.TryPop(value));
+      ASSERT_EQ(value, orig_queue.front());
+      orig_queue.pop();
+    }
+    while (my_queue.Size() > 6) {
+      ASSERT_EQ(my_queue.Front(), orig_queue.front());
+      my_queue.Pop();
+      orig_queue.pop();
+    }
+  }
+  ASSERT_EQ(my_queue.Size(), orig_queue.size());
+}
+
+TEST(spsc_queue, batch_test) {
+  s21::SpscQueue<int> my_queue(16);
+  int input[20];
+  for (int i = 0; i < 20; ++i) input[i] = i;
+  ASSERT_EQ(my_queue.TryPushN(input, 20), 16U);
+  int output[20] = {};
+  ASSERT_EQ(my_queue.TryPopN(output, 10), 10U);
+  ASSERT_EQ(my_queue.TryPushN(input + 16, 4), 4U);
+  ASSERT_EQ(my_queue.TryPopN(output + 10, 20), 10U);
+  for (int i = 0; i < 20; ++i) ASSERT_EQ(output[i], i);
+}
+
+TEST(spsc_queue, two_threads_test) {
+  constexpr int kItems = 200000;
+  s21::SpscQueue<int> my_queue(64);
+  std::thread producer([&my_queue] {
+    for (int i = 0; i < kItems; ++i) my_queue.Push(i);
+  });
+  int value = 0;
+  for (int expected = 0; expected < kItems; ++expected) {
+    while (!my_queue.TryPop(value)) std::this_thread::yield();
+    ASSERT_EQ(value, expected);
+  }
+  producer.join();
+  ASSERT_TRUE(my_queue.Empty());
+}
+
 // STACK------------------------------------------------------------------------
 
 TEST(stack, default_constructor_test) {
@@ -2001,6 +4585,362 @@ TEST(stack, emplace_test_2) {
   }
 }
 
+TEST(stack, push_range_test) {
+  s21::Stack<int> my_stack{1, 2};
+  std::stack<int> orig_stack;
+  orig_stack.push(1);
+  orig_stack.push(2);
+  std::vector<int> items(1000);
+  for (int i = 0; i < 1000; ++i) items[i] = i * 3;
+  my_stack.PushRange(items.begin(), items.end());
+  for (int item : items) orig_stack.push(item);
+  ASSERT_EQ(my_stack.Size(), orig_stack.size());
+  while (!orig_stack.empty()) {
+    ASSERT_EQ(my_stack.Top(), orig_stack.top());
+    my_stack.Pop();
+    orig_stack.pop();
+  }
+}
+
+TEST(stack, pop_n_test) {
+  s21::Stack<int> my_stack{1, 2, 3, 4, 5};
+  s21::Vector<int> out;
+  ASSERT_EQ(my_stack.PopN(2, out), 2U);
+  ASSERT_EQ(out.Size(), 2U);
+  ASSERT_EQ(out[0], 5);
+  ASSERT_EQ(out[1], 4);
+  ASSERT_EQ(my_stack.Top(), 3);
+  ASSERT_EQ(my_stack.PopN(10, out), 3U);
+  ASSERT_TRUE(my_stack.Empty());
+  ASSERT_EQ(out[4], 1);
+}
+
+TEST(stack, small_batches_test) {
+  s21::Stack<int> my_stack;
+  s21::Vector<int> out;
+  size_t reallocations = 0;
+  for (int i = 0; i < 10000; ++i) {
+    int item[1] = {i};
+    my_stack.PushRange(item, item + 1);
+    size_t capacity = out.Capacity();
+    ASSERT_EQ(my_stack.PopN(1, out), 1U);
+    if (out.Capacity() != capacity) ++reallocations;
+  }
+  ASSERT_EQ(out.Size(), 10000U);
+  ASSERT_EQ(out[9999], 9999);
+  ASSERT_LE(reallocations, 20U);
+}
+
+TEST(stack, reserve_test) {
+  s21::Stack<int> my_stack;
+  my_stack.Reserve(100);
+  for (int i = 0; i < 100; ++i) my_stack.Push(i);
+  my_stack.ShrinkToFit();
+  ASSERT_EQ(my_stack.Size(), 100U);
+  ASSERT_EQ(my_stack.Top(), 99);
+}
+
+// THREAD POOL------------------------------------------------------------------
+
+TEST(thread_pool, submit_wait_test) {
+  s21::ThreadPool pool(4);
+  ASSERT_EQ(pool.Size(), 4U);
+  std::atomic<int> counter{0};
+  for (int i = 0; i < 5000; ++i) {
+    pool.Submit([&counter] { ++counter; });
+  }
+  pool.Wait();
+  ASSERT_EQ(counter.load(), 5000);
+}
+
+long long ParallelFib(s21::ThreadPool& pool, int n) {
+  if (n < 12) {
+    long long a = 0, b = 1;
+    for (int i = 0; i < n; ++i) b = std::exchange(a, b) + b;
+    return a;
+  }
+  long long x = 0, y = 0;
+  pool.Invoke([&] { x = ParallelFib(pool, n - 1); },
+              [&] { y = ParallelFib(pool, n - 2); });
+  return x + y;
+}
+
+TEST(thread_pool, invoke_test) {
+  s21::ThreadPool pool(4);
+  long long result = 0;
+  pool.Submit([&pool, &result] { result = ParallelFib(pool, 25); });
+  pool.Wait();
+  ASSERT_EQ(result, 75025);
+  ASSERT_EQ(ParallelFib(pool, 20), 6765);
+}
+
+// TIMER WHEEL------------------------------------------------------------------
+
+TEST(timer_wheel, expire_order_test) {
+  s21::TimerWheel<int> my_wheel;
+  std::vector<int> fired;
+  auto collect = [&fired](int value) { fired.push_back(value); };
+  my_wheel.Schedule(5, 5);
+  my_wheel.Schedule(1, 1);
+  my_wheel.Schedule(300, 300);
+  my_wheel.Schedule(70, 70);
+  my_wheel.Schedule(5000000000ULL, 7);
+  ASSERT_EQ(my_wheel.Size(), 5U);
+  ASSERT_EQ(my_wheel.Advance(4, collect), 1U);
+  ASSERT_EQ(my_wheel.Advance(100, collect), 2U);
+  ASSERT_EQ(my_wheel.Advance(299, collect), 0U);
+  ASSERT_EQ(my_wheel.Advance(300, collect), 1U);
+  ASSERT_EQ(my_wheel.Now(), 300U);
+  ASSERT_EQ(my_wheel.Advance(4999999999ULL, collect), 0U);
+  ASSERT_EQ(my_wheel.Advance(5000000000ULL, collect), 1U);
+  ASSERT_TRUE(my_wheel.Empty());
+  std::vector<int> expected{1, 5, 70, 300, 7};
+  ASSERT_EQ(fired, expected);
+}
+
+TEST(timer_wheel, cancel_test) {
+  s21::TimerWheel<std::string> my_wheel(1000);
+  auto first = my_wheel.Schedule(1010, "first");
+  auto second = my_wheel.Schedule(1010, "second");
+  auto late = my_wheel.Schedule(900, "late");
+  ASSERT_TRUE(my_wheel.Pending(first));
+  ASSERT_TRUE(my_wheel.Cancel(first));
+  ASSERT_FALSE(my_wheel.Cancel(first));
+  ASSERT_FALSE(my_wheel.Pending(first));
+  std::vector<std::string> fired;
+  my_wheel.Advance(1001, [&fired](std::string& v) { fired.push_back(v); });
+  ASSERT_EQ(fired, std::vector<std::string>{"late"});
+  ASSERT_FALSE(my_wheel.Cancel(late));
+  auto reused = my_wheel.Schedule(1020, "reused");
+  ASSERT_NE(reused, first);
+  ASSERT_NE(reused, late);
+  my_wheel.Advance(2000, [&fired](std::string& v) { fired.push_back(v); });
+  std::vector<std::string> expected{"late", "second", "reused"};
+  ASSERT_EQ(fired, expected);
+  ASSERT_FALSE(my_wheel.Pending(second));
+}
+
+TEST(timer_wheel, callback_reschedule_test) {
+  s21::TimerWheel<int> my_wheel;
+  s21::TimerWheel<int>::Handle pair[2];
+  int periodic = 0;
+  int pair_fired = 0;
+  my_wheel.Schedule(10, 0);
+  pair[0] = my_wheel.Schedule(10, 1);
+  pair[1] = my_wheel.Schedule(10, 2);
+  ASSERT_EQ(my_wheel.Advance(1000,
+                             [&](int value) {
+                               if (value == 0) {
+                                 ++periodic;
+                                 if (periodic < 6) {
+                                   my_wheel.Schedule(my_wheel.Now() + 100, 0);
+                                 }
+                               } else {
+                                 // whichever fires first cancels the other
+                                 ++pair_fired;
+                                 ASSERT_TRUE(my_wheel.Cancel(pair[2 - value]));
+                               }
+                             }),
+            7U);
+  ASSERT_EQ(periodic, 6);
+  ASSERT_EQ(pair_fired, 1);
+  ASSERT_TRUE(my_wheel.Empty());
+}
+
+TEST(timer_wheel, random_test) {
+  s21::TimerWheel<size_t> my_wheel;
+  std::multimap<uint64_t, size_t> orig_timers;
+  std::vector<s21::TimerWheel<size_t>::Handle> handles;
+  std::vector<uint64_t> deadlines;
+  std::vector<bool> live;
+  uint64_t seed = 11;
+  auto next = [&seed] {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return seed >> 20;
+  };
+  for (int round = 0; round < 3000; ++round) {
+    uint64_t now = my_wheel.Now();
+    int op = static_cast<int>(next() % 10);
+    if (op < 6) {
+      uint64_t span = uint64_t(1) << (next() % 40);
+      uint64_t deadline = now + next() % span;
+      handles.push_back(my_wheel.Schedule(deadline, deadlines.size()));
+      orig_timers.emplace(deadline > now ? deadline : now + 1,
+                          deadlines.size());
+      deadlines.push_back(deadline);
+      live.push_back(true);
+    } else if (op < 8 && !deadlines.empty()) {
+      size_t id = next() % deadlines.size();
+      ASSERT_EQ(my_wheel.Cancel(handles[id]), static_cast<bool>(live[id]));
+      if (live[id]) {
+        live[id] = false;
+        for (auto it = orig_timers.begin(); it != orig_timers.end(); ++it) {
+          if (it->second == id) {
+            orig_timers.erase(it);
+            break;
+          }
+        }
+      }
+    } else {
+      uint64_t target = now + (next() % (uint64_t(1) << (next() % 36)));
+      std::set<size_t> fired;
+      my_wheel.Advance(target, [&](size_t id) { fired.insert(id); });
+      std::set<size_t> expected;
+      while (!orig_timers.empty() && orig_timers.begin()->first <= target) {
+        expected.insert(orig_timers.begin()->second);
+        live[orig_timers.begin()->second] = false;
+        orig_timers.erase(orig_timers.begin());
+      }
+      ASSERT_EQ(fired, expected);
+    }
+    ASSERT_EQ(my_wheel.Size(), orig_timers.size());
+  }
+}
+
+// UNROLLED LIST----------------------------------------------------------------
+
+TEST(unrolled_list, push_pop_test) {
+  s21::UnrolledList<int, 4> my_list;
+  std::list<int> orig_list;
+  for (int i = 0; i < 50; ++i) {
+    if (i % 3) {
+      my_list.PushBack(i);
+      orig_list.push_back(i);
+    } else {
+      my_list.PushFront(i);
+      orig_list.push_front(i);
+    }
+  }
+  ASSERT_EQ(my_list.Size(), orig_list.size());
+  ASSERT_EQ(my_list.Front(), orig_list.front());
+  ASSERT_EQ(my_list.Back(), orig_list.back());
+  ASSERT_TRUE(std::equal(orig_list.begin(), orig_list.end(), my_list.Begin()));
+  auto rorig = orig_list.rbegin();
+  for (auto it = my_list.End(); it != my_list.Begin(); ++rorig) {
+    ASSERT_EQ(*--it, *rorig);
+  }
+  for (int i = 0; i < 10; ++i) {
+    my_list.PopFront();
+    my_list.PopBack();
+    orig_list.pop_front();
+    orig_list.pop_back();
+  }
+  ASSERT_EQ(my_list.Size(), orig_list.size());
+  ASSERT_TRUE(std::equal(orig_list.begin(), orig_list.end(), my_list.Begin()));
+}
+
+TEST(unrolled_list, dense_chunks_test) {
+  s21::UnrolledList<int, 16> my_list;
+  for (int i = 0; i < 1000; ++i) my_list.PushBack(i);
+  ASSERT_EQ(my_list.ChunkCount(), 63U);
+  s21::UnrolledList<int, 16> front_list;
+  for (int i = 0; i < 1000; ++i) front_list.PushFront(i);
+  ASSERT_EQ(front_list.ChunkCount(), 63U);
+  ASSERT_EQ(front_list.Front(), 999);
+  ASSERT_EQ(front_list.Back(), 0);
+}
+
+TEST(unrolled_list, insert_erase_test) {
+  s21::UnrolledList<int, 8> my_list;
+  std::list<int> orig_list;
+  unsigned state = 7;
+  for (int round = 0; round < 5000; ++round) {
+    state = state * 1103515245U + 12345U;
+    size_t at = orig_list.empty() ? 0 : (state >> 8) % (orig_list.size() + 1);
+    auto it = std::next(my_list.Begin(), at);
+    auto orig = std::next(orig_list.begin(), at);
+    if (state % 3 == 0 && orig != orig_list.end()) {
+      auto next = my_list.Erase(it);
+      auto orig_next = orig_list.erase(orig);
+      ASSERT_EQ(next == my_list.End(), orig_next == orig_list.end());
+      if (orig_next != orig_list.end()) {
+        ASSERT_EQ(*next, *orig_next);
+      }
+    } else {
+      ASSERT_EQ(*my_list.Insert(it, round), round);
+      orig_list.insert(orig, round);
+    }
+  }
+  ASSERT_EQ(my_list.Size(), orig_list.size());
+  ASSERT_TRUE(std::equal(orig_list.begin(), orig_list.end(), my_list.Begin()));
+  ASSERT_LE(my_list.ChunkCount(), 2 * my_list.Size() / 8 + 2);
+}
+
+TEST(unrolled_list, sparse_erase_test) {
+  s21::UnrolledList<std::string, 16> my_list;
+  std::list<std::string> orig_list;
+  for (int i = 0; i < 1600; ++i) {
+    my_list.PushBack(std::to_string(i));
+    orig_list.push_back(std::to_string(i));
+  }
+  // Keep one element in sixteen, erasing from the back half first
+  for (int pass = 0; pass < 2; ++pass) {
+    auto it = my_list.Begin();
+    auto orig = orig_list.begin();
+    for (int i = 0; it != my_list.End(); ++i) {
+      if (i % 16 && (i >= 800) != pass) {
+        it = my_list.Erase(it);
+        orig = orig_list.erase(orig);
+      } else {
+        ++it;
+        ++orig;
+      }
+    }
+  }
+  ASSERT_EQ(my_list.Size(), orig_list.size());
+  ASSERT_TRUE(std::equal(orig_list.begin(), orig_list.end(), my_list.Begin()));
+  // Every chunk but the last holds at least 3 * 16 / 8 elements
+  ASSERT_LE(my_list.ChunkCount(), my_list.Size() / 6 + 1);
+  while (my_list.Size() > 1) my_list.Erase(++my_list.Begin());
+  ASSERT_EQ(my_list.ChunkCount(), 1U);
+  ASSERT_EQ(my_list.Front(), "0");
+}
+
+TEST(unrolled_list, splice_test) {
+  s21::UnrolledList<std::string, 4> my_list{"a", "b", "c", "d", "e"};
+  s21::UnrolledList<std::string, 4> other{"x", "y", "z"};
+  std::list<std::string> orig_list{"a", "b", "c", "d", "e"};
+  std::list<std::string> orig_other{"x", "y", "z"};
+  auto pos = my_list.Begin();
+  ++pos;
+  ++pos;
+  my_list.Splice(pos, other);
+  orig_list.splice(std::next(orig_list.begin(), 2), orig_other);
+  ASSERT_TRUE(other.Empty());
+  ASSERT_EQ(my_list.Size(), orig_list.size());
+  ASSERT_TRUE(std::equal(orig_list.begin(), orig_list.end(), my_list.Begin()));
+  s21::UnrolledList<std::string, 4> tail{"end"};
+  my_list.Splice(my_list.End(), tail);
+  ASSERT_EQ(my_list.Back(), "end");
+  s21::UnrolledList<std::string, 4> head{"begin"};
+  my_list.Splice(my_list.Begin(), head);
+  ASSERT_EQ(my_list.Front(), "begin");
+  ASSERT_EQ(my_list.Size(), 10U);
+}
+
+TEST(unrolled_list, copy_move_test) {
+  s21::UnrolledList<std::string, 4> my_list{"one", "two", "three", "four",
+                                            "five"};
+  s21::UnrolledList<std::string, 4> copy(my_list);
+  ASSERT_TRUE(std::equal(copy.Begin(), copy.End(), my_list.Begin()));
+  s21::UnrolledList<std::string, 4> moved(std::move(copy));
+  ASSERT_TRUE(copy.Empty());
+  ASSERT_EQ(copy.Begin(), copy.End());
+  ASSERT_EQ(moved.Size(), 5U);
+  copy = moved;
+  ASSERT_EQ(copy.Back(), "five");
+  moved.Clear();
+  ASSERT_TRUE(moved.Empty());
+  ASSERT_EQ(moved.ChunkCount(), 0U);
+  moved.EmplaceBack(3, 'a');
+  moved.EmplaceFront("front");
+  ASSERT_EQ(moved.Front(), "front");
+  ASSERT_EQ(moved.Back(), "aaa");
+  copy.Swap(moved);
+  ASSERT_EQ(copy.Size(), 2U);
+  ASSERT_EQ(moved.Size(), 5U);
+}
+
 // VECTOR-----------------------------------------------------------------------
 
 TEST(vector, default_constructor_test) {
@@ -2239,6 +5179,17 @@ TEST(vector, clear_test) {
   ASSERT_EQ(my_vector.Empty(), orig_vector.empty());
 }
 
+TEST(vector, clear_push_back_test) {
+  s21::Vector<std::string> my_vector{"one", "two"};
+  my_vector.Clear();
+  std::string value = "three";
+  my_vector.PushBack(std::move(value));
+  my_vector.PushBack("four");
+  ASSERT_EQ(my_vector.Size(), 2U);
+  ASSERT_EQ(my_vector[0], "three");
+  ASSERT_EQ(my_vector[1], "four");
+}
+
 TEST(vector, reserve_capacity_test_1) {
   s21::Vector<int> my_vector;
   std::vector<int> orig_vector;
@@ -2340,4 +5291,67 @@ TEST(vector, const_iterator_operator_test_2) {
 int main() {
   ::testing::InitGoogleTest();
   return RUN_ALL_TESTS();
-}
\ No newline at end of file
+}
+
+// WORK STEALING DEQUE----------------------------------------------------------
+
+TEST(work_stealing_deque, owner_lifo_test) {
+  s21::WorkStealingDeque<int> my_deque(4);
+  std::stack<int> orig_stack;
+  for (int i = 0; i < 100; ++i) {
+    my_deque.Push(i);
+    orig_stack.push(i);
+  }
+  ASSERT_EQ(my_deque.Size(), orig_stack.size());
+  ASSERT_GE(my_deque.Capacity(), 100U);
+  int value = 0;
+  while (!orig_stack.empty()) {
+    ASSERT_TRUE(my_deque.TryPop(value));
+    ASSERT_EQ(value, orig_stack.top());
+    orig_stack.pop();
+  }
+  ASSERT_FALSE(my_deque.TryPop(value));
+  ASSERT_TRUE(my_deque.Empty());
+}
+
+TEST(work_stealing_deque, steal_fifo_test) {
+  s21::WorkStealingDeque<int> my_deque;
+  std::queue<int> orig_queue;
+  for (int i = 0; i < 10; ++i) {
+    my_deque.Push(i);
+    orig_queue.push(i);
+  }
+  int value = 0;
+  while (!orig_queue.empty()) {
+    ASSERT_TRUE(my_deque.Steal(value));
+    ASSERT_EQ(value, orig_queue.front());
+    orig_queue.pop();
+  }
+  ASSERT_FALSE(my_deque.Steal(value));
+}
+
+TEST(work_stealing_deque, concurrent_steal_test) {
+  constexpr int kItems = 100000;
+  constexpr int kThieves = 3;
+  s21::WorkStealingDeque<int> my_deque(8);
+  std::vector<std::atomic<int>> seen(kItems);
+  std::atomic<bool> done{false};
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < kThieves; ++t) {
+    thieves.emplace_back([&my_deque, &seen, &done] {
+      int value = 0;
+      while (!done.load() || !my_deque.Empty()) {
+        if (my_deque.Steal(value)) ++seen[value];
+      }
+    });
+  }
+  int value = 0;
+  for (int i = 0; i < kItems; ++i) {
+    my_deque.Push(i);
+    if (i % 3 == 0 && my_deque.TryPop(value)) ++seen[value];
+  }
+  while (my_deque.TryPop(value)) ++seen[value];
+  done = true;
+  for (auto& thief : thieves) thief.join();
+  for (int i = 0; i < kItems; ++i) ASSERT_EQ(seen[i].load(), 1);
+}
@@ -16,6 +16,86 @@ TEST(array, exception_test_2) {
   }
 }
 
+TEST(concurrent_map, exception_test_1) {
+  s21::ConcurrentMap<int, int> my_map;
+  my_map.Insert(1, 1);
+  ASSERT_THROW(my_map.At(2), std::out_of_range);
+}
+
+TEST(concurrent_skip_list_map, exception_test_1) {
+  s21::ConcurrentSkipListMap<int, int> my_map;
+  my_map.Insert(1, 1);
+  ASSERT_THROW(my_map.At(2), std::out_of_range);
+}
+
+TEST(cow_map, exception_test_1) {
+  const s21::CowMap<int, int> my_map{{1, 1}};
+  s21::CowMap<int, int> copy = my_map;
+  ASSERT_THROW(my_map.At(2), std::out_of_range);
+  ASSERT_THROW(copy.At(2), std::out_of_range);
+}
+
+TEST(cow_vector, exception_test_1) {
+  const s21::CowVector<int> my_vector{1, 2, 3};
+  s21::CowVector<int> copy = my_vector;
+  ASSERT_THROW(my_vector.At(3), std::out_of_range);
+  ASSERT_THROW(copy.At(3), std::out_of_range);
+}
+
+TEST(deque, exception_test_1) {
+  s21::Deque<int> my_deque{1, 2, 3};
+  ASSERT_THROW(my_deque.At(3), std::out_of_range);
+}
+
+TEST(deque, exception_test_2) {
+  s21::Deque<int> my_deque;
+  ASSERT_THROW(my_deque.Front(), std::out_of_range);
+  ASSERT_THROW(my_deque.Back(), std::out_of_range);
+}
+
+TEST(filtered_map, exception_test_1) {
+  s21::FilteredMap<int, int> my_map{{1, 1}};
+  const s21::FilteredMap<int, int>& reader = my_map;
+  ASSERT_THROW(my_map.At(2), std::out_of_range);
+  ASSERT_THROW(reader.At(2), std::out_of_range);
+  my_map.Erase(1);
+  ASSERT_THROW(my_map.At(1), std::out_of_range);
+}
+
+TEST(forward_list, exception_test_1) {
+  s21::ForwardList<int> my_list;
+  ASSERT_THROW(my_list.Front(), std::out_of_range);
+  ASSERT_THROW(my_list.PopFront(), std::out_of_range);
+  ASSERT_THROW(my_list.EraseAfter(my_list.BeforeBegin()), std::out_of_range);
+}
+
+TEST(frozen_map, exception_test_1) {
+  s21::Map<int, int> my_map{{1, 1}};
+  s21::FrozenMap<int, int> frozen = my_map.Freeze();
+  ASSERT_THROW(frozen.At(2), std::out_of_range);
+}
+
+TEST(indexed_priority_queue, exception_test_1) {
+  s21::IndexedPriorityQueue<int> my_queue;
+  ASSERT_THROW(my_queue.Top(), std::out_of_range);
+  ASSERT_THROW(my_queue.Pop(), std::out_of_range);
+  auto handle = my_queue.Push(1);
+  my_queue.Pop();
+  ASSERT_THROW(my_queue.Get(handle), std::out_of_range);
+  ASSERT_THROW(my_queue.Erase(handle), std::out_of_range);
+}
+
+TEST(intrusive_list, exception_test_1) {
+  struct Item {
+    s21::IntrusiveListHook hook;
+  };
+  s21::IntrusiveList<Item, &Item::hook> my_list;
+  ASSERT_THROW(my_list.Front(), std::out_of_range);
+  ASSERT_THROW(my_list.Back(), std::out_of_range);
+  ASSERT_THROW(my_list.PopFront(), std::out_of_range);
+  ASSERT_THROW(my_list.PopBack(), std::out_of_range);
+}
+
 TEST(list, exception_test_1) {
   s21::List<int> my_list;
   ASSERT_THROW(my_list.Front(), std::out_of_range);
@@ -31,11 +111,42 @@ TEST(list, exception_test_3) {
   ASSERT_THROW(my_list.Erase(my_list.Begin()), std::out_of_range);
 }
 
+TEST(list, exception_test_4) {
+  s21::List<int> my_list{1, 2};
+  s21::List<int> other;
+  ASSERT_THROW(my_list.Splice(my_list.Cbegin(), other, other.Cend()),
+               std::out_of_range);
+}
+
 TEST(map, exception_test_1) {
   s21::Map<int, char> my_map{{5, 'a'}, {6, 'b'}, {3, 'c'}};
   ASSERT_THROW(my_map.At(1), std::out_of_range);
 }
 
+TEST(map, exception_test_2) {
+  const s21::Map<int, char> my_map{{5, 'a'}, {6, 'b'}, {3, 'c'}};
+  ASSERT_THROW(my_map.At(1), std::out_of_range);
+}
+
+TEST(pairing_heap, exception_test_1) {
+  s21::PairingHeap<int> my_heap;
+  ASSERT_THROW(my_heap.Top(), std::out_of_range);
+  ASSERT_THROW(my_heap.Pop(), std::out_of_range);
+}
+
+TEST(persistent_map, exception_test_1) {
+  s21::PersistentMap<int, int> my_map{{1, 1}};
+  ASSERT_THROW(my_map.At(2), std::out_of_range);
+  ASSERT_THROW(my_map.Erase(1).At(1), std::out_of_range);
+}
+
+TEST(priority_queue, exception_test_1) {
+  s21::PriorityQueue<int> my_queue;
+  ASSERT_THROW(my_queue.Top(), std::out_of_range);
+  ASSERT_THROW(my_queue.Pop(), std::out_of_range);
+  ASSERT_THROW(my_queue.Replace(1), std::out_of_range);
+}
+
 TEST(queue, exception_test_1) {
   s21::Queue<int> my_queue;
   ASSERT_THROW(my_queue.Front(), std::out_of_range);
@@ -46,6 +157,102 @@ TEST(queue, exception_test_2) {
   ASSERT_THROW(my_queue.Back(), std::out_of_range);
 }
 
+TEST(rcu_map, exception_test_1) {
+  s21::RcuMap<int, int> my_map{{1, 1}};
+  ASSERT_THROW(my_map.At(2), std::out_of_range);
+}
+
+TEST(spsc_queue, exception_test_1) {
+  s21::SpscQueue<int> my_queue(4);
+  ASSERT_THROW(my_queue.Front(), std::out_of_range);
+}
+
+struct CountedCopy {
+  static inline int alive = 0;
+  int value = 0;
+  explicit CountedCopy(int v) : value(v) { ++alive; }
+  CountedCopy(const CountedCopy& other) : value(other.value) {
+    if (value < 0) throw std::out_of_range("copy");
+    ++alive;
+  }
+  ~CountedCopy() { --alive; }
+};
+
+TEST(spsc_queue, exception_test_2) {
+  {
+    s21::SpscQueue<CountedCopy> my_queue(8);
+    CountedCopy items[] = {CountedCopy(1), CountedCopy(2), CountedCopy(-1),
+                           CountedCopy(4)};
+    ASSERT_THROW(my_queue.TryPushN(items, 4), std::out_of_range);
+    ASSERT_TRUE(my_queue.Empty());
+    ASSERT_EQ(CountedCopy::alive, 4);
+    ASSERT_EQ(my_queue.TryPushN(items, 2), 2U);
+    ASSERT_EQ(my_queue.Front().value, 1);
+  }
+  ASSERT_EQ(CountedCopy::alive, 0);
+}
+
+TEST(thread_pool, exception_test_1) {
+  s21::ThreadPool pool(4);
+  std::atomic<int> counter{0};
+  for (int i = 0; i < 100; ++i) {
+    pool.Submit([&counter, i] {
+      if (i % 10 == 0) throw std::out_of_range("task");
+      ++counter;
+    });
+  }
+  ASSERT_THROW(pool.Wait(), std::out_of_range);
+  ASSERT_EQ(counter.load(), 90);
+  ASSERT_NO_THROW(pool.Wait());
+  pool.Submit([] { throw std::out_of_range("dropped"); });
+}
+
+TEST(thread_pool, exception_test_2) {
+  s21::ThreadPool pool(4);
+  std::atomic<int> counter{0};
+  auto count = [&counter] { ++counter; };
+  auto fail = [] { throw std::out_of_range("half"); };
+  ASSERT_THROW(pool.Invoke(fail, count), std::out_of_range);
+  ASSERT_THROW(pool.Invoke(count, fail), std::out_of_range);
+  ASSERT_EQ(counter.load(), 2);
+  bool caught = false;
+  pool.Submit([&] {
+    for (int i = 0; i < 100; ++i) {
+      try {
+        if (i % 2) pool.Invoke(fail, count);
+        pool.Invoke(count, count);
+      } catch (const std::out_of_range&) {
+        caught = true;
+      }
+    }
+  });
+  pool.Wait();
+  ASSERT_TRUE(caught);
+  ASSERT_EQ(counter.load(), 152);
+}
+
+struct ThrowingCopy {
+  ThrowingCopy() = default;
+  ThrowingCopy(const ThrowingCopy&) { throw std::out_of_range("copy"); }
+  void operator()() const {}
+};
+
+TEST(thread_pool, exception_test_3) {
+  s21::ThreadPool pool(2);
+  const ThrowingCopy task;
+  ASSERT_THROW(pool.Submit(task), std::out_of_range);
+  pool.Wait();
+}
+
+TEST(unrolled_list, exception_test_1) {
+  s21::UnrolledList<int> my_list;
+  ASSERT_THROW(my_list.Front(), std::out_of_range);
+  ASSERT_THROW(my_list.Back(), std::out_of_range);
+  ASSERT_THROW(my_list.PopFront(), std::out_of_range);
+  ASSERT_THROW(my_list.PopBack(), std::out_of_range);
+  ASSERT_THROW(my_list.Erase(my_list.End()), std::out_of_range);
+}
+
 TEST(vector, exception_test_1) {
   s21::Vector<int> my_vector{1, 3, 5, 7, 9};
   ASSERT_THROW(my_vector.At(8), std::out_of_range);